@@ -0,0 +1,175 @@
+/*EJEMPLO Y PRUEBA DE AlgoritmoGeneticoCelular CON EvaluadorHilos (UNGenetico 2.0).
+
+  Primero prueba PoolTareas::paralelo() directamente:
+	1. Procesa 1000 elementos de costo muy desigual: cada elemento debe procesarse
+	   una sola vez y con un nmero de trabajador vlido.
+	2. Invoca paralelo() desde los propios trabajadores del pool, que deben ejecutar
+	   tareas mientras esperan.
+  Luego minimiza f(x)=suma((x[i]-1)^2), con NUM_VARIABLES variables en [-4,4], con un
+  algoritmo celular que evala los hijos de cada color en bloques repartidos entre
+  NUM_HILOS hilos (Ver Evaluador::evaluarLote()). El costo de la funcin objetivo
+  depende de x[0], de modo que los hilos deben robarse los bloques. Al final, la
+  funcin objetivo de cada individuo de la poblacin debe coincidir con la que se
+  calcula de nuevo a partir de sus genes, y las evaluaciones deben haberse hecho en
+  ms de un hilo.
+
+  Requiere C++11. Retorna 0 si todas las pruebas son correctas.
+  La salida debe terminar con:
+			Pruebas correctas
+*/
+
+#include "UNGenetico.h"
+
+#if defined(UN_CPP11)
+
+#include <set>
+
+//!Nmero de variables de la funcin objetivo
+#define NUM_VARIABLES 4
+//!Nmero de hilos de evaluacin
+#define NUM_HILOS 4
+
+//!Nmero de evaluaciones de la funcin objetivo
+std::atomic<int> g_Evaluaciones(0);
+//!Hilos en los que se ha evaluado la funcin objetivo
+std::set<std::thread::id> g_Hilos;
+//!Protege \a g_Hilos
+std::mutex g_CandadoHilos;
+
+
+DECLARAR_ALGORITMO_CELULAR(MiAG)
+	void inicializarParametros();
+	void definirOperadores();
+	double x[NUM_VARIABLES];
+FIN_DECLARAR_ALGORITMO
+
+
+void MiAG::inicializarParametros()
+{
+	m_TamanoPoblacion=64;
+	m_GeneracionMaxima=150;
+}
+
+void MiAG::definirOperadores()
+{
+	DEFINIR_EVALUADOR(EvaluadorHilos(NUM_HILOS))
+}
+
+void MiAG::codificacion(Individuo* pInd, int estado)
+{
+	for(int i=0; i<NUM_VARIABLES; i++)
+		ADICIONAR_GENREAL(pInd, i, x[i], -4.0, 4.0, 0.0);
+}
+
+double funcion(const double *x)
+{
+	double suma = 0.0;
+	for(int i=0; i<NUM_VARIABLES; i++)
+		suma += (x[i]-1)*(x[i]-1);
+	return suma;
+}
+
+//Cada instancia del algoritmo tiene su propio x; solo los contadores de la prueba son compartidos
+double MiAG::objetivo()
+{
+	if(x[0] > 2.0)
+		usleep(200);
+	g_Evaluaciones++;
+	{
+		std::lock_guard<std::mutex> candado(g_CandadoHilos);
+		g_Hilos.insert(std::this_thread::get_id());
+	}
+	return funcion(x);
+}
+
+
+/*PRUEBAS*/
+
+bool probarParalelo()
+{
+	PoolTareas Pool(NUM_HILOS);
+	const int num = 1000;
+	std::atomic<int> veces[num];
+	std::atomic<bool> trabajadorValido(true);
+	int i;
+	for(i=0; i<num; i++)
+		veces[i] = 0;
+
+	Pool.paralelo(num, 1, [&](int inicio, int fin, int trabajador)
+	{
+		if(trabajador < 0 || trabajador >= NUM_HILOS)
+			trabajadorValido = false;
+		for(int k=inicio; k<fin; k++)
+		{
+			if(k%100 == 0)
+				usleep(5000);
+			veces[k]++;
+		}
+	});
+	bool correcta = trabajadorValido;
+	for(i=0; i<num; i++)
+		correcta = correcta && veces[i]==1;
+	cout << "paralelo con costos desiguales: " << (correcta ? "Correcta" : "ERROR") << "\n";
+
+	//cada trabajador espera a sus propios bloques ejecutando los de los dems
+	std::atomic<int> total(0);
+	Pool.paralelo(2*NUM_HILOS, 1, [&](int, int, int)
+	{
+		Pool.paralelo(100, 0, [&](int inicio, int fin, int)
+		{
+			total += fin-inicio;
+		});
+	});
+	bool anidada = total == 2*NUM_HILOS*100;
+	cout << "paralelo desde los trabajadores: " << (anidada ? "Correcta" : "ERROR") << "\n";
+	return correcta && anidada;
+}
+
+bool probarCelular()
+{
+	MiAG AG;
+	AG.optimizar();
+
+	//la funcin objetivo de cada individuo debe corresponder a sus genes
+	int correctos = 0, tamPob = AG.m_pPoblacionActual->getTam();
+	for(int i=0; i<tamPob; i++)
+	{
+		Individuo &ind = AG.m_pPoblacionActual->getIndividuoDirecto(i);
+		bool actualizado = ind.objetivoActualizado();
+		double valor = ind.objetivo();
+		AG.codificacion(&ind, ESTADO_DECODIFICAR);
+		if(actualizado && fabs(valor - funcion(AG.x)) < 1e-12)
+			correctos++;
+	}
+
+	double mejor = AG.m_pMejorEnLaHistoria->objetivo(true);	//con true se decodifica x
+	cout << "\nEvaluaciones: " << g_Evaluaciones << " en " << g_Hilos.size() << " hilos\n";
+	cout << "Individuos con la funcin objetivo correcta: " << correctos << " de " << tamPob << "\n";
+	cout << "F(Xmin)= " << mejor << " Xmin=";
+	for(int k=0; k<NUM_VARIABLES; k++)
+		cout << " " << AG.x[k];
+	cout << "\n";
+	return correctos == tamPob && g_Hilos.size() > 1 && mejor < 0.01;
+}
+
+int main()
+{
+	cout << "EJEMPLO Y PRUEBA DE AlgoritmoGeneticoCelular CON EvaluadorHilos\n\n";
+	cout.flush();
+
+	bool correctas = probarParalelo();
+	correctas = probarCelular() && correctas;
+
+	cout << "\n" << (correctas ? "Pruebas correctas" : "Pruebas con ERRORES") << "\n";
+	return correctas ? 0 : 1;
+}
+
+#else
+
+int main()
+{
+	cout << "EvaluadorHilos solo esta disponible al compilar con C++11 o posterior\n";
+	return 0;
+}
+
+#endif
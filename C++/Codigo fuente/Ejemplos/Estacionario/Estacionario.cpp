@@ -0,0 +1,112 @@
+/*EJEMPLO Y PRUEBA DE AlgoritmoGeneticoEstacionario (UNGenetico 2.0).
+
+  Minimiza f(x,y,k)=(x-1)^2+(y+2)^2+(k-3)^2, con x y y reales en [-4,4] y k entero
+  en [-50,50], con un algoritmo estacionario y los operadores de cruce BGA lineal,
+  que usan las funciones objetivo de los padres (Ver OperadorCruce::asignarObjetivos()).
+  Se ejecuta una vez con cada tipo de remplazo: REMPLAZO_PEOR, REMPLAZO_AZAR y
+  REMPLAZO_SIMILAR. En cada ejecucin se revisa que:
+	1. La funcin objetivo de cada individuo de la poblacin corresponda a sus genes.
+	2. El mejor individuo de la historia no sea peor que ningn individuo de la poblacin.
+	3. La media de la poblacin, que el algoritmo mantiene sin recorrerla, coincida
+	   con la que se calcula de nuevo.
+	4. Con REMPLAZO_PEOR se haya llegado al mnimo.
+
+  Retorna 0 si todas las pruebas son correctas.
+  La salida debe terminar con:
+			Pruebas correctas
+*/
+
+#include "UNGenetico.h"
+
+//!Tipo de remplazo de la ejecucin actual
+int g_Remplazo = REMPLAZO_PEOR;
+
+
+DECLARAR_ALGORITMO_ESTACIONARIO(MiAG)
+	void inicializarParametros();
+	void definirOperadores();
+	double x, y;
+	long k;
+FIN_DECLARAR_ALGORITMO
+
+
+void MiAG::inicializarParametros()
+{
+	m_TamanoPoblacion=40;
+	m_GeneracionMaxima=4000;
+	m_NumHijos=2;
+	m_TipoRemplazo=g_Remplazo;
+	m_FactorAglomeracion=5;
+}
+
+void MiAG::definirOperadores()
+{
+	ADICIONAR_OPERADOR_CRUCE(OperadorCruceRealLinealBGA(this))
+	ADICIONAR_OPERADOR_CRUCE(OperadorCruceRealLinealBGA(this))
+	ADICIONAR_OPERADOR_CRUCE(OperadorCruceEnteroLinealBGA(this))
+}
+
+void MiAG::codificacion(Individuo* pInd, int estado)
+{
+	ADICIONAR_GENREAL(pInd, 0, x, -4.0, 4.0, 0.0);
+	ADICIONAR_GENREAL(pInd, 1, y, -4.0, 4.0, 0.0);
+	ADICIONAR_GENENTERO(pInd, 2, k, -50, 50, 20);
+}
+
+double funcion(double x, double y, long k)
+{
+	return (x-1)*(x-1) + (y+2)*(y+2) + (double)((k-3)*(k-3));
+}
+
+double MiAG::objetivo()
+{
+	return funcion(x, y, k);
+}
+
+
+/*PRUEBAS*/
+
+bool probar(const char *nombre, int remplazo)
+{
+	g_Remplazo = remplazo;
+	MiAG AG;
+	AG.optimizar();
+
+	int correctos = 0, tamPob = AG.m_pPoblacionActual->getTam();
+	double mejor = AG.m_pMejorEnLaHistoria->objetivo(true);	//con true se decodifican x, y y k
+	double xMin = AG.x, yMin = AG.y;
+	long kMin = AG.k;
+	bool mejorCorrecto = fabs(mejor - funcion(xMin, yMin, kMin)) < 1e-12;
+	double suma = 0.0;
+	for(int i=0; i<tamPob; i++)
+	{
+		Individuo &ind = AG.m_pPoblacionActual->getIndividuoDirecto(i);
+		double valor = ind.objetivo(true);
+		if(fabs(valor - funcion(AG.x, AG.y, AG.k)) < 1e-12)
+			correctos++;
+		mejorCorrecto = mejorCorrecto && mejor <= valor;
+		suma += valor;
+	}
+	double media = suma/tamPob;
+	bool mediaCorrecta = fabs(media - AG.m_Media) <= 1e-9*(1.0 + fabs(media));
+	bool minimo = remplazo != REMPLAZO_PEOR || mejor < 0.01;
+
+	cout << nombre << ": F(Xmin)= " << mejor << " Xmin= " << xMin << " Ymin= " << yMin << " Kmin= " << kMin << "\n";
+	cout << "\tIndividuos con la funcin objetivo correcta: " << correctos << " de " << tamPob
+		<< ". Media: " << AG.m_Media << " (recalculada " << media << ")\n";
+	bool correcta = correctos == tamPob && mejorCorrecto && mediaCorrecta && minimo;
+	cout << "\t" << (correcta ? "Correcta" : "ERROR") << "\n";
+	return correcta;
+}
+
+int main()
+{
+	cout << "EJEMPLO Y PRUEBA DE AlgoritmoGeneticoEstacionario\n\n";
+
+	bool correctas = probar("Remplazo del peor", REMPLAZO_PEOR);
+	correctas = probar("Remplazo al azar", REMPLAZO_AZAR) && correctas;
+	correctas = probar("Remplazo del similar", REMPLAZO_SIMILAR) && correctas;
+
+	cout << "\n" << (correctas ? "Pruebas correctas" : "Pruebas con ERRORES") << "\n";
+	return correctas ? 0 : 1;
+}
@@ -0,0 +1,125 @@
+/*EJEMPLO Y PRUEBA DE AlgoritmoGeneticoT (UNGenetico 2.0).
+
+  Encuentra el mnimo de f(x)=sin(x)+sin(4x) en [0,10], el mismo problema del ejemplo
+  Simple, con un algoritmo declarado con DECLARAR_ALGORITMO_ESTATICO: los operadores de
+  probabilidad, seleccin, parejas y reproduccin quedan fijos en tiempo de compilacin.
+  El operador de seleccin se configura en definirOperadores() con
+		DEFINIR_OPERADOR_SELECCION(OperadorSeleccionTorneo(3))
+  que solo compila porque OperadorSeleccionTorneo es la clase de la plantilla.
+  Se revisa que:
+	1. El algoritmo use el torneo configurado, de 3 individuos, y no uno creado con el
+	   constructor por defecto.
+	2. Se ejecuten todas las generaciones y se llegue cerca del mnimo, -1.92821 en x=4.34233.
+	3. Un algoritmo declarado con DECLARAR_ALGORITMO y los mismos operadores, invocados
+	   con el mecanismo virtual, llegue al mismo mnimo.
+
+  Retorna 0 si todas las pruebas son correctas.
+  La salida debe terminar con:
+			Pruebas correctas
+*/
+
+#include "UNGenetico.h"
+
+//!Valor del mnimo de la funcin
+#define MINIMO -1.92821
+
+
+DECLARAR_ALGORITMO_ESTATICO(MiAGEstatico, OperadorProbabilidadLineal, OperadorSeleccionTorneo,
+							OperadorParejasAdyacentes, OperadorReproduccionMejorPadreMejorHijo)
+	void inicializarParametros();
+	void definirOperadores();
+	int getTamanoTorneo();
+	double x;
+FIN_DECLARAR_ALGORITMO
+
+
+DECLARAR_ALGORITMO(MiAGDinamico)
+	void inicializarParametros();
+	void definirOperadores();
+	double x;
+FIN_DECLARAR_ALGORITMO
+
+
+double funcion(double x)
+{
+	return sin(x) + sin(4*x);
+}
+
+void MiAGEstatico::inicializarParametros()
+{
+	m_TamanoPoblacion=50;
+	m_GeneracionMaxima=100;
+}
+
+void MiAGEstatico::definirOperadores()
+{
+	DEFINIR_OPERADOR_SELECCION(OperadorSeleccionTorneo(3))
+}
+
+void MiAGEstatico::codificacion(Individuo* pInd, int estado)
+{
+	ADICIONAR_GENREAL(pInd, 0, x, 0, 10, 0);
+}
+
+double MiAGEstatico::objetivo()
+{
+	return funcion(x);
+}
+
+//!Retorna el nmero de individuos de cada torneo del operador de seleccin, o 0 si no es un torneo
+int MiAGEstatico::getTamanoTorneo()
+{
+	OperadorSeleccionTorneo *pTorneo = dynamic_cast<OperadorSeleccionTorneo*>(m_pOpSeleccion);
+	return pTorneo ? pTorneo->m_Tamano : 0;
+}
+
+void MiAGDinamico::inicializarParametros()
+{
+	m_TamanoPoblacion=50;
+	m_GeneracionMaxima=100;
+}
+
+void MiAGDinamico::definirOperadores()
+{
+	DEFINIR_OPERADOR_PROBABILIDAD(OperadorProbabilidadLineal)
+	DEFINIR_OPERADOR_SELECCION(OperadorSeleccionTorneo(3))
+	DEFINIR_OPERADOR_PAREJAS(OperadorParejasAdyacentes)
+	DEFINIR_OPERADOR_REPRODUCCION(OperadorReproduccionMejorPadreMejorHijo)
+}
+
+void MiAGDinamico::codificacion(Individuo* pInd, int estado)
+{
+	ADICIONAR_GENREAL(pInd, 0, x, 0, 10, 0);
+}
+
+double MiAGDinamico::objetivo()
+{
+	return funcion(x);
+}
+
+
+/*PRUEBAS*/
+
+int main()
+{
+	cout << "EJEMPLO Y PRUEBA DE AlgoritmoGeneticoT\n\n";
+
+	MiAGEstatico Estatico;
+	Estatico.optimizar();
+	double mejorEstatico = Estatico.m_pMejorEnLaHistoria->objetivo(true);	//con true se decodifica x
+	int tamanoTorneo = Estatico.getTamanoTorneo();
+	cout << "Esttico: F(Xmin)= " << mejorEstatico << " Xmin= " << Estatico.x
+		<< ". Generaciones: " << Estatico.m_Generacion << ". Individuos por torneo: " << tamanoTorneo << "\n";
+
+	MiAGDinamico Dinamico;
+	Dinamico.optimizar();
+	double mejorDinamico = Dinamico.m_pMejorEnLaHistoria->objetivo(true);
+	cout << "Dinmico: F(Xmin)= " << mejorDinamico << " Xmin= " << Dinamico.x << "\n";
+
+	bool correctas = tamanoTorneo == 3 && Estatico.m_Generacion >= Estatico.m_GeneracionMaxima &&
+		fabs(mejorEstatico - funcion(Estatico.x)) < 1e-12 && fabs(mejorEstatico - MINIMO) < 1e-3 &&
+		fabs(mejorDinamico - MINIMO) < 1e-3;
+
+	cout << "\n" << (correctas ? "Pruebas correctas" : "Pruebas con ERRORES") << "\n";
+	return correctas ? 0 : 1;
+}
@@ -0,0 +1,177 @@
+/*EJEMPLO Y PRUEBA DE LA EVALUACIN PEREZOSA Y ACOTADA (UNGenetico 2.0).
+
+  Minimiza f(v)=suma((v[i]-1)^2), con DIMENSION genes reales en [-4,4]. La funcin
+  objetivo es una suma de trminos positivos, por lo que el algoritmo sobrecarga
+  objetivoAcotado() para terminar la suma en cuanto supera la cota, y activa
+  m_IndicadorObjetivoAcotado. As, un individuo que pierde una comparacin puede
+  quedar solo con una cota de su funcin objetivo (Ver Individuo::objetivoAcotado()).
+  Para forzar el caso, en cada generacin OperadorAdaptacionCota deja a un individuo
+  con v[0]=1 y los dems valores en 4 con solo una cota: su suma se interrumpe despus
+  del primer trmino, por lo que la cota es 0, mejor que el mnimo, aunque su valor
+  exacto es (DIMENSION-1)*9.
+
+  El algoritmo se ejecuta sin y con m_IndicadorEvaluacionPerezosa, contando las
+  evaluaciones de la funcin objetivo. Despus de cada generacin se revisa que:
+	1. El mejor individuo de la historia y el de la generacin no tengan como funcin
+	   objetivo solo una cota, y que su valor sea el que se calcula de nuevo a partir
+	   de sus genes. En particular, el individuo con la cota 0 nunca debe ser el mejor.
+  Al final de cada ejecucin se revisa que:
+	2. El mejor individuo se haya acercado al mnimo, con F(mejor)<2. La seleccin por
+	   torneo binario de la evaluacin perezosa converge ms despacio que la seleccin
+	   por defecto, por lo que no se le exige ms.
+  Y al comparar las dos ejecuciones:
+	3. Con evaluacin perezosa se hayan hecho menos evaluaciones.
+	4. Con evaluacin perezosa la cota siga en la poblacin al terminar cada generacin,
+	   pues las medidas no evalan a los individuos que no se han evaluado; sin ella, las
+	   medidas la remplazan por el valor exacto.
+
+  Retorna 0 si todas las pruebas son correctas.
+  La salida debe terminar con:
+			Pruebas correctas
+*/
+
+#include "UNGenetico.h"
+
+//!Nmero de genes
+#define DIMENSION 10
+
+//!Indica si se usa la evaluacin perezosa en la ejecucin actual
+bool g_Perezosa = false;
+//!Nmero de evaluaciones de la funcin objetivo, exactas o acotadas
+long g_Evaluaciones = 0;
+
+
+DECLARAR_ALGORITMO(MiAG)
+	void inicializarParametros();
+	void definirOperadores();
+	double objetivoAcotado(double cota);
+	double v[DIMENSION];
+FIN_DECLARAR_ALGORITMO
+
+
+void MiAG::inicializarParametros()
+{
+	m_TamanoPoblacion=100;
+	m_GeneracionMaxima=300;
+	m_IndicadorEvaluacionPerezosa=g_Perezosa;
+	m_IndicadorObjetivoAcotado=true;
+}
+
+//!Deja a un individuo de la poblacin con una cota de su funcin objetivo mejor que el mnimo
+/*!Se ejecuta antes de que se actualicen las medidas de la generacin.*/
+class OperadorAdaptacionCota:public OperadorAdaptacion
+{
+public:
+	void adaptacion(AlgoritmoGenetico *pAG)
+	{
+		MiAG &AG = *(MiAG*)pAG;
+		Individuo &ind = AG.m_pPoblacionActual->getIndividuo(rand() % AG.m_pPoblacionActual->getTam());
+		AG.v[0] = 1.0;
+		for(int i=1; i<DIMENSION; i++)
+			AG.v[i] = 4.0;
+		AG.codificacion(&ind, ESTADO_CODIFICAR);
+		//el primer trmino, 0, ya supera la cota -1
+		ind.objetivoAcotado(-1.0);
+	}
+};
+
+void MiAG::definirOperadores()
+{
+	//el elitismo es el operador de adaptacin por defecto, que no se crea si se define otro
+	ADICIONAR_OPERADOR_ADAPTACION(OperadorAdaptacionElitismo)
+	ADICIONAR_OPERADOR_ADAPTACION(OperadorAdaptacionCota)
+}
+
+void MiAG::codificacion(Individuo* pInd, int estado)
+{
+	for(int i=0; i<DIMENSION; i++)
+		ADICIONAR_GENREAL(pInd, i, v[i], -4.0, 4.0, 3.0);
+}
+
+double funcion(const double *v)
+{
+	double suma = 0.0;
+	for(int i=0; i<DIMENSION; i++)
+		suma += (v[i]-1)*(v[i]-1);
+	return suma;
+}
+
+double MiAG::objetivo()
+{
+	g_Evaluaciones++;
+	return funcion(v);
+}
+
+double MiAG::objetivoAcotado(double cota)
+{
+	g_Evaluaciones++;
+	double suma = 0.0;
+	for(int i=0; i<DIMENSION; i++)
+	{
+		suma += (v[i]-1)*(v[i]-1);
+		if(suma > cota)
+			return suma;	//al minimizar, la suma parcial no es mejor que la cota ni que el valor exacto
+	}
+	return suma;
+}
+
+
+/*PRUEBAS*/
+
+//Revisa que el individuo tenga el valor exacto de su funcin objetivo, sin evaluarlo
+bool exacto(MiAG &AG, Individuo &ind)
+{
+	if(ind.objetivoEsCota() || !ind.objetivoActualizado())
+		return false;
+	AG.codificacion(&ind, ESTADO_DECODIFICAR);
+	return ind.objetivo() == funcion(AG.v);
+}
+
+//Ejecuta el algoritmo. Retorna el nmero de evaluaciones y, en conCotas, el nmero de generaciones con cotas en la poblacin
+bool probar(bool perezosa, long &evaluaciones, int &conCotas)
+{
+	g_Perezosa = perezosa;
+	g_Evaluaciones = 0;
+	conCotas = 0;
+	int errores = 0;
+
+	MiAG AG;
+	AG.iniciarOptimizacion();
+	do
+	{
+		AG.iterarOptimizacion();
+		//las revisiones no cuentan como evaluaciones
+		long antes = g_Evaluaciones;
+		if(!exacto(AG, *AG.m_pMejorEnLaHistoria) || !exacto(AG, *AG.m_pMejorEnEstaGeneracion))
+			errores++;
+		for(int i=0; i<AG.m_pPoblacionActual->getTam(); i++)
+			if(AG.m_pPoblacionActual->getIndividuoDirecto(i).objetivoEsCota())
+			{
+				conCotas++;
+				break;
+			}
+		g_Evaluaciones = antes;
+	}while(!AG.finalizar());
+	evaluaciones = g_Evaluaciones;
+
+	double mejor = AG.m_pMejorEnLaHistoria->objetivo();
+	cout << (perezosa ? "Con" : "Sin") << " evaluacin perezosa: F(mejor)= " << mejor
+		<< ". Evaluaciones: " << evaluaciones << ". Generaciones con cotas en la poblacin: " << conCotas
+		<< ". Generaciones con un mejor individuo que no es exacto: " << errores << "\n";
+	return errores == 0 && mejor < 2.0;
+}
+
+int main()
+{
+	cout << "EJEMPLO Y PRUEBA DE LA EVALUACIN PEREZOSA Y ACOTADA\n\n";
+
+	long evaluacionesCompletas, evaluacionesPerezosas;
+	int cotasCompletas, cotasPerezosas;
+	bool correctas = probar(false, evaluacionesCompletas, cotasCompletas);
+	correctas = probar(true, evaluacionesPerezosas, cotasPerezosas) && correctas;
+	correctas = correctas && evaluacionesPerezosas < evaluacionesCompletas &&
+		cotasCompletas == 0 && cotasPerezosas > 0;
+
+	cout << "\n" << (correctas ? "Pruebas correctas" : "Pruebas con ERRORES") << "\n";
+	return correctas ? 0 : 1;
+}
@@ -0,0 +1,194 @@
+/*EJEMPLO Y PRUEBA DE EvaluadorProcesos (UNGenetico 2.0).
+
+  El mismo programa hace de simulador externo cuando se ejecuta con el argumento
+  "simulador": lee lneas "x y" y responde con f(x,y)=(x-1)^2+(y+2)^2. Si adems
+  recibe el argumento "fallas", con x>3.5 no responde nunca (simulador colgado) y con
+  x<-3.5 termina sin responder (simulador que se cae).
+
+  Sin argumentos, primero prueba el evaluador directamente:
+	1. Respuestas normales de varios procesos con lotes.
+	2. Un proceso colgado que excede el tiempo mximo: el individuo recibe el valor
+	   de fallo y los dems individuos de su lote se evalan en el proceso relanzado.
+	3. Un proceso que se cae: igual que en 2, sin esperar el tiempo mximo.
+  Luego minimiza f con AlgoritmoGeneticoAsincrono en [-4,4]x[-4,4], evaluando con el
+  simulador.
+
+  Solo funciona en sistemas POSIX. Retorna 0 si todas las pruebas son correctas.
+  La salida debe terminar con:
+			Pruebas correctas
+*/
+
+#include "UNGenetico.h"
+
+#if defined(UN_PROCESOS)
+
+//!Valor que el evaluador asigna a los individuos cuya evaluacin falla
+#define VALOR_FALLO 1e6
+//!Tiempo mximo de evaluacin de un individuo en las pruebas, en segundos
+#define TIEMPO_MAXIMO 0.5
+
+//!Comando que lanza este mismo programa como simulador
+char g_Comando[1000];
+//!Comando que lanza este mismo programa como simulador que falla
+char g_ComandoFallas[1000];
+
+
+DECLARAR_ALGORITMO_ASINCRONO(MiAG)
+	void inicializarParametros();
+	void definirOperadores();
+	double x, y;
+FIN_DECLARAR_ALGORITMO
+
+
+void MiAG::inicializarParametros()
+{
+	m_TamanoPoblacion=30;
+	m_GeneracionMaxima=300;
+}
+
+void MiAG::definirOperadores()
+{
+	DEFINIR_EVALUADOR(EvaluadorProcesos(g_Comando, VALOR_FALLO, 2, 2, 5.0))
+}
+
+void MiAG::codificacion(Individuo* pInd, int estado)
+{
+	ADICIONAR_GENREAL(pInd, 0, x, -4.0, 4.0, 0.0);
+	ADICIONAR_GENREAL(pInd, 1, y, -4.0, 4.0, 0.0);
+}
+
+//La funcin objetivo se calcula en el simulador
+double MiAG::objetivo()
+{
+	return VALOR_FALLO;
+}
+
+
+/*SIMULADOR*/
+
+double funcion(double x, double y)
+{
+	return (x-1)*(x-1) + (y+2)*(y+2);
+}
+
+int simulador(bool fallas)
+{
+	char linea[1000];
+	while(fgets(linea, sizeof(linea), stdin))
+	{
+		double x=0.0, y=0.0;
+		sscanf(linea, "%lf %lf", &x, &y);
+		if(fallas && x > 3.5)
+			for(;;)
+				sleep(1);
+		if(fallas && x < -3.5)
+			_exit(1);
+		printf("%.17g\n", funcion(x, y));
+		fflush(stdout);
+	}
+	return 0;
+}
+
+
+/*PRUEBAS*/
+
+double ahora()
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (double)t.tv_sec + 1e-9*(double)t.tv_nsec;
+}
+
+/*Enva al evaluador un individuo por cada pareja (x,y), en orden, y los recibe todos.
+Cada individuo debe recibir f(x,y), o VALOR_FALLO si el simulador falla con l, y la
+prueba debe tardar al menos tiempoMinimo segundos.*/
+bool probar(const char *nombre, MiAG &AG, Evaluador &Ev, const double valores[][2], int num, double tiempoMinimo)
+{
+	Individuo *pInd[20];
+	int i;
+	for(i=0; i<num; i++)
+	{
+		pInd[i] = new Individuo(*AG.m_pModelo);
+		AG.x = valores[i][0];
+		AG.y = valores[i][1];
+		AG.codificacion(pInd[i], ESTADO_CODIFICAR);
+	}
+
+	double inicio = ahora();
+	for(i=0; i<num; i++)
+		Ev.enviar(pInd[i]);
+	int recibidos = 0;
+	while(Ev.recibir(true))
+		recibidos++;
+	double duracion = ahora() - inicio;
+
+	bool correcta = recibidos==num && duracion>=tiempoMinimo;
+	for(i=0; i<num; i++)
+	{
+		double x = valores[i][0], y = valores[i][1];
+		double esperado = (x>3.5 || x<-3.5) ? VALOR_FALLO : funcion(x, y);
+		correcta = correcta && pInd[i]->objetivoActualizado() && fabs(pInd[i]->objetivo() - esperado) < 1e-9;
+		delete pInd[i];
+	}
+	cout << nombre << ": " << recibidos << " de " << num << " individuos en " << duracion << " s. "
+		<< (correcta ? "Correcta" : "ERROR") << "\n";
+	return correcta;
+}
+
+int main(int argc, char *argv[])
+{
+	if(argc>1 && strcmp(argv[1], "simulador")==0)
+		return simulador(argc>2 && strcmp(argv[2], "fallas")==0);
+	sprintf(g_Comando, "exec \"%s\" simulador", argv[0]);
+	sprintf(g_ComandoFallas, "exec \"%s\" simulador fallas", argv[0]);
+
+	cout << "EJEMPLO Y PRUEBA DE EvaluadorProcesos\n\n";
+	cout.flush();
+
+	bool correctas = true;
+	MiAG AG;
+	AG.iniciarOptimizacion();
+	{
+		const double normales[][2] = { {0,0}, {1,-2}, {2,1}, {-3,3}, {3.5,-4}, {0.5,0.25}, {-1,-1} };
+		EvaluadorProcesos Ev(g_ComandoFallas, VALOR_FALLO, 2, 3, TIEMPO_MAXIMO);
+		Ev.iniciar(&AG);
+		correctas = probar("Respuestas normales", AG, Ev, normales, 7, 0.0) && correctas;
+		Ev.finalizar();
+	}
+	{
+		//el primero del lote se cuelga; el segundo se reenva al proceso relanzado
+		const double colgado[][2] = { {3.75,0}, {1,1}, {2,2}, {3,3} };
+		EvaluadorProcesos Ev(g_ComandoFallas, VALOR_FALLO, 1, 2, TIEMPO_MAXIMO);
+		Ev.iniciar(&AG);
+		correctas = probar("Proceso colgado", AG, Ev, colgado, 4, TIEMPO_MAXIMO) && correctas;
+		Ev.finalizar();
+	}
+	{
+		//el proceso se cae con el segundo; el tercero se reenva al proceso relanzado
+		const double caido[][2] = { {1,1}, {-3.75,0}, {2,2}, {3,3}, {-3.75,1}, {0,0} };
+		EvaluadorProcesos Ev(g_ComandoFallas, VALOR_FALLO, 1, 3, 30.0);
+		Ev.iniciar(&AG);
+		correctas = probar("Proceso caido", AG, Ev, caido, 6, 0.0) && correctas;
+		Ev.finalizar();
+	}
+
+	cout << "\nOptimizando...\n";
+	cout.flush();
+	AG.optimizar();
+	double mejor = AG.m_pMejorEnLaHistoria->objetivo(true);	//con true se decodifican x y y
+	cout << "F(Xmin)= " << mejor << " Xmin= " << AG.x << " Ymin= " << AG.y << "\n";
+	correctas = correctas && fabs(mejor - funcion(AG.x, AG.y)) < 1e-9;
+
+	cout << "\n" << (correctas ? "Pruebas correctas" : "Pruebas con ERRORES") << "\n";
+	return correctas ? 0 : 1;
+}
+
+#else
+
+int main()
+{
+	cout << "EvaluadorProcesos solo esta disponible en sistemas POSIX\n";
+	return 0;
+}
+
+#endif
@@ -0,0 +1,247 @@
+/*EJEMPLO Y PRUEBA DE EvaluadorRed (UNGenetico 2.0).
+
+  El programa lanza sus propios trabajadores, que se conectan al evaluador en la
+  direccin 127.0.0.1 e invocan trabajarRed(). Los trabajadores calculan
+  f(x,y)=(x-1)^2+(y+2)^2; en el proceso del algoritmo la funcin objetivo retorna
+  VALOR_LOCAL, de modo que se nota si algn individuo no se evalu en un trabajador.
+
+  Primero prueba el evaluador directamente, con lotes de 3 individuos y tres
+  trabajadores:
+	1. Un trabajador normal.
+	2. Un trabajador que muere en medio de un lote: el evaluador debe devolver a la
+	   cola los individuos que tena en curso.
+	3. Un trabajador impostor que responde con un nmero de individuo equivocado: el
+	   evaluador debe desconectarlo y devolver a la cola sus individuos.
+  Todos los individuos deben recibir f(x,y) del trabajador normal y al final solo
+  debe quedar l conectado. Si el evaluador pierde algn individuo, la prueba se
+  queda esperando y termina con error al cumplirse TIEMPO_MAXIMO.
+  Luego minimiza f con AlgoritmoGeneticoAsincrono en [-4,4]x[-4,4], con dos
+  trabajadores.
+
+  Solo funciona en sistemas POSIX. Retorna 0 si todas las pruebas son correctas.
+  La salida debe terminar con:
+			Pruebas correctas
+*/
+
+#include "UNGenetico.h"
+
+#if defined(UN_PROCESOS)
+
+//!Valor de la funcin objetivo calculada en el proceso del algoritmo
+#define VALOR_LOCAL -1.0
+//!Nmero de individuos que evala el trabajador que muere antes de morir
+#define EVALUADOS_ANTES_DE_MORIR 1
+//!Tiempo mximo de las pruebas, en segundos
+#define TIEMPO_MAXIMO 60
+
+//!Direccin del evaluador
+char g_Direccion[100];
+//!Indica que el proceso es un trabajador
+bool g_Trabajador = false;
+//!Si es positivo, el trabajador muere al evaluar este nmero de individuos
+int g_MorirEn = 0;
+//!Nmero de individuos evaluados en el trabajador
+int g_Evaluados = 0;
+
+
+DECLARAR_ALGORITMO_ASINCRONO(MiAG)
+	void inicializarParametros();
+	void definirOperadores();
+	double x, y;
+FIN_DECLARAR_ALGORITMO
+
+
+void MiAG::inicializarParametros()
+{
+	m_TamanoPoblacion=30;
+	m_GeneracionMaxima=300;
+}
+
+void MiAG::definirOperadores()
+{
+	DEFINIR_EVALUADOR(EvaluadorRed(g_Direccion, 2, 2))
+}
+
+void MiAG::codificacion(Individuo* pInd, int estado)
+{
+	ADICIONAR_GENREAL(pInd, 0, x, -4.0, 4.0, 0.0);
+	ADICIONAR_GENREAL(pInd, 1, y, -4.0, 4.0, 0.0);
+}
+
+double funcion(double x, double y)
+{
+	return (x-1)*(x-1) + (y+2)*(y+2);
+}
+
+//La funcin objetivo solo se calcula en los trabajadores
+double MiAG::objetivo()
+{
+	if(!g_Trabajador)
+		return VALOR_LOCAL;
+	if(g_MorirEn > 0 && ++g_Evaluados == g_MorirEn+1)
+		_exit(1);
+	return funcion(x, y);
+}
+
+
+/*TRABAJADORES*/
+
+//Lanza un trabajador que muere al evaluar el individuo siguiente a los primeros morirEn
+pid_t lanzarTrabajador(int morirEn)
+{
+	pid_t pid = fork();
+	if(pid == 0)
+	{
+		g_Trabajador = true;
+		g_MorirEn = morirEn;
+		MiAG AG;
+		trabajarRed(&AG, g_Direccion, 20);
+		_exit(0);
+	}
+	return pid;
+}
+
+//Lanza un trabajador que responde al primer individuo con un nmero equivocado
+pid_t lanzarImpostor(int puerto)
+{
+	pid_t pid = fork();
+	if(pid == 0)
+	{
+		struct sockaddr_in dir;
+		memset(&dir, 0, sizeof(dir));
+		dir.sin_family = AF_INET;
+		dir.sin_port = htons(puerto);
+		dir.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		int fd = socket(AF_INET, SOCK_STREAM, 0);
+		for(int i=0; i<200 && connect(fd, (struct sockaddr*)&dir, sizeof(dir)) != 0; i++)
+		{
+			close(fd);
+			usleep(100000);
+			fd = socket(AF_INET, SOCK_STREAM, 0);
+		}
+
+		//lee el primer mensaje y responde con el nmero de individuo siguiente
+		CabeceraRed cabecera;
+		char cuerpo[1000];
+		if(read(fd, &cabecera, sizeof(cabecera)) == sizeof(cabecera))
+		{
+			int tam = cabecera.numGenes*sizeof(int) + cabecera.numValores*sizeof(double);
+			int leidos = 0, n = 1;
+			while(leidos < tam && n > 0)
+			{
+				n = (int)read(fd, cuerpo, tam-leidos < (int)sizeof(cuerpo) ? tam-leidos : (int)sizeof(cuerpo));
+				leidos += n;
+			}
+			char respuesta[sizeof(CabeceraRed)+sizeof(double)];
+			CabeceraRed resultado = { MENSAJE_RESULTADO, cabecera.id+1, 0, 1 };
+			double valor = 0.0;
+			memcpy(respuesta, &resultado, sizeof(resultado));
+			memcpy(respuesta+sizeof(resultado), &valor, sizeof(valor));
+			write(fd, respuesta, sizeof(respuesta));
+		}
+
+		//espera a que el evaluador cierre la conexin
+		while(read(fd, cuerpo, sizeof(cuerpo)) > 0)
+			;
+		_exit(0);
+	}
+	return pid;
+}
+
+
+/*PRUEBAS*/
+
+void tiempoAgotado(int)
+{
+	const char mensaje[] = "\nERROR: se agot el tiempo de las pruebas\n";
+	write(1, mensaje, sizeof(mensaje)-1);
+	_exit(1);
+}
+
+//Evala en los trabajadores un individuo por cada pareja (x,y) y revisa los valores recibidos
+bool probar(MiAG &AG, const Individuo &modelo, EvaluadorRed &Ev, const double valores[][2], int num)
+{
+	Individuo *pInd[20];
+	int i;
+	for(i=0; i<num; i++)
+	{
+		pInd[i] = new Individuo(modelo);
+		AG.x = valores[i][0];
+		AG.y = valores[i][1];
+		AG.codificacion(pInd[i], ESTADO_CODIFICAR);
+	}
+
+	for(i=0; i<num; i++)
+		Ev.enviar(pInd[i]);
+	int recibidos = 0;
+	while(Ev.recibir(true))
+		recibidos++;
+
+	int correctos = 0;
+	for(i=0; i<num; i++)
+	{
+		if(pInd[i]->objetivoActualizado() && fabs(pInd[i]->objetivo() - funcion(valores[i][0], valores[i][1])) < 1e-9)
+			correctos++;
+		delete pInd[i];
+	}
+	cout << "Recibidos: " << recibidos << " de " << num << ". Correctos: " << correctos
+		<< ". Trabajadores conectados: " << Ev.getNumConectados() << "\n";
+	return recibidos==num && correctos==num && Ev.getNumConectados()==1;
+}
+
+int main()
+{
+	int puerto = 20000 + getpid()%20000;
+	sprintf(g_Direccion, "127.0.0.1:%d", puerto);
+
+	cout << "EJEMPLO Y PRUEBA DE EvaluadorRed\n\n";
+	cout.flush();
+	signal(SIGALRM, tiempoAgotado);
+	alarm(TIEMPO_MAXIMO);
+
+	bool correctas = true;
+	MiAG AG;
+	{
+		//el modelo se crea como en trabajarRed(), sin iniciar el algoritmo
+		Individuo modelo(&AG);
+		AG.codificacion(&modelo, ESTADO_CREAR);
+		const double valores[][2] = { {0,0}, {1,-2}, {2,1}, {-3,3}, {3.5,-4}, {0.5,0.25},
+			{-1,-1}, {4,4}, {-4,-4}, {1.5,-1.5}, {2.5,0.5}, {-2,2} };
+		lanzarTrabajador(0);
+		lanzarTrabajador(EVALUADOS_ANTES_DE_MORIR);
+		lanzarImpostor(puerto);
+		EvaluadorRed Ev(g_Direccion, 3, 3);
+		Ev.iniciar(&AG);
+		bool correcta = probar(AG, modelo, Ev, valores, 12);
+		cout << "Trabajador que muere e impostor: " << (correcta ? "Correcta" : "ERROR") << "\n";
+		correctas = correctas && correcta;
+		Ev.finalizar();
+	}
+	while(wait(NULL) > 0)
+		;
+
+	cout << "\nOptimizando...\n";
+	cout.flush();
+	lanzarTrabajador(0);
+	lanzarTrabajador(0);
+	AG.optimizar();
+	AG.m_pEvaluador->finalizar();
+	while(wait(NULL) > 0)
+		;
+	double mejor = AG.m_pMejorEnLaHistoria->objetivo(true);	//con true se decodifican x y y
+	cout << "F(Xmin)= " << mejor << " Xmin= " << AG.x << " Ymin= " << AG.y << "\n";
+	correctas = correctas && fabs(mejor - funcion(AG.x, AG.y)) < 1e-9 && mejor < 0.01;
+
+	cout << "\n" << (correctas ? "Pruebas correctas" : "Pruebas con ERRORES") << "\n";
+	return correctas ? 0 : 1;
+}
+
+#else
+
+int main()
+{
+	cout << "EvaluadorRed solo esta disponible en sistemas POSIX\n";
+	return 0;
+}
+
+#endif
@@ -66,7 +66,7 @@ DECLARAR_ALGORITMO(AGFunciones)
 	void GuardarValores(Individuo& Ind, int generacion);
 	void GuardarIteraciones(Individuo& Ind);
 
-	ArregloReal x;
+	VistaArregloReal x;
 	int Dimension,Emax,Emin, func;
 	int  aRAS, dGRI, aACK, mMIC;
 	FILE *pValores;
@@ -0,0 +1,157 @@
+/*EJEMPLO Y PRUEBA DE GenomaFijo (UNGenetico 2.0).
+
+  Resuelve el mismo problema de HibridoConsola, pero con las tres variables en un solo
+  gen GenomaFijo<GenArregloBool, GenEntero, GenReal>, que se adiciona al individuo con
+  ADICIONAR_GENOMAFIJO. Maximiza
+		f(x,y,z)=suma(x[i]) + 4y + sin(15z)exp(-z), con 100 menos si y es par,
+  con x un arreglo de 1 a 10 bits, y entero en [-10,40] y z real en [0,6].
+  Cada gen se muta y se cruza con los mismos operadores de HibridoConsola, reunidos en
+  OperadorMutacionFijo y OperadorCruceFijo. Se revisa que:
+	1. GenomaFijo::codificar() y GenomaFijo::decodificar() conserven los valores, y que
+	   restrinjan a sus lmites los que estn por fuera de ellos.
+	2. Los valores decodificados de cada individuo de la poblacin estn dentro de sus
+	   lmites y su funcin objetivo corresponda a ellos.
+	3. El mejor individuo de la historia tenga 10 bits en 1 y y=39, el mximo impar.
+
+  Solo funciona al compilar con C++11 o posterior.
+  Retorna 0 si todas las pruebas son correctas.
+  La salida debe terminar con:
+			Pruebas correctas
+*/
+
+#include "UNGenetico.h"
+
+#if defined(UN_CPP11)
+
+//!Genoma con las tres variables del problema
+typedef GenomaFijo<GenArregloBool, GenEntero, GenReal> MiGenoma;
+//!Operador de mutacin del genoma, con un operador por cada gen
+typedef OperadorMutacionFijo<MiGenoma, OperadorMutacionArregloBool, OperadorMutacionEnteroNoUniforme, OperadorMutacionRealMuhlenbein> MiMutacion;
+//!Operador de cruce del genoma, con un operador por cada gen
+typedef OperadorCruceFijo<MiGenoma, OperadorCruceArregloBool, OperadorCruceEnteroHeuristico, OperadorCruceRealBLX> MiCruce;
+
+
+DECLARAR_ALGORITMO(MiAG)
+	void inicializarParametros();
+	void definirOperadores();
+	ArregloBool x;
+	long y;
+	double z;
+FIN_DECLARAR_ALGORITMO
+
+
+void MiAG::inicializarParametros()
+{
+	m_IndicadorMaximizar=true;
+	m_TamanoPoblacion=200;
+	m_GeneracionMaxima=200;
+}
+
+void MiAG::definirOperadores()
+{
+	ADICIONAR_OPERADOR_MUTACION(MiMutacion(OperadorMutacionArregloBool(), OperadorMutacionEnteroNoUniforme(this), OperadorMutacionRealMuhlenbein()))
+	ADICIONAR_OPERADOR_CRUCE(MiCruce(OperadorCruceArregloBool(), OperadorCruceEnteroHeuristico(), OperadorCruceRealBLX()))
+}
+
+void MiAG::codificacion(Individuo* pInd, int estado)
+{
+	ADICIONAR_GENOMAFIJO(pInd, 0, MiGenoma, (GenArregloBool(1, 10, false, true), GenEntero(-10, 40, 0), GenReal(0.0, 6.0, 0.0)), (x, y, z))
+}
+
+double funcion(const ArregloBool &x, long y, double z)
+{
+	double FO = 0.0;
+	for(int i=0; i<x.getSize(); i++)
+		FO += x[i];
+	FO += 4*y + sin(15*z)*exp(-z);
+	if(y%2==0)
+		FO -= 100;
+	return FO;
+}
+
+double MiAG::objetivo()
+{
+	return funcion(x, y, z);
+}
+
+
+/*PRUEBAS*/
+
+bool probarCodificacion()
+{
+	MiGenoma genoma(GenArregloBool(1, 10, false, true), GenEntero(-10, 40, 0), GenReal(0.0, 6.0, 0.0));
+	ArregloBool xOrigen, xDestino;
+	long yDestino;
+	double zDestino;
+	for(int i=0; i<4; i++)
+		xOrigen.Adicionar(new bool(i%2==0));
+	int correctas = 0;
+
+	genoma.codificar(xOrigen, 17L, 2.5);
+	genoma.decodificar(xDestino, yDestino, zDestino);
+	bool iguales = xDestino.getSize() == xOrigen.getSize() && yDestino == 17 && zDestino == 2.5;
+	for(int i=0; iguales && i<xOrigen.getSize(); i++)
+		iguales = xDestino[i] == xOrigen[i];
+	if(iguales)
+		correctas++;
+
+	//valores por fuera de los lmites
+	genoma.codificar(xOrigen, 100L, -3.0);
+	genoma.decodificar(xDestino, yDestino, zDestino);
+	if(yDestino == 40 && zDestino == 0.0)
+		correctas++;
+
+	cout << "Codificacin y decodificacin correctas: " << correctas << " de 2\n";
+	return correctas == 2;
+}
+
+bool probarPoblacion(MiAG &AG)
+{
+	int correctos = 0, tamPob = AG.m_pPoblacionActual->getTam();
+	for(int i=0; i<tamPob; i++)
+	{
+		Individuo &ind = AG.m_pPoblacionActual->getIndividuoDirecto(i);
+		double valor = ind.objetivo(true);	//con true se decodifican x, y y z
+		bool limites = AG.x.getSize() >= 1 && AG.x.getSize() <= 10 &&
+			AG.y >= -10 && AG.y <= 40 && AG.z >= 0.0 && AG.z <= 6.0;
+		if(limites && fabs(valor - funcion(AG.x, AG.y, AG.z)) < 1e-12)
+			correctos++;
+	}
+	cout << "Individuos con valores y funcin objetivo correctos: " << correctos << " de " << tamPob << "\n";
+	return correctos == tamPob;
+}
+
+int main()
+{
+	cout << "EJEMPLO Y PRUEBA DE GenomaFijo\n\n";
+
+	bool correctas = probarCodificacion();
+
+	MiAG AG;
+	AG.optimizar();
+	correctas = probarPoblacion(AG) && correctas;
+
+	double mejor = AG.m_pMejorEnLaHistoria->objetivo(true);
+	int unos = 0;
+	cout << "\nFuncion Objetivo:\t" << mejor << "\nx:\t";
+	for(int i=0; i<AG.x.getSize(); i++)
+	{
+		cout << AG.x[i];
+		unos += AG.x[i];
+	}
+	cout << "\ny:\t" << AG.y << "\nz:\t" << AG.z << "\n";
+	correctas = correctas && unos == 10 && AG.y == 39;
+
+	cout << "\n" << (correctas ? "Pruebas correctas" : "Pruebas con ERRORES") << "\n";
+	return correctas ? 0 : 1;
+}
+
+#else
+
+int main()
+{
+	cout << "GenomaFijo solo esta disponible al compilar con C++11 o posterior\n";
+	return 0;
+}
+
+#endif
@@ -0,0 +1,208 @@
+/*EJEMPLO Y PRUEBA DEL MODELO DE ISLAS EN MEMORIA COMPARTIDA (UNGenetico 2.0).
+
+  El programa crea un segmento MemoriaIslas y lanza NUM_ISLAS islas con
+  MemoriaIslas::lanzarProcesos(); el proceso original es la isla 0. Cada isla minimiza
+  f(x,y)=(x-1)^2+(y+2)^2 en [-4,4]x[-4,4] y cada 5 generaciones publica su mejor
+  individuo en su anillo del segmento, de donde lo lee la isla siguiente
+  (Ver OperadorAdaptacionMigracion).
+
+  Para comprobar que los migrantes llegan, solo la isla 0 puede encontrar el mnimo
+  por s misma: las dems penalizan con PENALIZACION los puntos con x<2, de modo que
+  sus propios individuos no bajan de f=1. Una isla distinta de la 0 solo puede tener
+  un mejor individuo con f<0.5 si le lleg, directamente o a travs de otras islas,
+  un migrante de la isla 0. Cada isla retorna 0 si su mejor individuo cumple esa condicin.
+
+  Despus, la isla 0 revisa las lecturas del anillo (Ver MemoriaIslas::leer()):
+	1. Una lectura vlida asigna los genes y la funcin objetivo publicados.
+	2. Una lectura de una ranura que se est escribiendo (secuencia impar) falla y no
+	   cambia el individuo destino.
+	3. Una lectura de una posicin ya sobrescrita por individuos ms recientes falla y
+	   no cambia el individuo destino.
+
+  Solo funciona en sistemas POSIX y al compilar con C++11 o posterior.
+  Retorna 0 si todas las pruebas son correctas.
+  La salida debe terminar con:
+			Pruebas correctas
+*/
+
+#include "UNGenetico.h"
+
+#if defined(UN_CPP11) && defined(UN_PROCESOS)
+
+//!Nmero de islas
+#define NUM_ISLAS 4
+//!Nmero de ranuras del anillo de cada isla
+#define NUM_RANURAS 4
+//!Penalizacin de los puntos con x<2 en las islas distintas de la 0
+#define PENALIZACION 100.0
+//!Tiempo mximo de las pruebas, en segundos
+#define TIEMPO_MAXIMO 60
+
+
+//!MemoriaIslas que permite a las pruebas marcar una ranura como si se estuviera escribiendo
+class MemoriaIslasPrueba:public MemoriaIslas
+{
+public:
+	//!Suma \a incremento a la secuencia de la ranura \a pos del anillo de la isla \a isla
+	void cambiarSecuencia(int isla, unsigned long pos, int incremento)
+	{
+		ranura(isla, pos)->secuencia.fetch_add(incremento);
+	}
+};
+
+//!Segmento compartido por las islas
+MemoriaIslasPrueba g_Memoria;
+//!Nmero de la isla que se ejecuta en el proceso
+int g_Isla = 0;
+
+
+DECLARAR_ALGORITMO(MiAG)
+	void inicializarParametros();
+	void definirOperadores();
+	double x, y;
+FIN_DECLARAR_ALGORITMO
+
+
+void MiAG::inicializarParametros()
+{
+	m_TamanoPoblacion=30;
+	m_GeneracionMaxima=400;
+}
+
+void MiAG::definirOperadores()
+{
+	ADICIONAR_OPERADOR_ADAPTACION(OperadorAdaptacionMigracion(&g_Memoria, g_Isla, 5, 1));
+}
+
+void MiAG::codificacion(Individuo* pInd, int estado)
+{
+	ADICIONAR_GENREAL(pInd, 0, x, -4.0, 4.0, 0.0);
+	ADICIONAR_GENREAL(pInd, 1, y, -4.0, 4.0, 0.0);
+}
+
+double MiAG::objetivo()
+{
+	usleep(20);
+	double f = (x-1)*(x-1) + (y+2)*(y+2);
+	if(g_Isla > 0 && x < 2.0)
+		f += PENALIZACION;
+	return f;
+}
+
+
+/*PRUEBAS*/
+
+void tiempoAgotado(int)
+{
+	const char mensaje[] = "\nERROR: se agot el tiempo de las pruebas\n";
+	write(1, mensaje, sizeof(mensaje)-1);
+	_exit(1);
+}
+
+//Asigna al individuo los valores x, y y la funcin objetivo f
+void asignar(Individuo &ind, double x, double y, double f)
+{
+	double valores[2] = {x, y};
+	int conteos[2] = {1, 1};
+	ind.setValores(valores, conteos);
+	ind.asignarObjetivo(f);
+}
+
+//Revisa que el individuo tenga los valores x, y y la funcin objetivo f
+bool igual(Individuo &ind, double x, double y, double f)
+{
+	double valores[2];
+	ind.getValores(valores);
+	return valores[0] == x && valores[1] == y && ind.objetivo() == f;
+}
+
+bool probarLecturas(const Individuo &modelo)
+{
+	Individuo publicado(modelo), destino(modelo);
+	int correctas = 0;
+
+	//1. lectura vlida
+	unsigned long pos = g_Memoria.getPublicados(0);
+	asignar(publicado, 1.5, -2.5, 0.5);
+	g_Memoria.publicar(0, publicado);
+	asignar(destino, 0.0, 0.0, 7.0);
+	if(g_Memoria.leer(0, pos, destino) && igual(destino, 1.5, -2.5, 0.5))
+		correctas++;
+	else
+		cout << "ERROR: la lectura vlida no asign el individuo publicado\n";
+
+	//2. ranura que se est escribiendo
+	asignar(destino, 0.0, 0.0, 7.0);
+	g_Memoria.cambiarSecuencia(0, pos, 1);
+	if(!g_Memoria.leer(0, pos, destino) && igual(destino, 0.0, 0.0, 7.0))
+		correctas++;
+	else
+		cout << "ERROR: la lectura de una ranura que se escribe cambi el individuo\n";
+	g_Memoria.cambiarSecuencia(0, pos, -1);
+
+	//3. ranura sobrescrita: se publican tantos individuos como ranuras tiene el anillo
+	for(int i=0; i<NUM_RANURAS; i++)
+	{
+		asignar(publicado, -1.0, 3.0, 25.0);
+		g_Memoria.publicar(0, publicado);
+	}
+	if(!g_Memoria.leer(0, pos, destino) && igual(destino, 0.0, 0.0, 7.0))
+		correctas++;
+	else
+		cout << "ERROR: la lectura de una ranura sobrescrita cambi el individuo\n";
+
+	cout << "Lecturas del anillo correctas: " << correctas << " de 3\n";
+	return correctas == 3;
+}
+
+int main()
+{
+	char nombre[100];
+	sprintf(nombre, "/ungenetico_islas_%d", (int)getpid());
+
+	cout << "EJEMPLO Y PRUEBA DEL MODELO DE ISLAS EN MEMORIA COMPARTIDA\n\n";
+	cout.flush();
+	signal(SIGALRM, tiempoAgotado);
+	alarm(TIEMPO_MAXIMO);
+
+	if(!g_Memoria.crear(nombre, NUM_ISLAS, NUM_RANURAS, 2, 2))
+	{
+		cout << "ERROR: no se pudo crear el segmento " << nombre << "\n";
+		return 1;
+	}
+	g_Isla = g_Memoria.lanzarProcesos();
+	if(g_Isla < 0)
+	{
+		g_Memoria.eliminar();
+		cout << "ERROR: no se pudieron lanzar las islas\n";
+		return 1;
+	}
+
+	MiAG AG;
+	AG.optimizar();
+	double mejor = AG.m_pMejorEnLaHistoria->objetivo();
+	cout << "Isla " << g_Isla << ": F(mejor)= " << mejor << "\n";
+	cout.flush();
+	if(g_Isla > 0)
+		_exit(mejor < 0.5 ? 0 : 1);
+
+	//cada isla retorna 0 si le llegaron los migrantes
+	int fallas = g_Memoria.esperarProcesos();
+	cout << "\nIslas con migrantes: " << NUM_ISLAS-1-fallas << " de " << NUM_ISLAS-1 << "\n";
+	bool correctas = probarLecturas(*AG.m_pModelo);
+	g_Memoria.eliminar();
+
+	correctas = correctas && fallas == 0 && mejor < 0.01;
+	cout << "\n" << (correctas ? "Pruebas correctas" : "Pruebas con ERRORES") << "\n";
+	return correctas ? 0 : 1;
+}
+
+#else
+
+int main()
+{
+	cout << "El modelo de islas en memoria compartida solo esta disponible en sistemas POSIX y con C++11\n";
+	return 0;
+}
+
+#endif
@@ -0,0 +1,158 @@
+/*EJEMPLO Y PRUEBA DEL MODELO DE ISLAS EN RED (UNGenetico 2.0).
+
+  El programa lanza NUM_ISLAS islas, cada una en su propio proceso, conectadas en
+  anillo en la direccin 127.0.0.1, y hace de coordinador (Ver CoordinadorIslas).
+  Cada isla minimiza f(x,y)=(x-1)^2+(y+2)^2 en [-4,4]x[-4,4] y cada 5 generaciones
+  enva su mejor individuo a la siguiente.
+
+  Para comprobar que los migrantes llegan, solo la isla 0 puede encontrar el mnimo
+  por s misma: las dems penalizan con PENALIZACION los puntos con x<2, de modo que
+  sus propios individuos no bajan de f=1. Una isla distinta de la 0 solo puede tener
+  un mejor individuo con f<0.5 si le lleg, directamente o a travs de otras islas,
+  un migrante de la isla 0 (los migrantes conservan la funcin objetivo con que
+  llegan). Cada isla retorna 0 si su mejor individuo cumple esa condicin.
+
+  El coordinador pide a las islas que terminen despus de TIEMPO_OPTIMIZACION
+  segundos y revisa que todas hayan terminado correctamente.
+
+  Solo funciona en sistemas POSIX. Retorna 0 si todas las pruebas son correctas.
+  La salida debe terminar con:
+			Pruebas correctas
+*/
+
+#include "UNGenetico.h"
+
+#if defined(UN_PROCESOS)
+
+//!Nmero de islas
+#define NUM_ISLAS 4
+//!Penalizacin de los puntos con x<2 en las islas distintas de la 0
+#define PENALIZACION 100.0
+//!Tiempo de la optimizacin, en segundos
+#define TIEMPO_OPTIMIZACION 2.0
+//!Tiempo mximo de las pruebas, en segundos
+#define TIEMPO_MAXIMO 60
+
+//!Nmero de la isla que se ejecuta en el proceso
+int g_Isla = -1;
+//!Isla que se ejecuta en el proceso
+IslaRed *g_pIsla = NULL;
+
+
+DECLARAR_ALGORITMO(MiAG)
+	void inicializarParametros();
+	void definirOperadores();
+	double x, y;
+FIN_DECLARAR_ALGORITMO
+
+
+void MiAG::inicializarParametros()
+{
+	m_TamanoPoblacion=30;
+	//las islas terminan cuando lo pide el coordinador
+	m_GeneracionMaxima=1000000;
+}
+
+void MiAG::definirOperadores()
+{
+	ADICIONAR_OPERADOR_ADAPTACION(OperadorAdaptacionMigracionRed(g_pIsla, 5, 1));
+	ADICIONAR_OPERADOR_FINALIZACION(OperadorFinalizacionIslas(g_pIsla));
+}
+
+void MiAG::codificacion(Individuo* pInd, int estado)
+{
+	ADICIONAR_GENREAL(pInd, 0, x, -4.0, 4.0, 0.0);
+	ADICIONAR_GENREAL(pInd, 1, y, -4.0, 4.0, 0.0);
+}
+
+double MiAG::objetivo()
+{
+	usleep(20);
+	double f = (x-1)*(x-1) + (y+2)*(y+2);
+	if(g_Isla > 0 && x < 2.0)
+		f += PENALIZACION;
+	return f;
+}
+
+
+/*ISLAS*/
+
+//Lanza una isla en su propio proceso. Retorna el identificador del proceso
+pid_t lanzarIsla(int isla, char direcciones[][100], const char *coordinador)
+{
+	pid_t pid = fork();
+	if(pid == 0)
+	{
+		g_Isla = isla;
+		IslaRed Isla(isla, direcciones[isla]);
+		Isla.adicionarDestino(direcciones[(isla+1)%NUM_ISLAS]);
+		Isla.setCoordinador(coordinador);
+		if(!Isla.iniciar())
+			_exit(2);
+		g_pIsla = &Isla;
+
+		MiAG AG;
+		AG.optimizar();
+		double mejor = AG.m_pMejorEnLaHistoria->objetivo();
+		Isla.terminar(AG.m_pMejorEnLaHistoria);
+		cout << "Isla " << isla << ": " << AG.m_Generacion << " generaciones. F(mejor)= " << mejor << "\n";
+		cout.flush();
+		_exit(mejor < 0.5 ? 0 : 1);
+	}
+	return pid;
+}
+
+
+/*PRUEBAS*/
+
+void tiempoAgotado(int)
+{
+	const char mensaje[] = "\nERROR: se agot el tiempo de las pruebas\n";
+	write(1, mensaje, sizeof(mensaje)-1);
+	_exit(1);
+}
+
+int main()
+{
+	int puerto = 20000 + getpid()%20000;
+	char coordinador[100];
+	char direcciones[NUM_ISLAS][100];
+	sprintf(coordinador, "127.0.0.1:%d", puerto);
+	for(int i=0; i<NUM_ISLAS; i++)
+		sprintf(direcciones[i], "127.0.0.1:%d", puerto+1+i);
+
+	cout << "EJEMPLO Y PRUEBA DEL MODELO DE ISLAS EN RED\n\n";
+	cout.flush();
+	signal(SIGALRM, tiempoAgotado);
+	alarm(TIEMPO_MAXIMO);
+
+	//las islas se conectan al coordinador en cuanto este abre su direccin
+	for(int i=0; i<NUM_ISLAS; i++)
+		lanzarIsla(i, direcciones, coordinador);
+	CoordinadorIslas Coordinador(coordinador);
+	int terminadas = Coordinador.ejecutar(NUM_ISLAS, TIEMPO_OPTIMIZACION);
+
+	//cada isla retorna 0 si le llegaron los migrantes
+	int correctas = 0, estado;
+	while(wait(&estado) > 0)
+		if(WIFEXITED(estado) && WEXITSTATUS(estado) == 0)
+			correctas++;
+
+	cout << "\nIslas terminadas: " << terminadas << " de " << NUM_ISLAS
+		<< ". Islas con migrantes: " << correctas << "\n";
+	cout << "F(mejor global)= " << Coordinador.getMejorObjetivo() << " en la isla " << Coordinador.getIslaMejor() << "\n";
+	bool todas = terminadas == NUM_ISLAS && correctas == NUM_ISLAS && Coordinador.getMejorObjetivo() < 0.01;
+
+	cout << "\n" << (todas ? "Pruebas correctas" : "Pruebas con ERRORES") << "\n";
+	return todas ? 0 : 1;
+}
+
+#else
+
+int main()
+{
+	cout << "El modelo de islas en red solo esta disponible en sistemas POSIX\n";
+	return 0;
+}
+
+#endif
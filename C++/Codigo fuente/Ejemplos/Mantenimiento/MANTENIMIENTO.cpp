@@ -10,6 +10,7 @@ void AGMantenimiento::inicializarParametros()
 {
 	m_TamanoPoblacion= GNumIndiv;
 	m_GeneracionMaxima= GNumGeneraciones;
+	m_IndicadorObjetivoAcotado = true;
 }
 
 
@@ -32,6 +33,13 @@ void AGMantenimiento::definirOperadores()
 
 //Funcion Objetivo
 double AGMantenimiento::objetivo()
+{
+	return objetivoAcotado(HUGE_VAL);
+}
+
+
+//Funcion Objetivo que termina en cuanto los castigos superan la cota, pues solo se suman valores positivos
+double AGMantenimiento::objetivoAcotado(double cota)
 {
 	int i, j;
 	double obj=0, prioridadi, prioridadj;
@@ -64,6 +72,11 @@ double AGMantenimiento::objetivo()
 		}
 		
 		CantidadMan[SemMantenimiento[i]]++;
+		if(obj>cota)
+		{
+			delete [] CantidadMan;
+			return obj;
+		}
 	}
 	int maxMant = 1 + (GNumMaq-1)/NP;
 	for(i=0; i<NP; i++)
@@ -23,6 +23,7 @@ int (*Codigos)[4];	//para cada m
 DECLARAR_ALGORITMO(AGMantenimiento)
 	void definirOperadores();
 	void inicializarParametros();
+	double objetivoAcotado(double cota);
 	void mostrar(Individuo& Ind);
 	void guardar(Individuo& Ind, FILE *pArch, int generacion);
 	void guardarProgramacion();
@@ -36,6 +36,7 @@ public:
 DECLARAR_ALGORITMO(ModeloThomas)
 	void inicializarParametros();
 	void definirOperadores();
+	double objetivoAcotado(double cota);
 
 	void mostrar(Individuo& Ind, int generacion);
 	void GuardarParametros(Individuo& Ind, int generacion);
@@ -51,6 +52,7 @@ void ModeloThomas::inicializarParametros()
 {
 	m_TamanoPoblacion = 300;
 	m_GeneracionMaxima = 1000;	
+	m_IndicadorObjetivoAcotado = true;
 }
 
 void ModeloThomas::definirOperadores()
@@ -81,9 +83,16 @@ void ModeloThomas::codificacion(Individuo* pInd, int estado)
 
 //Funcion Objetivo
 double ModeloThomas::objetivo()
+{
+	return objetivoAcotado(HUGE_VAL);
+}
+
+//Funcion Objetivo que termina en cuanto el error supera la cota, pues la suma de errores solo crece.
+//Los caudales calculados solo se copian en Qfinal si se calculan todos
+double ModeloThomas::objetivoAcotado(double cota)
 {
 	int i;
-	double *W,*F,*Y,*Ro,*Rg,*Qg,*Sw,*Sg;
+	double *W,*F,*Y,*Ro,*Rg,*Qg,*Sw,*Sg,*Q;
 	W= new double[n];
 	F= new double[n];
 	Y= new double[n];
@@ -92,7 +101,9 @@ double ModeloThomas::objetivo()
 	Qg= new double[n];
 	Sw= new double[n+1];
 	Sg= new double[n+1];
-	double FO;
+	Q= new double[n];
+	double FO=0;
+	double limite = cota<0 ? 0 : (cota*n)*(cota*n);
 	Sw[0]=swo;
 	Sg[0]=sgo;
 	for(i=0;i<n;i++)
@@ -105,8 +116,14 @@ double ModeloThomas::objetivo()
 		Rg[i]=c*(W[i]-Y[i]);
 		Sg[i+1]=(Rg[i]+Sg[i])/(d+1);
 		Qg[i]=d*Sg[i+1];
-		Qfinal[i]=Ro[i]+Qg[i];
+		Q[i]=Ro[i]+Qg[i];
+		FO+=pow((Qreal[i]-Q[i]),2);
+		if(FO>limite)
+			break;
 	}
+	if(i==n)
+		for(i=0;i<n;i++)
+			Qfinal[i]=Q[i];
 	delete [] W;
 	delete [] F;
 	delete [] Y;
@@ -115,11 +132,7 @@ double ModeloThomas::objetivo()
 	delete [] Qg;
 	delete [] Sw;
 	delete [] Sg;
-	FO=0;
-	for(i=0;i<n;i++)
-	{
-		FO+=pow((Qreal[i]-Qfinal[i]),2);		
-	}
+	delete [] Q;
 	FO=sqrt(FO)/n;
 	return(FO);	
 }
@@ -184,7 +197,9 @@ void ModeloThomas::GuardarCaudales(Individuo& Ind, int generacion)
 	}	
 	caudal=fopen("caudales.txt","at");
 	if(!caudal) return;
+	//se recalculan los caudales de Ind, pues Qfinal tiene los del ltimo individuo evaluado completo
 	codificacion(&Ind, ESTADO_DECODIFICAR);
+	objetivoAcotado(HUGE_VAL);
 	fprintf(caudal,"%i \t",generacion);
 	for(i=0;i<n;i++)
 	{
@@ -343,6 +358,9 @@ void MiVentana::OnAceptar(wxCommandEvent &event)
 	}while(!MiAg->finalizar());
 	MiAg->mostrar(*MiAg->m_pMejorEnEstaGeneracion,t);
 	MiAg->mostrarMedidas();
+	//se recalculan los caudales del mejor individuo
+	MiAg->codificacion(MiAg->m_pMejorEnEstaGeneracion, ESTADO_DECODIFICAR);
+	MiAg->objetivoAcotado(HUGE_VAL);
 	wxString Cad;
 	Cad << "\n\n\t\t\tQreal\t\tQfinal\n";
 	for(int i=0;i<n;i++)
@@ -0,0 +1,170 @@
+/*EJEMPLO Y PRUEBA DE GenVectorReal (UNGenetico 2.0).
+
+  Minimiza f(v)=suma((v[i]-1)^2), con un solo gen GenVectorReal de DIMENSION valores
+  en [-5,5] que se decodifica sin copias en una VistaArregloReal. Antes prueba el
+  operador de cruce por defecto, OperadorCruceVectorRealSBX:
+	1. Los dos hijos de una pareja comparten beta en cada dimensin, por lo que son
+	   simtricos respecto a la media de los padres: h1+h2 = Mejor+Peor.
+	2. OperadorCruce::cruzarLote() cruza NUM_PAREJAS parejas en las que los hijos son
+	   los mismos padres, como en OperadorReproduccionDosPadresDosHijos. Los hijos deben
+	   ser simtricos y conservar sus bloques de datos, pues el lote se cruza en genes
+	   temporales que se reutilizan.
+  Al final, el mejor individuo debe estar cerca del mnimo y su funcin objetivo debe
+  coincidir con la que se calcula de nuevo a partir de sus valores.
+
+  Retorna 0 si todas las pruebas son correctas.
+  La salida debe terminar con:
+			Pruebas correctas
+*/
+
+#include "UNGenetico.h"
+
+//!Nmero de valores del vector
+#define DIMENSION 10
+//!Nmero de parejas del lote
+#define NUM_PAREJAS 8
+
+
+DECLARAR_ALGORITMO(MiAG)
+	void inicializarParametros();
+	VistaArregloReal v;
+FIN_DECLARAR_ALGORITMO
+
+
+void MiAG::inicializarParametros()
+{
+	m_TamanoPoblacion=100;
+	m_GeneracionMaxima=300;
+}
+
+void MiAG::codificacion(Individuo* pInd, int estado)
+{
+	ADICIONAR_GENVECTORREAL(pInd, 0, v, DIMENSION, -5.0, 5.0, 3.0);
+}
+
+double funcion(const double *v)
+{
+	double suma = 0.0;
+	for(int i=0; i<DIMENSION; i++)
+		suma += (v[i]-1)*(v[i]-1);
+	return suma;
+}
+
+double MiAG::objetivo()
+{
+	return funcion(&v[0]);
+}
+
+
+/*PRUEBAS*/
+
+double azar(double Min, double Max)
+{
+	return Min + (Max - Min)*(double)rand()/(double)RAND_MAX;
+}
+
+//Revisa que los valores de los dos hijos sumen lo mismo que los de los padres
+bool simetricos(const GenVectorReal &Mejor, const GenVectorReal &Peor, const GenVectorReal &Hijo1, const GenVectorReal &Hijo2)
+{
+	for(int i=0; i<DIMENSION; i++)
+		if(fabs(Hijo1.getVal(i) + Hijo2.getVal(i) - Mejor.getVal(i) - Peor.getVal(i)) > 1e-9)
+			return false;
+	return true;
+}
+
+bool probarPareja()
+{
+	OperadorCruceVectorRealSBX SBX;
+	GenVectorReal Mejor(DIMENSION, -5.0, 5.0), Peor(DIMENSION, -5.0, 5.0);
+	GenVectorReal Hijo1(Mejor), Hijo2(Mejor);
+	int correctas = 0;
+	for(int k=0; k<100; k++)
+	{
+		//los padres estn lejos de los lmites, de modo que los hijos no se recortan
+		for(int i=0; i<DIMENSION; i++)
+		{
+			Mejor.setVal(i, azar(-1.0, 1.0));
+			Peor.setVal(i, azar(-1.0, 1.0));
+		}
+		SBX.cruzarParejaEn(Mejor, Peor, Hijo1, Hijo2);
+		if(simetricos(Mejor, Peor, Hijo1, Hijo2))
+			correctas++;
+	}
+	cout << "SBX: parejas con hijos simtricos: " << correctas << " de 100\n";
+	return correctas == 100;
+}
+
+bool probarLote(MiAG &AG)
+{
+	const Individuo &modelo = *AG.m_pModelo;
+	Individuo *ppMejores[NUM_PAREJAS], *ppPeores[NUM_PAREJAS];
+	GenVectorReal *pAntes[2*NUM_PAREJAS];
+	const double *pDatos[2*NUM_PAREJAS];
+	int pIndices[NUM_PAREJAS];
+	double pObjetivos[2*NUM_PAREJAS];
+	int i, k, posicion = 0;
+	for(k=0; k<2*NUM_PAREJAS; k++)
+	{
+		Individuo *pInd = new Individuo(modelo);
+		GenVectorReal &gen = (GenVectorReal &)pInd->getGenModificable(0);
+		for(i=0; i<DIMENSION; i++)
+			gen.setVal(i, azar(-1.0, 1.0));
+		pAntes[k] = new GenVectorReal(gen);
+		pDatos[k] = gen.getDatos();
+		pObjetivos[k] = 0.0;
+		if(k < NUM_PAREJAS)
+		{
+			ppMejores[k] = pInd;
+			pIndices[k] = k;
+		}
+		else
+			ppPeores[k-NUM_PAREJAS] = pInd;
+	}
+
+	//los hijos son los mismos padres
+	OperadorCruceVectorRealSBX SBX;
+	SBX.cruzarLote(ppMejores, ppPeores, ppMejores, ppPeores, pIndices, pObjetivos, NUM_PAREJAS, &posicion, 1);
+
+	int correctas = 0, conservados = 0;
+	for(k=0; k<NUM_PAREJAS; k++)
+	{
+		const GenVectorReal &Hijo1 = (const GenVectorReal &)ppMejores[k]->getGen(0);
+		const GenVectorReal &Hijo2 = (const GenVectorReal &)ppPeores[k]->getGen(0);
+		if(simetricos(*pAntes[k], *pAntes[NUM_PAREJAS+k], Hijo1, Hijo2))
+			correctas++;
+		if(Hijo1.getDatos() == pDatos[k] && Hijo2.getDatos() == pDatos[NUM_PAREJAS+k])
+			conservados++;
+	}
+	for(k=0; k<NUM_PAREJAS; k++)
+	{
+		delete ppMejores[k];
+		delete ppPeores[k];
+	}
+	for(k=0; k<2*NUM_PAREJAS; k++)
+		delete pAntes[k];
+
+	cout << "SBX en lote: parejas con hijos simtricos: " << correctas << " de " << NUM_PAREJAS
+		<< ". Parejas que conservan sus datos: " << conservados << "\n";
+	return correctas == NUM_PAREJAS && conservados == NUM_PAREJAS;
+}
+
+int main()
+{
+	cout << "EJEMPLO Y PRUEBA DE GenVectorReal\n\n";
+
+	bool correctas = probarPareja();
+
+	MiAG AG;
+	AG.optimizar();
+	correctas = probarLote(AG) && correctas;
+
+	double mejor = AG.m_pMejorEnLaHistoria->objetivo(true);	//con true se decodifica v
+	cout << "\nF(Xmin)= " << mejor << " Xmin=";
+	for(int i=0; i<AG.v.getSize(); i++)
+		cout << " " << AG.v[i];
+	cout << "\n";
+	correctas = correctas && AG.v.getSize() == DIMENSION && fabs(mejor - funcion(&AG.v[0])) < 1e-12 && mejor < 0.01;
+
+	cout << "\n" << (correctas ? "Pruebas correctas" : "Pruebas con ERRORES") << "\n";
+	return correctas ? 0 : 1;
+}
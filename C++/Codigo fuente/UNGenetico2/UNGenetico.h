@@ -4,11 +4,23 @@
 	#include "ventana.cpp"
 #endif
 
+#include "memoria.cpp"
+#include "afinidad.cpp"
 #include "genetico.cpp"
+#include "tareas.cpp"
 #include "genarreglo.h"
 #include "genbool.cpp"
 #include "genentero.cpp"
 #include "genreal.cpp"
+#include "genvector.cpp"
+#include "evaluador.cpp"
+#include "celular.cpp"
+#include "red.cpp"
+#include "islas.cpp"
+
+#if defined(UN_CPP11)
+	#include "genfijo.h"
+#endif
 
 
 
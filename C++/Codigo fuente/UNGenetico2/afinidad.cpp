@@ -0,0 +1,270 @@
+#include "afinidad.h"
+#include <stdlib.h>
+
+
+/************************************************************
+                TOPOLOGA NUMA (Implementacin)
+************************************************************/
+
+bool TopologiaNUMA::s_detectada = false;
+int TopologiaNUMA::s_numNodos = 1;
+int* TopologiaNUMA::s_pNucleos = NULL;
+int* TopologiaNUMA::s_pInicioNodo = NULL;
+
+
+#if defined(UN_AFINIDAD)
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+//Lee una lista de ncleos como "0-3,8,10-11" y marca en pMarcas los que contiene, si estn en pPermitidos
+static void __leerListaNucleos(const char *ruta, const cpu_set_t *pPermitidos, cpu_set_t *pMarcas)
+{
+	CPU_ZERO(pMarcas);
+	FILE *pArch = fopen(ruta, "r");
+	if(!pArch)
+		return;
+	int desde, hasta;
+	char separador;
+	while(fscanf(pArch, "%d", &desde) == 1)
+	{
+		hasta = desde;
+		separador = (char)fgetc(pArch);
+		if(separador == '-')
+		{
+			if(fscanf(pArch, "%d", &hasta) != 1)
+				break;
+			separador = (char)fgetc(pArch);
+		}
+		for(int i=desde; i<=hasta && i<CPU_SETSIZE; i++)
+			if(i >= 0 && CPU_ISSET(i, pPermitidos))
+				CPU_SET(i, pMarcas);
+		if(separador != ',')
+			break;
+	}
+	fclose(pArch);
+}
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/*!Si no hay informacin de nodos, todos los ncleos disponibles forman un solo nodo.*/
+void TopologiaNUMA::detectar()
+{
+	if(s_detectada)
+		return;
+	s_detectada = true;
+
+	cpu_set_t permitidos;
+	if(sched_getaffinity(0, sizeof(permitidos), &permitidos) != 0)
+		CPU_ZERO(&permitidos);
+	int total = CPU_COUNT(&permitidos);
+	s_pNucleos = new int[total>0 ? total : 1];
+
+	//como mximo hay tantos nodos con ncleos como ncleos
+	s_pInicioNodo = new int[total+2];
+	s_numNodos = 0;
+	int numNucleos = 0, faltantes = total;
+	char ruta[80];
+	for(int nodo=0; faltantes>0 && nodo<CPU_SETSIZE; nodo++)
+	{
+		sprintf(ruta, "/sys/devices/system/node/node%d/cpulist", nodo);
+		cpu_set_t delNodo;
+		__leerListaNucleos(ruta, &permitidos, &delNodo);
+		if(CPU_COUNT(&delNodo) == 0)
+		{
+			//los nodos se numeran sin saltos, salvo los que solo tienen memoria
+			FILE *pArch = fopen(ruta, "r");
+			if(!pArch)
+				break;
+			fclose(pArch);
+			continue;
+		}
+		s_pInicioNodo[s_numNodos++] = numNucleos;
+		for(int i=0; i<CPU_SETSIZE; i++)
+			if(CPU_ISSET(i, &delNodo))
+			{
+				s_pNucleos[numNucleos++] = i;
+				CPU_CLR(i, &permitidos);
+				faltantes--;
+			}
+	}
+
+	//los ncleos que no aparecen en ningn nodo forman uno solo
+	if(faltantes > 0)
+	{
+		if(s_numNodos > 0)
+			numNucleos = 0;
+		s_numNodos = 1;
+		s_pInicioNodo[0] = 0;
+		if(sched_getaffinity(0, sizeof(permitidos), &permitidos) != 0)
+			CPU_ZERO(&permitidos);
+		for(int i=0; i<CPU_SETSIZE; i++)
+			if(CPU_ISSET(i, &permitidos))
+				s_pNucleos[numNucleos++] = i;
+	}
+	if(s_numNodos == 0)
+	{
+		s_numNodos = 1;
+		s_pInicioNodo[0] = 0;
+	}
+	s_pInicioNodo[s_numNodos] = numNucleos;
+}
+
+
+/*!Con un solo nodo no tiene efecto, pues el hilo ya usa la memoria de ese nodo.
+\param nodo Nmero del nodo. Se toma el residuo de dividirlo por el nmero de nodos.
+\return true si el hilo qued fijado.*/
+bool TopologiaNUMA::fijarHiloEnNodo(int nodo)
+{
+	detectar();
+	if(s_numNodos <= 1 || nodo < 0)
+		return false;
+	nodo %= s_numNodos;
+	cpu_set_t mascara;
+	CPU_ZERO(&mascara);
+	for(int i=s_pInicioNodo[nodo]; i<s_pInicioNodo[nodo+1]; i++)
+		CPU_SET(s_pNucleos[i], &mascara);
+	return sched_setaffinity(0, sizeof(mascara), &mascara) == 0;
+}
+
+
+/*!\param nucleo Nmero del ncleo en el sistema (Ver \a getNucleo()).
+\return true si el hilo qued fijado.*/
+bool TopologiaNUMA::fijarHiloEnNucleo(int nucleo)
+{
+	if(nucleo < 0 || nucleo >= CPU_SETSIZE)
+		return false;
+	cpu_set_t mascara;
+	CPU_ZERO(&mascara);
+	CPU_SET(nucleo, &mascara);
+	return sched_setaffinity(0, sizeof(mascara), &mascara) == 0;
+}
+
+#else
+
+void TopologiaNUMA::detectar()
+{
+	s_detectada = true;
+}
+
+
+/*!Sin UN_AFINIDAD no tiene efecto.
+\return false*/
+bool TopologiaNUMA::fijarHiloEnNodo(int)
+{
+	return false;
+}
+
+
+/*!Sin UN_AFINIDAD no tiene efecto.
+\return false*/
+bool TopologiaNUMA::fijarHiloEnNucleo(int)
+{
+	return false;
+}
+
+#endif
+
+
+/*!\return Nmero de nodos con ncleos disponibles. Es 1 si no hay informacin de nodos.*/
+int TopologiaNUMA::getNumNodos()
+{
+	detectar();
+	return s_numNodos;
+}
+
+
+/*!\param nodo Nmero del nodo, o -1 para contar todos los ncleos.
+\return Nmero de ncleos, o 0 si no se conocen.*/
+int TopologiaNUMA::getNumNucleos(int nodo)
+{
+	detectar();
+	if(!s_pInicioNodo)
+		return 0;
+	if(nodo < 0)
+		return s_pInicioNodo[s_numNodos];
+	nodo %= s_numNodos;
+	return s_pInicioNodo[nodo+1] - s_pInicioNodo[nodo];
+}
+
+
+/*!Los ncleos del equipo se recorren nodo por nodo, de modo que ncleos consecutivos quedan en el
+mismo nodo.
+\param nodo Nmero del nodo, o -1 para recorrer todos los ncleos del equipo.
+\param pos Posicin del ncleo. Se toma el residuo de dividirla por el nmero de ncleos.
+\return Nmero del ncleo en el sistema, o -1 si no se conocen los ncleos.*/
+int TopologiaNUMA::getNucleo(int nodo, int pos)
+{
+	int num = getNumNucleos(nodo);
+	if(num <= 0 || pos < 0)
+		return -1;
+	int inicio = nodo<0 ? 0 : s_pInicioNodo[nodo % s_numNodos];
+	return s_pNucleos[inicio + pos%num];
+}
+
+
+/*!\param pArch Archivo en el que se escribe el reporte.*/
+void TopologiaNUMA::reportar(FILE *pArch)
+{
+	detectar();
+	fprintf(pArch, "Nodos NUMA: %d\n", s_numNodos);
+	for(int nodo=0; nodo<s_numNodos && s_pInicioNodo; nodo++)
+	{
+		fprintf(pArch, "  Nodo %d:", nodo);
+		for(int i=s_pInicioNodo[nodo]; i<s_pInicioNodo[nodo+1]; i++)
+			fprintf(pArch, " %d", s_pNucleos[i]);
+		fprintf(pArch, "\n");
+	}
+#if defined(UN_AFINIDAD)
+	cpu_set_t mascara;
+	if(sched_getaffinity(0, sizeof(mascara), &mascara) == 0)
+	{
+		fprintf(pArch, "Nucleos del hilo actual:");
+		for(int i=0; i<CPU_SETSIZE; i++)
+			if(CPU_ISSET(i, &mascara))
+				fprintf(pArch, " %d", i);
+		fprintf(pArch, "\n");
+	}
+#endif
+}
+
+
+/************************************************************
+                AFINIDAD DE UN HILO (Implementacin)
+************************************************************/
+
+#if defined(UN_AFINIDAD)
+
+/*!\return true si se pudieron consultar los ncleos.*/
+bool AfinidadHilo::guardar()
+{
+	m_guardada = sched_getaffinity(0, sizeof(m_Mascara), &m_Mascara) == 0;
+	return m_guardada;
+}
+
+
+/*!Debe invocarse desde el mismo hilo que invoc \a guardar().*/
+void AfinidadHilo::restaurar()
+{
+	if(m_guardada)
+		sched_setaffinity(0, sizeof(m_Mascara), &m_Mascara);
+	m_guardada = false;
+}
+
+#else
+
+/*!Sin UN_AFINIDAD no tiene efecto.
+\return false*/
+bool AfinidadHilo::guardar()
+{
+	return false;
+}
+
+
+/*!Sin UN_AFINIDAD no tiene efecto.*/
+void AfinidadHilo::restaurar()
+{
+	m_guardada = false;
+}
+
+#endif
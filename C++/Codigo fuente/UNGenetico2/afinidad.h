@@ -0,0 +1,108 @@
+#ifndef __AFINIDAD_H
+#define __AFINIDAD_H
+
+#include <stdio.h>
+
+//!Se define si el sistema operativo permite fijar los hilos a ncleos (Linux). Habilita TopologiaNUMA
+#if !defined(UN_AFINIDAD) && defined(__linux__)
+#define UN_AFINIDAD
+#endif
+
+#if defined(UN_AFINIDAD)
+#	include <sched.h>
+#endif
+
+
+//!Constantes que indican cmo se fijan a los ncleos los trabajadores de un PoolTareas
+enum TiposAfinidad
+{
+	AFINIDAD_NINGUNA	=	0,
+	AFINIDAD_NUCLEOS,
+	AFINIDAD_NODO
+};
+
+
+/************************************************************
+                     TOPOLOGA NUMA
+************************************************************/
+
+//!Consulta los nodos NUMA del equipo y fija los hilos a sus ncleos
+/*!En los equipos con varios procesadores (nodos NUMA), cada nodo tiene su propia memoria, y
+leer la memoria de otro nodo es ms lento. El sistema ubica cada pgina de memoria en el nodo
+del hilo que la escribe por primera vez, de modo que si un algoritmo se fija a un nodo antes de
+crear su poblacin, sus individuos y genomas quedan en la memoria de ese nodo.
+
+La topologa se lee de \c /sys/devices/system/node, y solo se tienen en cuenta los ncleos en los
+que el proceso puede ejecutarse. Los nodos se numeran de 0 a \a getNumNodos()-1, sin contar los
+que no tienen ncleos disponibles.
+Si el sistema no es Linux o tiene un solo nodo, hay un solo nodo y las funciones que fijan
+hilos no tienen efecto.
+La topologa se consulta la primera vez que se usa, lo que debe hacerse desde un solo hilo.*/
+class TopologiaNUMA
+{
+public:
+	//!Retorna el nmero de nodos
+	static int getNumNodos();
+
+	//!Retorna el nmero de ncleos disponibles en el nodo \a nodo, o en todo el equipo si \a nodo es negativo
+	static int getNumNucleos(int nodo=-1);
+
+	//!Retorna el ncleo \a pos del nodo \a nodo, o del equipo si \a nodo es negativo
+	static int getNucleo(int nodo, int pos);
+
+	//!Fija el hilo actual a los ncleos del nodo \a nodo
+	static bool fijarHiloEnNodo(int nodo);
+
+	//!Fija el hilo actual a un ncleo
+	static bool fijarHiloEnNucleo(int nucleo);
+
+	//!Escribe en \a pArch los nodos con sus ncleos y los ncleos en que puede ejecutarse el hilo actual
+	static void reportar(FILE *pArch=stdout);
+
+protected:
+	//!Consulta la topologa, si no se ha consultado
+	static void detectar();
+
+	//!Indica si ya se consult la topologa
+	static bool s_detectada;
+	//!Nmero de nodos
+	static int s_numNodos;
+	//!Ncleos disponibles, agrupados por nodo
+	static int *s_pNucleos;
+	//!Posicin en \a s_pNucleos del primer ncleo de cada nodo. Tiene \a s_numNodos+1 elementos
+	static int *s_pInicioNodo;
+};
+
+
+//!Ncleos en los que puede ejecutarse un hilo, guardados para restaurarlos despus de fijarlo
+/*!Se usa para que fijar un hilo a un nodo (Ver TopologiaNUMA::fijarHiloEnNodo()) no cambie de forma
+permanente la afinidad de un hilo de la aplicacin. Sin UN_AFINIDAD no tiene efecto.*/
+class AfinidadHilo
+{
+public:
+	//!Constructor. No guarda nada
+	AfinidadHilo():m_guardada(false){}
+
+	//!Guarda los ncleos en los que puede ejecutarse el hilo actual
+	bool guardar();
+
+	//!Restaura en el hilo actual los ncleos guardados, si los hay, y los olvida
+	void restaurar();
+
+	//!Indica si hay ncleos guardados
+	bool guardada() const
+	{
+		return m_guardada;
+	}
+
+protected:
+	//!Indica si hay ncleos guardados
+	bool m_guardada;
+#if defined(UN_AFINIDAD)
+	//!Ncleos guardados
+	cpu_set_t m_Mascara;
+#endif
+};
+
+
+#endif
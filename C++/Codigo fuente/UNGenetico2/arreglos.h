@@ -3,6 +3,8 @@
 
 #include <string.h>
 
+#include "memoria.h"
+
 //!Clase genrica que almacena un arreglo de apuntadores a la clase T.
 /*!El acceso a los objetos del arreglo es al estilo de los arreglos de C 
 y no al estilo de listas encadenadas, lo que le da mayor rapidez.
@@ -12,11 +14,16 @@ En lo posible, para evitar reasignaci
 adicionar tems al arreglo debe asignarse la capacidad necesaria para 
 el nmero de tems que se prevee se van a adicionar al arreglo. Esto puede
 hacerse mediante la funcin \a asignarMemoria.
+Cuando el arreglo se llena, su capacidad se duplica, de modo que adicionar 
+\a n tems cuesta un tiempo proporcional a \a n. La capacidad solo se reduce
+segn la poltica descrita en \a liberarMemoria().
 */
 template<class T>
 class Arreglo
 {
 public:
+	//!Los objetos Arreglo creados con \a new usan la memoria del algoritmo activo (Ver MemoriaAG)
+	USAR_MEMORIA_AG
 
 	//!Constructor por copia de otro arreglo. No se puede usar con arreglos de clases abstractas
 	Arreglo(const Arreglo& origen);
@@ -28,6 +35,36 @@ public:
 	//!Operador de asignacin a partir de otro arreglo. No se puede usar con arreglos de clases abstractas
 	const Arreglo<T>& operator = ( const Arreglo<T>& otro );
 
+#if defined(UN_CPP11)
+	//!Constructor de movimiento
+	/*!Toma los apuntadores y la memoria de \a origen, que queda vaco. No crea copias de los objetos.
+	\param origen Arreglo del que se toman los apuntadores.*/
+	Arreglo(Arreglo&& origen):m_capacidad(origen.m_capacidad),m_items(origen.m_items),m_pData(origen.m_pData)
+	{
+		origen.m_items = origen.m_capacidad = 0;
+		origen.m_pData = NULL;
+	}
+
+	//!Operador de asignacin por movimiento
+	/*!Destruye los objetos actuales y toma los apuntadores y la memoria de \a origen, que queda vaco.
+	\param origen Arreglo del que se toman los apuntadores.
+	\return Referencia al arreglo*/
+	Arreglo<T>& operator = ( Arreglo<T>&& origen )
+	{
+		if(this != &origen)
+		{
+			Truncar(0, true, false);
+			delete [] m_pData;
+			m_items = origen.m_items;
+			m_capacidad = origen.m_capacidad;
+			m_pData = origen.m_pData;
+			origen.m_items = origen.m_capacidad = 0;
+			origen.m_pData = NULL;
+		}
+		return *this;
+	}
+#endif
+
 	//!Destructor.
 	/*!Elimina todos los apuntadores y destruye los objetos pertenecientes al arreglo*/
 	virtual ~Arreglo(void)
@@ -42,7 +79,7 @@ public:
 	\return Posicin en la que se adicion el nuevo miembro.*/
 	int Adicionar(T* pNuevo)
 	{
-		if(m_items >= m_capacidad) asignarMemoria(m_items+20);
+		if(m_items >= m_capacidad) crecer();
 		m_pData[m_items] = pNuevo;		
 		return ++m_items;
 	}
@@ -109,6 +146,30 @@ public:
 		return (*m_pData[pos]);
 	}
 
+	//!Retorna una referencia al objeto ubicado en una posicin determinada del arreglo, sin verificar la posicin.
+	/*!Se utiliza en los ciclos internos de la librera, donde la posicin ya se conoce vlida.
+	\param pos Posicin del objeto requerido. Debe estar en el rango [0, getSize()-1].
+	\return Referencia al objeto apuntado por el apuntador ubicado en la posicin \a pos del arreglo*/
+	T& getObjDirecto(int pos) const
+	{
+		return (*m_pData[pos]);
+	}
+
+	//!Retorna un apuntador al primer apuntador del arreglo
+	/*!Permite recorrer el arreglo al estilo de C: <tt>for(T** p=a.begin(); p!=a.end(); ++p)</tt>
+	\return Apuntador a la primera posicin del arreglo*/
+	T** begin() const
+	{
+		return m_pData;
+	}
+
+	//!Retorna un apuntador a la posicin siguiente al ltimo apuntador del arreglo
+	/*!\return Apuntador a la posicin siguiente al ltimo tem del arreglo*/
+	T** end() const
+	{
+		return m_pData + m_items;
+	}
+
 	//!Retorna una referencia al objeto ubicado en una posicin determinada del arreglo.
 	/*!Es equivalente a getObj(pos). Permite acceder a los miembros del arreglo al estilo del lenguaje C.
 	\param pos Posicin del objeto requerido. Si es menor que cero se retorna el objeto en la primera posicin. Si es mayor que el nmero de tems del arreglo, se retorna el objeto en la ltima posicin.
@@ -121,7 +182,7 @@ public:
 	//!Aumenta la capacidad del arreglo para albergar un nmero determinado de tems
 	bool asignarMemoria(int n);
 
-	//!Reduce la capacidad del arreglo al nmero de tems actual
+	//!Reduce la capacidad del arreglo si est muy por encima del nmero de tems actual
 	void liberarMemoria();
 
     //!Excluye del arreglo el apuntador ubicado en una posicin determinada, sin destruir el objeto al que apunta.
@@ -147,6 +208,12 @@ public:
 
 private:
 
+	//Duplica la capacidad del arreglo (como mnimo 20 tems)
+	void crecer()
+	{
+		asignarMemoria( m_capacidad < 10 ? 20 : 2*m_capacidad );
+	}
+
 	//Cantidad de items que puede albergar el arreglo (memoria asignada a m_pData)
 	int m_capacidad;
 
@@ -206,7 +273,7 @@ const Arreglo<T>& Arreglo<T>:: operator =(const Arreglo<T>& origen)
 
 
 /*!Todos los miembros a partir de la posicin de insercin aumentan una posicin.
-En caso de estar lleno el arreglo, realiza asignacin de espacio para 20 items ms.
+En caso de estar lleno el arreglo, duplica su capacidad.
 \param pNuevo Apuntador al nuevo miembro del arreglo.
 \param pos Posicin en la que se ubicar el nuevo miembro. Si es menor que cero, es ubicado en la posicin cero. Si es mayor que el nmero de items, se adiciona al final del arreglo.
 \return Posicin en la que fu ubicado el nuevo miembro.
@@ -217,7 +284,7 @@ int Arreglo<T>::Insertar(T* pNuevo, int pos)
     if(pos<0){pos=0;}
     if(pos>=m_items) return Adicionar(pNuevo);
 	if(m_items >= m_capacidad)
-		asignarMemoria(m_items+20);
+		crecer();
 	memmove( m_pData+pos+1  , m_pData+pos, (m_items-pos)*sizeof(T*) );
 	m_pData[pos] = pNuevo;
 	m_items++;
@@ -227,7 +294,8 @@ int Arreglo<T>::Insertar(T* pNuevo, int pos)
 
 
 /*!Utilice liberar_memoria=false si sabe que va a volver a usar la capacidad actual
-del arreglo para evitar reasignacin posterior de memoria.
+del arreglo para evitar reasignacin posterior de memoria. Con liberar_memoria=true 
+la capacidad se reduce segn la poltica de \a liberarMemoria().
 \param nuevoTam Nuevo tamao del arreglo. Si es mayor que el actual, nada ocurre. Si es menor que cero, el nuevo tamao es cero. 
 \param eliminarObjetos Si es \a true se eliminan los objetos sobrantes. En caso contrario, los objetos dejan de ser parte del arreglo pero no son eliminados.
 \param liberar_memoria Si es \a true se libera la memoria no necesaria.
@@ -273,19 +341,29 @@ bool Arreglo<T>::asignarMemoria(int n)
 }
 
 
-/*!Se utiliza para liberar la memoria no utilizada por el arreglo*/
+/*!Se utiliza para liberar la memoria no utilizada por el arreglo.
+Si el arreglo est vaco se libera toda su memoria. En otro caso la capacidad solo
+se reduce cuando los tems ocupan menos de la cuarta parte de ella, y se deja en el 
+doble del nmero de tems. As, alternar entre truncar y adicionar no obliga a 
+reasignar memoria en cada operacin.*/
 template <class T>
 void Arreglo<T>::liberarMemoria()
 {
-	if( m_items >= m_capacidad ) return; //no hay memoria que liberar
-	int nuevaCap = m_items;
-	if(nuevaCap==0) nuevaCap=1;
+	if(m_items == 0)
+	{
+		delete [] m_pData;
+		m_pData = NULL;
+		m_capacidad = 0;
+		return;
+	}
+	if( 4*m_items >= m_capacidad ) return; //no vale la pena reasignar memoria
+	int nuevaCap = 2*m_items;
 	T** pNuevo=new T*[nuevaCap];
 	if(pNuevo)
 	{
 		m_capacidad = nuevaCap;
 		//copiar memoria a la nueva ubicacin
-		memcpy(pNuevo, m_pData, nuevaCap*sizeof(T*));
+		memcpy(pNuevo, m_pData, m_items*sizeof(T*));
 		delete [] m_pData;
 		m_pData = pNuevo;
 	}
@@ -325,5 +403,80 @@ void Arreglo<T>::Destroy (int pos)
 }
 
 
+//!Clase genrica que permite leer un bloque contiguo de datos de tipo T sin copiarlo.
+/*!No es duea de los datos: solo guarda un apuntador al primer dato y el nmero de datos.
+Se utiliza para decodificar un gen de tipo arreglo directamente sobre su almacenamiento,
+sin asignar memoria ni copiar valores en cada evaluacin. La vista es vlida mientras
+el gen del que proviene no cambie de tamao ni sea destruido.
+Ofrece \a getSize() y el operador [] igual que la clase Arreglo, de modo que el cdigo 
+escrito para un Arreglo<T> puede usarse tambin con una VistaArreglo<T>.*/
+template<class T>
+class VistaArreglo
+{
+public:
+
+	//!Constructor por defecto.
+	/*!Crea una vista vacia.*/
+	VistaArreglo():m_pDatos(NULL),m_items(0){}
+
+	//!Constructor a partir de un bloque de datos.
+	/*!\param pDatos Apuntador al primer dato del bloque.
+	\param items Nmero de datos del bloque.*/
+	VistaArreglo(const T* pDatos, int items):m_pDatos(pDatos),m_items(items){}
+
+	//!Hace que la vista apunte a otro bloque de datos
+	/*!\param pDatos Apuntador al primer dato del bloque.
+	\param items Nmero de datos del bloque.*/
+	void asignar(const T* pDatos, int items)
+	{
+		m_pDatos = pDatos;
+		m_items = items;
+	}
+
+	//!Retorna el nmero de datos de la vista
+	/*!\return Tamao de la vista*/
+	int getSize() const
+	{
+		return m_items;
+	}
+
+	//!Retorna el nmero de datos de la vista. Es equivalente a getSize()
+	/*!\return Tamao de la vista*/
+	int size() const
+	{
+		return m_items;
+	}
+
+	//!Retorna una referencia al dato ubicado en una posicin determinada de la vista.
+	/*!A diferencia de Arreglo<T>, la posicin no se verifica.
+	\param pos Posicin del dato requerido. Debe estar en el rango [0, getSize()-1].
+	\return Referencia constante al dato en la posicin \a pos*/
+	const T& operator[]( int pos ) const 
+	{
+		return m_pDatos[pos]; 
+	}
+
+	//!Retorna un apuntador al primer dato de la vista
+	const T* begin() const
+	{
+		return m_pDatos;
+	}
+
+	//!Retorna un apuntador a la posicin siguiente al ltimo dato de la vista
+	const T* end() const
+	{
+		return m_pDatos + m_items;
+	}
+
+private:
+
+	//Apuntador al primer dato del bloque
+	const T* m_pDatos;
+
+	//Cantidad de datos del bloque
+	int m_items;
+};
+
+
 
 #endif		/*__ARREGLOS_H*/
\ No newline at end of file
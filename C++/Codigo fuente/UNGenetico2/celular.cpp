@@ -0,0 +1,228 @@
+#include "celular.h"
+
+
+/************************************************************
+           ALGORITMO GENTICO CELULAR (Implementacin)
+************************************************************/
+
+
+#if defined(USAR_VENTANA)
+
+	/*!Establece los parmetros por defecto del algoritmo celular: la rejilla se calcula a partir
+	de \a m_TamanoPoblacion y se usa el vecindario de von Neumann.
+	\param pFrame Apuntador a la ventana de la aplicacin*/
+	AlgoritmoGeneticoCelular::AlgoritmoGeneticoCelular(AGFrame *pFrame):AlgoritmoGenetico(pFrame)
+	{
+		m_Filas = 0;
+		m_Columnas = 0;
+		m_TipoVecindario = VECINDARIO_VON_NEUMANN;
+		m_pEvaluador = NULL;
+		m_numVecinos = 0;
+		m_numColores = 0;
+		m_pVecinos = NULL;
+		m_pOrden = NULL;
+		m_pInicioColor = NULL;
+		m_pHijos = NULL;
+	}
+
+#else
+
+	/*!Establece los parmetros por defecto del algoritmo celular: la rejilla se calcula a partir
+	de \a m_TamanoPoblacion y se usa el vecindario de von Neumann.*/
+	AlgoritmoGeneticoCelular::AlgoritmoGeneticoCelular()
+	{
+		m_Filas = 0;
+		m_Columnas = 0;
+		m_TipoVecindario = VECINDARIO_VON_NEUMANN;
+		m_pEvaluador = NULL;
+		m_numVecinos = 0;
+		m_numColores = 0;
+		m_pVecinos = NULL;
+		m_pOrden = NULL;
+		m_pInicioColor = NULL;
+		m_pHijos = NULL;
+	}
+
+#endif
+
+
+/*!Destruye los hijos y el evaluador. El resto de objetos los destruye AlgoritmoGenetico.*/
+AlgoritmoGeneticoCelular::~AlgoritmoGeneticoCelular()
+{
+	destruirRejilla();
+}
+
+
+/*!Destruye los hijos y el evaluador antes de que AlgoritmoGenetico::finalizarOptimizacion()
+devuelva la memoria del algoritmo.*/
+void AlgoritmoGeneticoCelular::finalizarOptimizacion()
+{
+	destruirRejilla();
+	AlgoritmoGenetico::finalizarOptimizacion();
+}
+
+
+void AlgoritmoGeneticoCelular::destruirRejilla()
+{
+	if(m_pEvaluador)
+	{
+		m_pEvaluador->finalizar();
+		delete m_pEvaluador;
+		m_pEvaluador = NULL;
+	}
+	if(m_pHijos) delete m_pHijos;
+	m_pHijos = NULL;
+	delete[] m_pVecinos;
+	delete[] m_pOrden;
+	delete[] m_pInicioColor;
+	m_pVecinos = NULL;
+	m_pOrden = NULL;
+	m_pInicioColor = NULL;
+}
+
+
+/*!Si \a m_Filas o \a m_Columnas no son positivos, la rejilla se hace tan cuadrada como sea posible
+para \a m_TamanoPoblacion individuos. Ambas dimensiones se redondean a un nmero par, y
+\a m_TamanoPoblacion se cambia por el nmero de celdas.
+
+Los vecinos de cada celda se guardan en una sola tabla, y las celdas de cada color quedan
+contiguas en \a m_pOrden, en el mismo orden de la rejilla.*/
+void AlgoritmoGeneticoCelular::crearRejilla()
+{
+	if(m_Filas < 1 || m_Columnas < 1)
+	{
+		int tamPob = m_TamanoPoblacion>4 ? m_TamanoPoblacion : 4;
+		m_Columnas = (int)ceil(sqrt((double)tamPob));
+		m_Filas = (tamPob + m_Columnas - 1)/m_Columnas;
+	}
+	m_Filas += m_Filas%2;
+	m_Columnas += m_Columnas%2;
+	m_TamanoPoblacion = m_Filas*m_Columnas;
+
+	bool moore = m_TipoVecindario == VECINDARIO_MOORE;
+	m_numVecinos = moore ? 8 : 4;
+	m_numColores = moore ? 4 : 2;
+	m_pVecinos = new int[m_TamanoPoblacion*m_numVecinos];
+	m_pOrden = new int[m_TamanoPoblacion];
+	m_pInicioColor = new int[m_numColores+1];
+
+	int f, c, *pVecino = m_pVecinos;
+	for(f=0; f<m_Filas; f++)
+	{
+		int arriba = (f+m_Filas-1)%m_Filas, abajo = (f+1)%m_Filas;
+		for(c=0; c<m_Columnas; c++)
+		{
+			int izquierda = (c+m_Columnas-1)%m_Columnas, derecha = (c+1)%m_Columnas;
+			*pVecino++ = arriba*m_Columnas + c;
+			*pVecino++ = abajo*m_Columnas + c;
+			*pVecino++ = f*m_Columnas + izquierda;
+			*pVecino++ = f*m_Columnas + derecha;
+			if(moore)
+			{
+				*pVecino++ = arriba*m_Columnas + izquierda;
+				*pVecino++ = arriba*m_Columnas + derecha;
+				*pVecino++ = abajo*m_Columnas + izquierda;
+				*pVecino++ = abajo*m_Columnas + derecha;
+			}
+		}
+	}
+
+	int numOrden = 0;
+	for(int color=0; color<m_numColores; color++)
+	{
+		m_pInicioColor[color] = numOrden;
+		for(f=0; f<m_Filas; f++)
+			for(c=0; c<m_Columnas; c++)
+			{
+				int colorCelda = moore ? 2*(f%2) + c%2 : (f+c)%2;
+				if(colorCelda == color)
+					m_pOrden[numOrden++] = f*m_Columnas + c;
+			}
+	}
+	m_pInicioColor[m_numColores] = numOrden;
+}
+
+
+/*!Crea tantas copias del individuo modelo como celdas tiene el color ms grande.
+Es invocada en la primera iteracin.*/
+void AlgoritmoGeneticoCelular::crearHijos()
+{
+	int maxHijos = 0;
+	for(int color=0; color<m_numColores; color++)
+		maxHijos = _MAXIMO(maxHijos, m_pInicioColor[color+1]-m_pInicioColor[color]);
+
+	m_pHijos = new Arreglo<Individuo>;
+	m_pHijos->asignarMemoria(maxHijos);
+	for(int i=0; i<maxHijos; i++)
+		m_pHijos->Adicionar( new Individuo(*m_pModelo) );
+}
+
+
+/*!En la primera iteracin crea el evaluador por defecto si no se defini otro, la rejilla, la
+poblacin (que se evala con el evaluador) y los hijos. En las siguientes, para cada color:
+- Crea un hijo por cada celda del color.
+- Evala todos los hijos del color con Evaluador::evaluarLote().
+- Cada hijo ocupa su celda si no es peor que el individuo que la ocupa.
+
+Al final del barrido invoca los operadores de adaptacin y \a terminarIteracion().*/
+void AlgoritmoGeneticoCelular::iterarOptimizacion()
+{
+	MemoriaAG::activar(m_pMemoria);
+	int i;
+	if(m_Generacion==0)
+	{
+		if(!m_pEvaluador)
+			m_pEvaluador = new EvaluadorLocal;
+		m_pEvaluador->iniciar(this);
+
+		crearRejilla();
+		crearPoblacion();
+		for(i=0; i<m_TamanoPoblacion; i++)
+			m_pEvaluador->enviar( &m_pPoblacionActual->getIndividuoDirecto(i) );
+		for(i=0; i<m_TamanoPoblacion; i++)
+			m_pEvaluador->recibir(true);
+		crearHijos();
+	}
+	else
+	{
+		for(int color=0; color<m_numColores; color++)
+		{
+			int *pCeldas = m_pOrden + m_pInicioColor[color];
+			int numCeldas = m_pInicioColor[color+1] - m_pInicioColor[color];
+			for(i=0; i<numCeldas; i++)
+				crearHijo(m_pHijos->getObjDirecto(i), pCeldas[i]);
+			m_pEvaluador->evaluarLote(m_pHijos->begin(), numCeldas);
+
+			//ninguna celda del color es vecina de otra del mismo color
+			for(i=0; i<numCeldas; i++)
+			{
+				Individuo &hijo = m_pHijos->getObjDirecto(i);
+				Individuo &actual = m_pPoblacionActual->getIndividuoDirecto(pCeldas[i]);
+				if(!esMejor(actual.objetivo(), hijo.objetivo()))
+					actual = hijo;
+			}
+		}
+		adaptacion();
+	}
+	terminarIteracion();
+}
+
+
+/*!La pareja es el mejor de dos vecinos elegidos al azar. El hijo se crea con
+\a crearDescendiente() a partir de la pareja y del individuo de la celda.
+\param hijo Individuo en el que se construye el hijo. Su contenido anterior se descarta.
+\param celda Posicin de la celda en la poblacin, que ocupar el hijo. Se entrega a los operadores de cruce como ndice.*/
+void AlgoritmoGeneticoCelular::crearHijo(Individuo &hijo, int celda)
+{
+	const int *pVecinos = m_pVecinos + celda*m_numVecinos;
+	Individuo &a = m_pPoblacionActual->getIndividuoDirecto( pVecinos[azarEntero(m_numVecinos)] );
+	Individuo &b = m_pPoblacionActual->getIndividuoDirecto( pVecinos[azarEntero(m_numVecinos)] );
+	Individuo &pareja = esMejor(b.objetivo(), a.objetivo()) ? b : a;
+	Individuo &actual = m_pPoblacionActual->getIndividuoDirecto(celda);
+
+	double objPareja = pareja.objetivo(), objActual = actual.objetivo();
+	if(esMejor(objPareja, objActual))
+		crearDescendiente(hijo, pareja, actual, objPareja, objActual, celda);
+	else
+		crearDescendiente(hijo, actual, pareja, objActual, objPareja, celda);
+}
@@ -0,0 +1,148 @@
+#ifndef __CELULAR_H
+#define __CELULAR_H
+
+#include "evaluador.h"
+
+
+//!Constantes que indican los vecinos con los que se cruza cada celda en AlgoritmoGeneticoCelular
+enum TiposVecindario
+{
+	VECINDARIO_VON_NEUMANN	=	1,
+	VECINDARIO_MOORE
+};
+
+
+/************************************************************
+                ALGORITMO GENTICO CELULAR
+************************************************************/
+
+//!Clase derivada de AlgoritmoGenetico en la que los individuos solo se cruzan con sus vecinos
+/*!Los individuos ocupan las celdas de una rejilla toroidal de \a m_Filas por \a m_Columnas,
+guardada por filas en la poblacin (la celda de la fila \a f y la columna \a c es el individuo
+\a f*m_Columnas+c). Cada celda solo se cruza con sus vecinos, segn \a m_TipoVecindario:
+- VECINDARIO_VON_NEUMANN: las cuatro celdas de arriba, abajo, izquierda y derecha.
+- VECINDARIO_MOORE: las ocho celdas que la rodean.
+
+En cada generacin, cada celda elige una pareja entre sus vecinos por torneo binario, y el hijo
+de ambos, ya mutado, ocupa la celda si no es peor que su individuo. Como la seleccin y el remplazo
+son locales, los buenos individuos se difunden lentamente por la rejilla y la poblacin conserva
+su diversidad por ms tiempo que con la seleccin global de OperadorSeleccionEstocasticaRemplazo.
+
+Las celdas se recorren por colores, como un tablero de ajedrez (dos colores con VECINDARIO_VON_NEUMANN,
+cuatro con VECINDARIO_MOORE), de modo que ninguna celda tiene vecinos de su mismo color. Todos los
+hijos de un color se crean a partir del estado de la rejilla al iniciar el color y se evalan juntos
+en el Evaluador \a m_pEvaluador (Ver Evaluador::evaluarLote()); as, con EvaluadorHilos los hijos se
+reparten en bloques entre los hilos, sin candados sobre la poblacin. Para que los colores sean vlidos en el toro, el nmero de filas y
+de columnas se redondea a un nmero par.
+
+Se usan los operadores de mutacin y cruce del algoritmo. Los de probabilidad, seleccin, parejas
+y reproduccin no se utilizan, y los de adaptacin, que se invocan al final de cada barrido, no
+deben cambiar el tamao de la poblacin.
+Por defecto se usa EvaluadorLocal; puede cambiarse en \a definirOperadores() con la macro
+DEFINIR_EVALUADOR. Normalmente se declara con la macro DECLARAR_ALGORITMO_CELULAR.*/
+class AlgoritmoGeneticoCelular:public AlgoritmoGenetico
+{
+public:
+
+#if defined(USAR_VENTANA)
+
+	//!Constructor cuando se usa el entorno grfico (Debe estar definida la constante USAR_VENTANA)
+	AlgoritmoGeneticoCelular(AGFrame *pFrame);
+
+#else
+
+	//!Constructor por defecto.
+	AlgoritmoGeneticoCelular();
+
+#endif
+
+	//!Destructor
+	~AlgoritmoGeneticoCelular();
+
+	//!Efecta un barrido completo de la rejilla
+	void iterarOptimizacion();
+
+	//!Finaliza el algoritmo gentico, destruyendo tambin los hijos y el evaluador
+	void finalizarOptimizacion();
+
+//! @name Parmetros del algoritmo celular
+//@{
+
+	//!Nmero de filas de la rejilla. Con 0 se calcula a partir de \a m_TamanoPoblacion
+	int m_Filas;
+	//!Nmero de columnas de la rejilla. Con 0 se calcula a partir de \a m_TamanoPoblacion
+	int m_Columnas;
+	//!Vecinos de cada celda. Puede ser VECINDARIO_VON_NEUMANN o VECINDARIO_MOORE
+	int m_TipoVecindario;
+
+//@}
+
+	//!Evaluador de los hijos. Si no se define en \a definirOperadores(), se usa EvaluadorLocal
+	Evaluador *m_pEvaluador;
+
+protected:
+	//!Calcula las dimensiones de la rejilla, la tabla de vecinos y el orden de las celdas por colores
+	void crearRejilla();
+
+	//!Crea los individuos que se reutilizan como hijos en cada color
+	void crearHijos();
+
+	//!Crea en \a hijo el descendiente de la celda \a celda y de un vecino
+	void crearHijo(Individuo &hijo, int celda);
+
+	//!Destruye los hijos, las tablas de la rejilla y el evaluador
+	void destruirRejilla();
+
+	//!Indica si el valor \a a es mejor que el valor \a b
+	bool esMejor(double a, double b) const
+	{
+		return m_IndicadorMaximizar ? (a>b) : (a<b);
+	}
+
+	//!Nmero de vecinos de cada celda
+	int m_numVecinos;
+	//!Nmero de colores en que se recorre la rejilla
+	int m_numColores;
+	//!Vecinos de cada celda: los de la celda \a i empiezan en la posicin \a i*m_numVecinos
+	int *m_pVecinos;
+	//!Celdas de la rejilla agrupadas por color
+	int *m_pOrden;
+	//!Posicin en \a m_pOrden de la primera celda de cada color. Tiene \a m_numColores+1 elementos
+	int *m_pInicioColor;
+	//!Hijos de un color. Se reutilizan de un color a otro
+	Arreglo<Individuo> *m_pHijos;
+};
+
+
+//!Macro que crea una nueva clase derivada de AlgoritmoGeneticoCelular
+/*!Es equivalente a DECLARAR_ALGORITMO, pero la poblacin es una rejilla en la que cada individuo
+solo se cruza con sus vecinos (Ver AlgoritmoGeneticoCelular). Los parmetros \a m_Filas, \a m_Columnas
+y \a m_TipoVecindario pueden cambiarse en \a inicializarParametros().
+La declaracin se termina con FIN_DECLARAR_ALGORITMO.
+\param nombreAlgoritmo Nombre de la nueva clase.*/
+#if defined(USAR_VENTANA)
+
+#define DECLARAR_ALGORITMO_CELULAR(nombreAlgoritmo)								\
+	class nombreAlgoritmo : public AlgoritmoGeneticoCelular						\
+	{																			\
+	public:																		\
+		nombreAlgoritmo(AGFrame* pFrame):AlgoritmoGeneticoCelular(pFrame){}		\
+		AlgoritmoGenetico* crearInstancia(){ return new nombreAlgoritmo(m_pFrame); }	\
+		void codificacion(Individuo * pInd ,int estado);						\
+		double objetivo();
+
+#else
+
+#define DECLARAR_ALGORITMO_CELULAR(nombreAlgoritmo)				\
+	class nombreAlgoritmo : public AlgoritmoGeneticoCelular		\
+	{															\
+	public:														\
+		nombreAlgoritmo(){}										\
+		AlgoritmoGenetico* crearInstancia(){ return new nombreAlgoritmo; }	\
+		void codificacion(Individuo * pInd ,int estado);		\
+		double objetivo();
+
+#endif
+
+
+#endif
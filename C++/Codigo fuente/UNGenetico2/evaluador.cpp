@@ -0,0 +1,748 @@
+#include "evaluador.h"
+
+
+#if defined(UN_CPP11)
+
+/************************************************************
+                EVALUADOR CON HILOS (Implementacin)
+************************************************************/
+
+/*!\param numHilos Nmero de hilos de evaluacin. Con 0 se usa un hilo por ncleo del equipo, o del nodo con AFINIDAD_NODO.
+\param afinidad Forma en que se fijan los hilos a los ncleos: AFINIDAD_NINGUNA, AFINIDAD_NUCLEOS o AFINIDAD_NODO (Ver PoolTareas).*/
+EvaluadorHilos::EvaluadorHilos(int numHilos, int afinidad)
+{
+	m_numHilosSolicitados = numHilos;
+	m_Afinidad = afinidad;
+	m_numHilos = 0;
+	m_pPool = NULL;
+	m_pPoolPropio = NULL;
+	m_pInstancias = NULL;
+	m_enviados = 0;
+	m_enCurso = 0;
+	m_cancelar = false;
+}
+
+
+EvaluadorHilos::~EvaluadorHilos()
+{
+	finalizar();
+	if(m_pPoolPropio)
+		delete m_pPoolPropio;
+}
+
+
+/*!Crea una instancia del algoritmo por cada trabajador del pool. Si el algoritmo no puede crear
+instancias los individuos se evalan al enviarlos.
+\param pAG Apuntador al algoritmo gentico al que pertenecen los individuos.*/
+void EvaluadorHilos::iniciar(AlgoritmoGenetico *pAG)
+{
+	finalizar();
+
+	if(m_numHilosSolicitados > 0 || m_Afinidad != AFINIDAD_NINGUNA)
+	{
+		int nodo = pAG->m_NodoNUMA>0 ? pAG->m_NodoNUMA : 0;
+		if(!m_pPoolPropio)
+			m_pPoolPropio = new PoolTareas(m_numHilosSolicitados, m_Afinidad, nodo);
+		m_pPool = m_pPoolPropio;
+	}
+	else
+		m_pPool = &PoolTareas::global();
+	int numHilos = m_pPool->getNumTrabajadores();
+
+	//las instancias se crean fuera de la memoria del algoritmo, pues viven en otros hilos
+	MemoriaAG *pActiva = MemoriaAG::getActiva();
+	MemoriaAG::activar(NULL);
+	m_pInstancias = new AlgoritmoGenetico*[numHilos];
+	int i;
+	for(i=0; i<numHilos; i++)
+	{
+		m_pInstancias[i] = pAG->crearInstancia();
+		if(!m_pInstancias[i])
+			break;
+	}
+	MemoriaAG::activar(pActiva);
+	if(i < numHilos)
+	{
+		while(i > 0)
+			delete m_pInstancias[--i];
+		delete[] m_pInstancias;
+		m_pInstancias = NULL;
+		return;
+	}
+
+	m_cancelar = false;
+	m_numHilos = numHilos;
+}
+
+
+/*!\param pInd Apuntador al individuo a evaluar.*/
+void EvaluadorHilos::enviar(Individuo *pInd)
+{
+	if(m_numHilos == 0)
+	{
+		pInd->objetivo();
+		m_Listos.push_back(pInd);
+		m_enviados++;
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> candado(m_candado);
+		m_enviados++;
+		m_enCurso++;
+	}
+	m_pPool->enviar( new TareaEvaluar(this, pInd) );
+}
+
+
+/*!Si se invoca desde un trabajador del pool, ejecuta otras tareas mientras espera.
+\param esperar Si es true y an no ha terminado ninguna evaluacin, espera hasta que termine alguna.
+\return Apuntador al individuo evaluado, o NULL si no hay ninguno disponible o si no hay individuos en evaluacin.*/
+Individuo* EvaluadorHilos::recibir(bool esperar)
+{
+	std::unique_lock<std::mutex> candado(m_candado);
+	if(m_Listos.empty())
+	{
+		if(!esperar || m_enviados == 0)
+			return NULL;
+		bool trabajador = m_pPool && m_pPool->getTrabajadorActual() >= 0;
+		while(m_Listos.empty())
+		{
+			if(!trabajador)
+			{
+				m_hayListos.wait(candado);
+				continue;
+			}
+			candado.unlock();
+			if(!m_pPool->ayudar())
+				std::this_thread::yield();
+			candado.lock();
+		}
+	}
+	Individuo *pInd = m_Listos.front();
+	m_Listos.pop_front();
+	m_enviados--;
+	return pInd;
+}
+
+
+/*!Los individuos pendientes que ningn trabajador ha tomado se descartan sin evaluar.*/
+void EvaluadorHilos::finalizar()
+{
+	if(m_numHilos > 0)
+	{
+		std::unique_lock<std::mutex> candado(m_candado);
+		m_cancelar = true;
+		bool trabajador = m_pPool->getTrabajadorActual() >= 0;
+		while(m_enCurso > 0)
+		{
+			if(!trabajador)
+			{
+				m_hayListos.wait(candado);
+				continue;
+			}
+			candado.unlock();
+			if(!m_pPool->ayudar())
+				std::this_thread::yield();
+			candado.lock();
+		}
+	}
+	if(m_pInstancias)
+	{
+		for(int i=0; i<m_numHilos; i++)
+			delete m_pInstancias[i];
+		delete[] m_pInstancias;
+		m_pInstancias = NULL;
+	}
+	m_numHilos = 0;
+	m_Listos.clear();
+	m_enviados = 0;
+}
+
+
+/*!A diferencia de \a enviar(), los individuos no pasan por la cola de evaluados: cada bloque es
+una sola tarea de PoolTareas::paralelo(), sin candados por individuo, y los trabajadores se roban
+los bloques si las evaluaciones tienen costos desiguales. Si el hilo que invoca la funcin es un
+trabajador del pool, ejecuta bloques mientras espera.
+\param ppInd Apuntadores a los individuos.
+\param num Nmero de individuos.*/
+void EvaluadorHilos::evaluarLote(Individuo **ppInd, int num)
+{
+	if(m_numHilos == 0)
+	{
+		for(int i=0; i<num; i++)
+			ppInd[i]->objetivo();
+		return;
+	}
+	m_pPool->paralelo(num, 0, [this, ppInd](int inicio, int fin, int trabajador)
+	{
+		for(int i=inicio; i<fin; i++)
+			calcular(ppInd[i], trabajador);
+	});
+}
+
+
+/*!Los individuos cuya funcin objetivo ya est actualizada pasan directamente a la cola de
+evaluados.
+\param pInd Individuo a evaluar.
+\param trabajador Nmero del trabajador del pool que ejecuta la evaluacin.*/
+void EvaluadorHilos::evaluar(Individuo *pInd, int trabajador)
+{
+	bool cancelar;
+	{
+		std::lock_guard<std::mutex> candado(m_candado);
+		cancelar = m_cancelar;
+	}
+	if(!cancelar)
+		calcular(pInd, trabajador);
+
+	std::lock_guard<std::mutex> candado(m_candado);
+	if(!m_cancelar)
+		m_Listos.push_back(pInd);
+	m_enCurso--;
+	m_hayListos.notify_all();
+}
+
+
+/*!Decodifica el individuo en las variables de la instancia del trabajador, de modo que los
+trabajadores no comparten datos. No hace nada si la funcin objetivo ya est actualizada.
+\param pInd Individuo a evaluar.
+\param trabajador Nmero del trabajador del pool que ejecuta la evaluacin.*/
+void EvaluadorHilos::calcular(Individuo *pInd, int trabajador)
+{
+	if(pInd->objetivoActualizado())
+		return;
+	AlgoritmoGenetico *pInstancia = m_pInstancias[trabajador];
+	pInstancia->codificacion(pInd, ESTADO_DECODIFICAR);
+	pInd->asignarObjetivo( pInstancia->objetivo() );
+}
+
+#endif
+
+#if defined(UN_PROCESOS)
+
+/************************************************************
+              EVALUADOR CON PROCESOS (Implementacin)
+************************************************************/
+
+//Retorna el tiempo de un reloj montono, en segundos
+static double __ahoraEvaluador()
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (double)t.tv_sec + 1e-9*(double)t.tv_nsec;
+}
+
+
+/*!\param comando Comando que lanza el programa evaluador. Se ejecuta con \c /bin/sh.
+\param valorFallo Valor de la funcin objetivo que se asigna a los individuos cuya evaluacin falla.
+Debe ser un valor malo, pero finito, para no alterar las medidas del algoritmo.
+\param numProcesos Nmero de procesos. Con 0 se usa el nmero de ncleos del equipo.
+\param lote Mximo nmero de individuos que se envan a un proceso antes de recibir sus respuestas.
+\param tiempoMaximo Tiempo mximo de evaluacin de un individuo, en segundos. Con 0 no hay lmite.*/
+EvaluadorProcesos::EvaluadorProcesos(const char *comando, double valorFallo, int numProcesos, int lote, double tiempoMaximo)
+{
+	m_pComando = new char[strlen(comando)+1];
+	strcpy(m_pComando, comando);
+	m_ValorFallo = valorFallo;
+	m_numProcesosSolicitados = numProcesos;
+	m_numProcesos = 0;
+	m_Lote = lote>0 ? lote : 1;
+	m_TiempoMaximo = tiempoMaximo;
+	m_pProcesos = NULL;
+	m_pEsperas = NULL;
+	m_pIndices = NULL;
+	m_enviados = 0;
+	m_pTexto = NULL;
+	m_capTexto = 0;
+	m_tamTexto = 0;
+	m_pValores = NULL;
+	m_capValores = 0;
+	m_pManejadorSIGPIPE = SIG_DFL;
+}
+
+
+EvaluadorProcesos::~EvaluadorProcesos()
+{
+	finalizar();
+	delete[] m_pComando;
+	delete[] m_pTexto;
+	delete[] m_pValores;
+}
+
+
+/*!Mientras el evaluador est iniciado se ignora la seal SIGPIPE, para que la escritura a un
+proceso que termin se detecte como un error y no termine el programa.*/
+void EvaluadorProcesos::iniciar(AlgoritmoGenetico *)
+{
+	finalizar();
+
+	int numProcesos = m_numProcesosSolicitados;
+	if(numProcesos <= 0)
+		numProcesos = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if(numProcesos <= 0)
+		numProcesos = 1;
+
+	m_pManejadorSIGPIPE = signal(SIGPIPE, SIG_IGN);
+	m_numProcesos = numProcesos;
+	m_pProcesos = new Proceso[numProcesos];
+	m_pEsperas = new struct pollfd[numProcesos];
+	m_pIndices = new int[numProcesos];
+	for(int i=0; i<numProcesos; i++)
+		lanzar(m_pProcesos[i]);
+}
+
+
+/*!\param pInd Apuntador al individuo a evaluar.*/
+void EvaluadorProcesos::enviar(Individuo *pInd)
+{
+	m_Pendientes.push_back(pInd);
+	m_enviados++;
+}
+
+
+/*!Los individuos pendientes se envan a los procesos al invocar esta funcin, de modo que
+los enviados uno tras otro con \a enviar() forman lotes.
+\param esperar Si es true y an no ha terminado ninguna evaluacin, espera hasta que termine alguna.
+\return Apuntador al individuo evaluado, o NULL si no hay ninguno disponible o si no hay individuos en evaluacin.*/
+Individuo* EvaluadorProcesos::recibir(bool esperar)
+{
+	despachar();
+	if(m_Listos.empty() && m_enviados > 0)
+	{
+		atender(false);
+		while(esperar && m_Listos.empty())
+		{
+			despachar();
+			atender(true);
+		}
+	}
+	if(m_Listos.empty())
+		return NULL;
+	Individuo *pInd = m_Listos.front();
+	m_Listos.pop_front();
+	m_enviados--;
+	return pInd;
+}
+
+
+/*!Los procesos se terminan con SIGKILL. Los individuos que no se hayan recibido se descartan.*/
+void EvaluadorProcesos::finalizar()
+{
+	if(m_pProcesos)
+	{
+		for(int i=0; i<m_numProcesos; i++)
+			detener(m_pProcesos[i]);
+		delete[] m_pProcesos;
+		delete[] m_pEsperas;
+		delete[] m_pIndices;
+		m_pProcesos = NULL;
+		m_pEsperas = NULL;
+		m_pIndices = NULL;
+		signal(SIGPIPE, m_pManejadorSIGPIPE);
+	}
+	m_numProcesos = 0;
+	m_Pendientes.clear();
+	m_Listos.clear();
+	m_enviados = 0;
+}
+
+
+/*!Conecta la entrada y la salida estndar del programa a dos tuberas. Los extremos que
+conserva el evaluador se cierran automticamente al lanzar los dems procesos.
+\param p Proceso a lanzar.
+\return true si el proceso se pudo lanzar.*/
+bool EvaluadorProcesos::lanzar(Proceso &p)
+{
+	p.pid = -1;
+	p.fdEscritura = -1;
+	p.fdLectura = -1;
+	p.tamBuffer = 0;
+
+	int entrada[2], salida[2];
+	if(pipe(entrada) != 0)
+		return false;
+	if(pipe(salida) != 0)
+	{
+		close(entrada[0]);
+		close(entrada[1]);
+		return false;
+	}
+
+	pid_t pid = fork();
+	if(pid < 0)
+	{
+		close(entrada[0]);
+		close(entrada[1]);
+		close(salida[0]);
+		close(salida[1]);
+		return false;
+	}
+	if(pid == 0)
+	{
+		dup2(entrada[0], 0);
+		dup2(salida[1], 1);
+		close(entrada[0]);
+		close(entrada[1]);
+		close(salida[0]);
+		close(salida[1]);
+		execl("/bin/sh", "sh", "-c", m_pComando, (char*)NULL);
+		_exit(127);
+	}
+
+	close(entrada[0]);
+	close(salida[1]);
+	fcntl(entrada[1], F_SETFD, FD_CLOEXEC);
+	fcntl(salida[0], F_SETFD, FD_CLOEXEC);
+	fcntl(salida[0], F_SETFL, fcntl(salida[0], F_GETFL) | O_NONBLOCK);
+
+	p.pid = pid;
+	p.fdEscritura = entrada[1];
+	p.fdLectura = salida[0];
+	return true;
+}
+
+
+/*!\param p Proceso a terminar. Conserva sus individuos en curso.*/
+void EvaluadorProcesos::detener(Proceso &p)
+{
+	if(p.pid < 0)
+		return;
+	close(p.fdEscritura);
+	close(p.fdLectura);
+	kill(p.pid, SIGKILL);
+	while(waitpid(p.pid, NULL, 0) < 0 && errno == EINTR)
+		;
+	p.pid = -1;
+}
+
+
+/*!As, cada falla cuesta la evaluacin de un solo individuo y la optimizacin siempre avanza,
+aunque el programa no pueda ejecutarse.
+\param p Proceso que fall.*/
+void EvaluadorProcesos::fallar(Proceso &p)
+{
+	detener(p);
+	if(!p.EnCurso.empty())
+	{
+		Individuo *pInd = p.EnCurso.front();
+		p.EnCurso.pop_front();
+		pInd->asignarObjetivo(m_ValorFallo);
+		m_Listos.push_back(pInd);
+	}
+	while(!p.EnCurso.empty())
+	{
+		m_Pendientes.push_front(p.EnCurso.back());
+		p.EnCurso.pop_back();
+	}
+	lanzar(p);
+}
+
+
+/*!Los individuos cuya funcin objetivo ya est actualizada pasan directamente a la cola de
+evaluados. Si no hay ningn proceso en ejecucin, los pendientes reciben \a m_ValorFallo.*/
+void EvaluadorProcesos::despachar()
+{
+	bool hayProcesos = false;
+	for(int i=0; i<m_numProcesos && !m_Pendientes.empty(); i++)
+	{
+		Proceso &p = m_pProcesos[i];
+		if(p.pid < 0 && !lanzar(p))
+			continue;
+		hayProcesos = true;
+
+		int enCurso = (int)p.EnCurso.size();
+		m_tamTexto = 0;
+		while((int)p.EnCurso.size() < m_Lote && !m_Pendientes.empty())
+		{
+			Individuo *pInd = m_Pendientes.front();
+			m_Pendientes.pop_front();
+			if(pInd->objetivoActualizado())
+			{
+				m_Listos.push_back(pInd);
+				continue;
+			}
+			escribirLinea(*pInd);
+			p.EnCurso.push_back(pInd);
+		}
+		if(m_tamTexto == 0)
+			continue;
+		if(enCurso == 0)
+			p.inicio = __ahoraEvaluador();
+
+		int escritos = 0;
+		while(escritos < m_tamTexto)
+		{
+			ssize_t n = write(p.fdEscritura, m_pTexto+escritos, m_tamTexto-escritos);
+			if(n < 0 && errno == EINTR)
+				continue;
+			if(n <= 0)
+				break;
+			escritos += (int)n;
+		}
+		if(escritos < m_tamTexto)
+			fallar(p);
+	}
+	if(!hayProcesos)
+	{
+		while(!m_Pendientes.empty())
+		{
+			m_Pendientes.front()->asignarObjetivo(m_ValorFallo);
+			m_Listos.push_back(m_Pendientes.front());
+			m_Pendientes.pop_front();
+		}
+	}
+}
+
+
+/*!\param esperar Si es true, espera hasta que algn proceso responda o exceda el tiempo mximo.
+Si es false, solo revisa las respuestas disponibles.*/
+void EvaluadorProcesos::atender(bool esperar)
+{
+	int numEsperas = 0;
+	double ahora = __ahoraEvaluador();
+	double restante = -1.0;
+	for(int i=0; i<m_numProcesos; i++)
+	{
+		Proceso &p = m_pProcesos[i];
+		if(p.pid < 0 || p.EnCurso.empty())
+			continue;
+		m_pEsperas[numEsperas].fd = p.fdLectura;
+		m_pEsperas[numEsperas].events = POLLIN;
+		m_pEsperas[numEsperas].revents = 0;
+		m_pIndices[numEsperas++] = i;
+		if(m_TiempoMaximo > 0.0)
+		{
+			double r = p.inicio + m_TiempoMaximo - ahora;
+			if(restante < 0.0 || r < restante)
+				restante = r>0.0 ? r : 0.0;
+		}
+	}
+	if(numEsperas == 0)
+		return;
+
+	int espera = 0;
+	if(esperar)
+		espera = restante<0.0 ? -1 : (int)ceil(restante*1000.0);
+	if(poll(m_pEsperas, numEsperas, espera) > 0)
+	{
+		for(int k=0; k<numEsperas; k++)
+			if(m_pEsperas[k].revents)
+				leer(m_pProcesos[m_pIndices[k]]);
+	}
+
+	if(m_TiempoMaximo > 0.0)
+	{
+		ahora = __ahoraEvaluador();
+		for(int i=0; i<m_numProcesos; i++)
+		{
+			Proceso &p = m_pProcesos[i];
+			if(p.pid >= 0 && !p.EnCurso.empty() && ahora - p.inicio >= m_TiempoMaximo)
+				fallar(p);
+		}
+	}
+}
+
+
+/*!Cada lnea completa es la respuesta al primer individuo en curso. Si la lnea no empieza
+por un nmero, el individuo recibe \a m_ValorFallo. Si el proceso cerr su salida o escribi
+una lnea demasiado larga, se considera que fall.
+\param p Proceso del que se leen las respuestas.*/
+void EvaluadorProcesos::leer(Proceso &p)
+{
+	ssize_t n = read(p.fdLectura, p.buffer+p.tamBuffer, TAM_BUFFER-1-p.tamBuffer);
+	if(n < 0 && (errno == EAGAIN || errno == EINTR))
+		return;
+	if(n <= 0)
+	{
+		fallar(p);
+		return;
+	}
+	p.tamBuffer += (int)n;
+	p.buffer[p.tamBuffer] = '\0';
+
+	char *pLinea = p.buffer;
+	char *pFin;
+	while((pFin = strchr(pLinea, '\n')) != NULL)
+	{
+		*pFin = '\0';
+		if(!p.EnCurso.empty())
+		{
+			Individuo *pInd = p.EnCurso.front();
+			p.EnCurso.pop_front();
+			char *pResto;
+			double valor = strtod(pLinea, &pResto);
+			pInd->asignarObjetivo(pResto!=pLinea ? valor : m_ValorFallo);
+			m_Listos.push_back(pInd);
+			p.inicio = __ahoraEvaluador();
+		}
+		pLinea = pFin+1;
+	}
+	p.tamBuffer -= (int)(pLinea - p.buffer);
+	memmove(p.buffer, pLinea, p.tamBuffer);
+	if(p.tamBuffer >= TAM_BUFFER-1)
+		fallar(p);
+}
+
+
+/*!Adiciona a \a m_pTexto una lnea con los valores del individuo separados por espacios.
+\param ind Individuo que se enva.*/
+void EvaluadorProcesos::escribirLinea(const Individuo &ind)
+{
+	int numValores = ind.numValores();
+	if(numValores > m_capValores)
+	{
+		delete[] m_pValores;
+		m_capValores = numValores;
+		m_pValores = new double[m_capValores];
+	}
+	ind.getValores(m_pValores);
+
+	//cada valor ocupa a lo sumo 25 caracteres ms el separador
+	int requerido = m_tamTexto + 26*numValores + 2;
+	if(requerido > m_capTexto)
+	{
+		m_capTexto = 2*requerido;
+		char *pNuevo = new char[m_capTexto];
+		if(m_tamTexto > 0)
+			memcpy(pNuevo, m_pTexto, m_tamTexto);
+		delete[] m_pTexto;
+		m_pTexto = pNuevo;
+	}
+	for(int i=0; i<numValores; i++)
+		m_tamTexto += sprintf(m_pTexto+m_tamTexto, i>0 ? " %.17g" : "%.17g", m_pValores[i]);
+	m_pTexto[m_tamTexto++] = '\n';
+}
+
+#endif
+
+
+
+/************************************************************
+          ALGORITMO GENTICO ASNCRONO (Implementacin)
+************************************************************/
+
+
+#if defined(USAR_VENTANA)
+
+	/*!El nmero de hijos en evaluacin se determina al iniciar, segn el evaluador.
+	\param pFrame Apuntador a la ventana de la aplicacin*/
+	AlgoritmoGeneticoAsincrono::AlgoritmoGeneticoAsincrono(AGFrame *pFrame):AlgoritmoGeneticoEstacionario(pFrame)
+	{
+		m_NumHijos = 0;
+		m_pEvaluador = NULL;
+		m_pLibres = NULL;
+		m_numLibres = 0;
+	}
+
+#else
+
+	/*!El nmero de hijos en evaluacin se determina al iniciar, segn el evaluador.*/
+	AlgoritmoGeneticoAsincrono::AlgoritmoGeneticoAsincrono()
+	{
+		m_NumHijos = 0;
+		m_pEvaluador = NULL;
+		m_pLibres = NULL;
+		m_numLibres = 0;
+	}
+
+#endif
+
+
+/*!Termina el evaluador antes de que se destruyan los hijos que pueda estar evaluando.*/
+AlgoritmoGeneticoAsincrono::~AlgoritmoGeneticoAsincrono()
+{
+	terminarEvaluador();
+}
+
+
+/*!Termina el evaluador y luego invoca AlgoritmoGeneticoEstacionario::finalizarOptimizacion().*/
+void AlgoritmoGeneticoAsincrono::finalizarOptimizacion()
+{
+	terminarEvaluador();
+	AlgoritmoGeneticoEstacionario::finalizarOptimizacion();
+}
+
+
+void AlgoritmoGeneticoAsincrono::terminarEvaluador()
+{
+	if(m_pEvaluador)
+	{
+		m_pEvaluador->finalizar();
+		delete m_pEvaluador;
+		m_pEvaluador = NULL;
+	}
+	if(m_pLibres)
+	{
+		delete[] m_pLibres;
+		m_pLibres = NULL;
+	}
+	m_numLibres = 0;
+}
+
+
+/*!Enva todos los individuos de la poblacin al evaluador y espera a recibirlos.*/
+void AlgoritmoGeneticoAsincrono::evaluarPoblacion()
+{
+	int i, tamPob = m_pPoblacionActual->getTam();
+	for(i=0; i<tamPob; i++)
+		m_pEvaluador->enviar( &m_pPoblacionActual->getIndividuoDirecto(i) );
+	for(i=0; i<tamPob; i++)
+		m_pEvaluador->recibir(true);
+}
+
+
+/*!En la primera iteracin crea el evaluador por defecto si no se defini otro, crea y
+evala la poblacin, y crea los hijos. En las siguientes:
+- Crea un hijo en cada uno de los individuos libres y lo enva al evaluador.
+- Espera a recibir un hijo evaluado y recibe tambin los dems que ya estn evaluados.
+- Inserta cada hijo recibido en la poblacin y lo deja libre para la siguiente iteracin.
+
+Al final invoca \a terminarIteracion().*/
+void AlgoritmoGeneticoAsincrono::iterarOptimizacion()
+{
+	MemoriaAG::activar(m_pMemoria);
+	if(m_Generacion==0)
+	{
+		if(!m_pEvaluador)
+		{
+#if defined(UN_CPP11)
+			m_pEvaluador = new EvaluadorHilos;
+#else
+			m_pEvaluador = new EvaluadorLocal;
+#endif
+		}
+		m_pEvaluador->iniciar(this);
+		if(m_NumHijos < 1)
+			m_NumHijos = 2*m_pEvaluador->getCapacidad();
+
+		crearPoblacion();
+		evaluarPoblacion();
+		crearHijos();
+
+		int numHijos = m_pHijos->getSize();
+		m_pLibres = new Individuo*[numHijos];
+		for(m_numLibres=0; m_numLibres<numHijos; m_numLibres++)
+			m_pLibres[m_numLibres] = &m_pHijos->getObjDirecto(m_numLibres);
+	}
+	else
+	{
+		while(m_numLibres > 0)
+		{
+			Individuo *pHijo = m_pLibres[--m_numLibres];
+			crearHijo(*pHijo);
+			m_pEvaluador->enviar(pHijo);
+		}
+
+		m_SumaHijos = 0.0;
+		m_HijosEnIteracion = 0;
+		Individuo *pHijo = m_pEvaluador->recibir(true);
+		while(pHijo)
+		{
+			insertarHijo(*pHijo);
+			m_pLibres[m_numLibres++] = pHijo;
+			pHijo = m_pEvaluador->recibir(false);
+		}
+		revisarReconstruccion();
+	}
+	terminarIteracion();
+}
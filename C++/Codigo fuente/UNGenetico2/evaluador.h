@@ -0,0 +1,466 @@
+#ifndef __EVALUADOR_H
+#define __EVALUADOR_H
+
+#include "genetico.h"
+#include "tareas.h"
+
+#if defined(UN_CPP11)
+#	include <thread>
+#	include <condition_variable>
+#endif
+
+#if defined(UN_CPP11) || defined(UN_PROCESOS)
+#	include <deque>
+#endif
+
+#if defined(UN_PROCESOS)
+#	include <sys/types.h>
+#	include <sys/wait.h>
+#	include <unistd.h>
+#	include <fcntl.h>
+#	include <signal.h>
+#	include <errno.h>
+#	include <poll.h>
+#endif
+
+
+/************************************************************
+                      EVALUADORES
+************************************************************/
+
+//!Clase abstracta que calcula la funcin objetivo de los individuos por fuera del flujo principal del algoritmo
+/*!Los individuos se entregan con \a enviar() y se recogen, ya evaluados, con \a recibir(),
+no necesariamente en el mismo orden en que se enviaron. Mientras un individuo est en el
+evaluador, el algoritmo no debe modificarlo ni destruirlo.
+Lo utiliza AlgoritmoGeneticoAsincrono.*/
+class Evaluador
+{
+public:
+	//!Constructor por defecto
+	Evaluador(){}
+
+	//!Destructor
+	/*!Es virtual para poder definirse en las clases derivadas*/
+	virtual ~Evaluador(){}
+
+	//!Prepara el evaluador para evaluar individuos del algoritmo \a pAG
+	/*!Debe definirse en las clases derivadas
+	\param pAG Apuntador al algoritmo gentico al que pertenecen los individuos.*/
+	virtual void iniciar(AlgoritmoGenetico *pAG)=0;
+
+	//!Entrega un individuo para calcular su funcin objetivo
+	/*!Debe definirse en las clases derivadas. No espera a que termine la evaluacin.
+	\param pInd Apuntador al individuo a evaluar.*/
+	virtual void enviar(Individuo *pInd)=0;
+
+	//!Retorna un individuo cuya evaluacin termin
+	/*!Debe definirse en las clases derivadas
+	\param esperar Si es true y an no ha terminado ninguna evaluacin, espera hasta que termine alguna.
+	\return Apuntador al individuo evaluado, o NULL si no hay ninguno disponible o si no hay individuos en evaluacin.*/
+	virtual Individuo* recibir(bool esperar)=0;
+
+	//!Termina las evaluaciones en curso y libera los recursos del evaluador
+	/*!Debe definirse en las clases derivadas. Los individuos enviados que no se hayan recibido dejan de
+	pertenecer al evaluador.*/
+	virtual void finalizar()=0;
+
+	//!Calcula la funcin objetivo de un grupo de individuos y espera a que terminen todos
+	/*!Lo utiliza AlgoritmoGeneticoCelular para los hijos de cada color. Por defecto enva todos los
+	individuos y luego los recibe todos; no debe invocarse mientras haya individuos enviados sin recibir.
+	\param ppInd Apuntadores a los individuos.
+	\param num Nmero de individuos.*/
+	virtual void evaluarLote(Individuo **ppInd, int num)
+	{
+		int i;
+		for(i=0; i<num; i++)
+			enviar(ppInd[i]);
+		for(i=0; i<num; i++)
+			recibir(true);
+	}
+
+	//!Retorna el nmero de individuos que el evaluador puede evaluar a la vez
+	virtual int getCapacidad() const
+	{
+		return 1;
+	}
+};
+
+
+//!Clase derivada de Evaluador que calcula la funcin objetivo en el mismo hilo del algoritmo
+/*!La evaluacin se hace al momento de enviar el individuo. Es el evaluador por defecto
+cuando el compilador no soporta C++11.*/
+class EvaluadorLocal:public Evaluador
+{
+public:
+	//!Constructor
+	EvaluadorLocal(){}
+
+	//!Destructor
+	~EvaluadorLocal()
+	{
+		finalizar();
+	}
+
+	//!No requiere preparacin
+	void iniciar(AlgoritmoGenetico *){}
+
+	//!Calcula la funcin objetivo del individuo
+	void enviar(Individuo *pInd)
+	{
+		pInd->objetivo();
+		m_Listos.Adicionar(pInd);
+	}
+
+	//!Retorna el ltimo individuo evaluado
+	Individuo* recibir(bool)
+	{
+		int tam = m_Listos.getSize();
+		return tam>0 ? m_Listos.Detach(tam-1) : (Individuo*)NULL;
+	}
+
+	//!Olvida los individuos no recibidos
+	void finalizar()
+	{
+		m_Listos.FlushDetach();
+	}
+
+protected:
+	//!Individuos evaluados. No pertenecen al arreglo
+	Arreglo<Individuo> m_Listos;
+};
+
+
+#if defined(UN_CPP11)
+
+//!Clase derivada de Evaluador que calcula la funcin objetivo en varios hilos
+/*!Cada individuo enviado es una tarea de un PoolTareas. Cada trabajador del pool tiene su propia
+instancia del algoritmo, creada con AlgoritmoGenetico::crearInstancia(), en la que decodifica los
+individuos y evala la funcin objetivo. Los individuos evaluados se dejan en una cola, sin esperar
+a los dems, y como los trabajadores se roban las tareas, las evaluaciones costosas no retrasan a
+las dems. Si el algoritmo no puede crear instancias, los individuos se evalan en el hilo del algoritmo.
+
+Con \a numHilos igual a 0 y sin \a afinidad se usa el pool global (Ver PoolTareas::global()),
+compartido con los dems evaluadores; de lo contrario el evaluador crea su propio pool. Con
+AFINIDAD_NODO los trabajadores se fijan al nodo del algoritmo (Ver AlgoritmoGenetico::m_NodoNUMA).
+
+La funcin objetivo no debe modificar variables globales ni datos compartidos entre instancias.
+Solo est disponible al compilar con C++11 o posterior.*/
+class EvaluadorHilos:public Evaluador
+{
+public:
+	//!Constructor
+	EvaluadorHilos(int numHilos=0, int afinidad=AFINIDAD_NINGUNA);
+
+	//!Destructor. Espera a que terminen las evaluaciones en curso
+	~EvaluadorHilos();
+
+	//!Crea las instancias del algoritmo y, si es necesario, el pool
+	void iniciar(AlgoritmoGenetico *pAG);
+
+	//!Enva al pool la evaluacin del individuo
+	void enviar(Individuo *pInd);
+
+	//!Retorna un individuo de la cola de evaluados
+	Individuo* recibir(bool esperar);
+
+	//!Espera a que terminen las evaluaciones en curso y destruye las instancias
+	void finalizar();
+
+	//!Reparte el grupo de individuos en bloques entre los trabajadores y espera a que terminen
+	void evaluarLote(Individuo **ppInd, int num);
+
+	//!Retorna el nmero de trabajadores del pool
+	int getCapacidad() const
+	{
+		return m_numHilos>0 ? m_numHilos : 1;
+	}
+
+protected:
+	//!Tarea que evala un individuo
+	class TareaEvaluar:public Tarea
+	{
+	public:
+		//!Constructor
+		TareaEvaluar(EvaluadorHilos *pEvaluador, Individuo *pInd):m_pEvaluador(pEvaluador), m_pInd(pInd){}
+
+		//!Evala el individuo con la instancia del trabajador
+		void ejecutar(int trabajador)
+		{
+			m_pEvaluador->evaluar(m_pInd, trabajador);
+		}
+
+	protected:
+		//!Evaluador que envi la tarea
+		EvaluadorHilos *m_pEvaluador;
+		//!Individuo a evaluar
+		Individuo *m_pInd;
+	};
+
+	//!Evala un individuo en la instancia del trabajador \a trabajador y lo deja en la cola de evaluados
+	void evaluar(Individuo *pInd, int trabajador);
+
+	//!Decodifica el individuo en la instancia del trabajador \a trabajador y calcula su funcin objetivo
+	void calcular(Individuo *pInd, int trabajador);
+
+	//!Nmero de hilos solicitado. Con 0 se usa el pool global
+	int m_numHilosSolicitados;
+	//!Forma en que se fijan a los ncleos los trabajadores del pool propio
+	int m_Afinidad;
+	//!Nmero de trabajadores del pool, o 0 si no se ha iniciado
+	int m_numHilos;
+	//!Pool en el que se evalan los individuos
+	PoolTareas *m_pPool;
+	//!Pool creado por el evaluador, o NULL si se usa el pool global
+	PoolTareas *m_pPoolPropio;
+	//!Instancias del algoritmo, una por trabajador del pool
+	AlgoritmoGenetico **m_pInstancias;
+	//!Individuos evaluados
+	std::deque<Individuo*> m_Listos;
+	//!Nmero de individuos enviados que no se han recibido
+	int m_enviados;
+	//!Nmero de evaluaciones enviadas al pool que no han terminado
+	int m_enCurso;
+	//!Indica a las tareas pendientes que no deben evaluar
+	bool m_cancelar;
+	//!Protege las colas y los contadores
+	std::mutex m_candado;
+	//!Avisa que termin una evaluacin
+	std::condition_variable m_hayListos;
+};
+
+#endif
+
+
+#if defined(UN_PROCESOS)
+
+//!Clase derivada de Evaluador que calcula la funcin objetivo con programas externos
+/*!Al iniciar, lanza \a numProcesos copias de un programa (por ejemplo un simulador) que
+permanecen en ejecucin durante toda la optimizacin. El programa se ejecuta con \c /bin/sh,
+de modo que el comando puede incluir argumentos.
+
+El protocolo es de lneas de texto:
+- Por cada individuo, el evaluador escribe en la entrada estndar del programa una lnea
+con los valores de sus genes separados por espacios (Ver Individuo::getValores()).
+- Por cada lnea recibida, el programa debe escribir en su salida estndar una lnea con el
+valor de la funcin objetivo, en el mismo orden, y vaciar el buffer de salida (\c fflush).
+
+A cada proceso se le envan lotes de hasta \a lote individuos en una sola escritura; los dems
+esperan en una cola hasta que algn proceso termine. Si un proceso termina inesperadamente,
+escribe una respuesta invlida o tarda ms de \a tiempoMaximo segundos en responder por
+un individuo, a ese individuo se le asigna \a valorFallo, el proceso se detiene y se lanza de
+nuevo, y los dems individuos que tena se envan otra vez.
+La funcin \a objetivo() del algoritmo no se utiliza.
+
+Solo est disponible en sistemas POSIX (Ver UN_PROCESOS).*/
+class EvaluadorProcesos:public Evaluador
+{
+public:
+	//!Constructor
+	EvaluadorProcesos(const char *comando, double valorFallo, int numProcesos=0, int lote=1, double tiempoMaximo=0.0);
+
+	//!Destructor. Termina los procesos
+	~EvaluadorProcesos();
+
+	//!Lanza los procesos
+	void iniciar(AlgoritmoGenetico *pAG);
+
+	//!Adiciona un individuo a la cola de pendientes
+	void enviar(Individuo *pInd);
+
+	//!Enva los pendientes a los procesos y retorna un individuo evaluado
+	Individuo* recibir(bool esperar);
+
+	//!Termina los procesos
+	void finalizar();
+
+	//!Retorna el nmero de individuos que pueden estar a la vez en los procesos
+	int getCapacidad() const
+	{
+		return m_numProcesos*m_Lote;
+	}
+
+protected:
+	enum { TAM_BUFFER = 256 };
+
+	//!Informacin de uno de los procesos lanzados
+	struct Proceso
+	{
+		//!Identificador del proceso. Es -1 si no est en ejecucin
+		pid_t pid;
+		//!Extremo de escritura de la tubera conectada a la entrada estndar del proceso
+		int fdEscritura;
+		//!Extremo de lectura de la tubera conectada a la salida estndar del proceso
+		int fdLectura;
+		//!Individuos enviados al proceso, en el orden en que se enviaron
+		std::deque<Individuo*> EnCurso;
+		//!Momento en que comenz la evaluacin del primer individuo en curso
+		double inicio;
+		//!Respuesta parcial leda del proceso
+		char buffer[TAM_BUFFER];
+		//!Nmero de caracteres en \a buffer
+		int tamBuffer;
+	};
+
+	//!Lanza el programa en el proceso \a p
+	bool lanzar(Proceso &p);
+
+	//!Termina el proceso \a p
+	void detener(Proceso &p);
+
+	//!Asigna \a m_ValorFallo al primer individuo en curso de \a p, devuelve los dems a la cola y relanza el proceso
+	void fallar(Proceso &p);
+
+	//!Enva a cada proceso los individuos pendientes que le caben
+	void despachar();
+
+	//!Espera respuestas de los procesos y revisa los tiempos mximos
+	void atender(bool esperar);
+
+	//!Lee las respuestas disponibles del proceso \a p
+	void leer(Proceso &p);
+
+	//!Escribe en la lnea de texto que se enva los valores del individuo
+	void escribirLinea(const Individuo &ind);
+
+	//!Comando que se ejecuta en cada proceso
+	char *m_pComando;
+	//!Valor de la funcin objetivo de los individuos cuya evaluacin falla
+	double m_ValorFallo;
+	//!Nmero de procesos solicitado. Con 0 se usa el nmero de ncleos del equipo
+	int m_numProcesosSolicitados;
+	//!Nmero de procesos
+	int m_numProcesos;
+	//!Mximo nmero de individuos en curso en cada proceso
+	int m_Lote;
+	//!Tiempo mximo de evaluacin de un individuo, en segundos. Con 0 no hay lmite
+	double m_TiempoMaximo;
+	//!Procesos lanzados
+	Proceso *m_pProcesos;
+	//!Descriptores que se revisan con \c poll()
+	struct pollfd *m_pEsperas;
+	//!Proceso al que corresponde cada descriptor de \a m_pEsperas
+	int *m_pIndices;
+	//!Individuos que no se han enviado a ningn proceso
+	std::deque<Individuo*> m_Pendientes;
+	//!Individuos evaluados
+	std::deque<Individuo*> m_Listos;
+	//!Nmero de individuos enviados que no se han recibido
+	int m_enviados;
+	//!Texto que se escribe a un proceso
+	char *m_pTexto;
+	//!Capacidad de \a m_pTexto
+	int m_capTexto;
+	//!Longitud del texto en \a m_pTexto
+	int m_tamTexto;
+	//!Valores de un individuo
+	double *m_pValores;
+	//!Capacidad de \a m_pValores
+	int m_capValores;
+	//!Manejador de SIGPIPE anterior a \a iniciar()
+	void (*m_pManejadorSIGPIPE)(int);
+};
+
+#endif
+
+
+/************************************************************
+               ALGORITMO GENTICO ASNCRONO
+************************************************************/
+
+//!Clase derivada de AlgoritmoGeneticoEstacionario que evala los hijos de forma asncrona
+/*!En lugar de esperar a que se evalen todos los hijos de una iteracin, el algoritmo mantiene
+\a m_NumHijos hijos en evaluacin en el Evaluador. En cada iteracin:
+- Completa con nuevos hijos los que estn en evaluacin.
+- Espera a que termine al menos una evaluacin, y recibe todas las que hayan terminado.
+- Inserta cada hijo evaluado en la poblacin tan pronto lo recibe (Ver AlgoritmoGeneticoEstacionario).
+
+As, los hilos de evaluacin nunca esperan a que termine el individuo ms lento de una generacin.
+La poblacin inicial tambin se evala con el evaluador.
+
+Por defecto se usa EvaluadorHilos con un hilo por ncleo (EvaluadorLocal si el compilador no
+soporta C++11), y \a m_NumHijos es el doble de la capacidad del evaluador. El evaluador puede
+cambiarse en \a definirOperadores() con la macro DEFINIR_EVALUADOR.
+Normalmente se declara con la macro DECLARAR_ALGORITMO_ASINCRONO.*/
+class AlgoritmoGeneticoAsincrono:public AlgoritmoGeneticoEstacionario
+{
+public:
+
+#if defined(USAR_VENTANA)
+
+	//!Constructor cuando se usa el entorno grfico (Debe estar definida la constante USAR_VENTANA)
+	AlgoritmoGeneticoAsincrono(AGFrame *pFrame);
+
+#else
+
+	//!Constructor por defecto.
+	AlgoritmoGeneticoAsincrono();
+
+#endif
+
+	//!Destructor
+	~AlgoritmoGeneticoAsincrono();
+
+	//!Recibe los hijos evaluados y enva nuevos hijos al evaluador
+	void iterarOptimizacion();
+
+	//!Finaliza el algoritmo gentico, terminando antes el evaluador
+	void finalizarOptimizacion();
+
+	//!Evaluador de los individuos. Si no se define en \a definirOperadores(), se crea el evaluador por defecto
+	Evaluador *m_pEvaluador;
+
+protected:
+	//!Evala la poblacin inicial con el evaluador
+	void evaluarPoblacion();
+
+	//!Destruye el evaluador
+	void terminarEvaluador();
+
+	//!Hijos que no estn en el evaluador
+	Individuo **m_pLibres;
+	//!Nmero de hijos que no estn en el evaluador
+	int m_numLibres;
+};
+
+
+//!Macro que define el evaluador que emplear AlgoritmoGeneticoAsincrono
+/*!Se usa en \a definirOperadores().
+\param tipoEvaluador Especifica el tipo de evaluador a utilizar junto con sus parmetros iniciales.*/
+#define DEFINIR_EVALUADOR(tipoEvaluador)				\
+	{													\
+		if(m_pEvaluador) delete m_pEvaluador;			\
+		m_pEvaluador=new tipoEvaluador;					\
+	}
+
+
+//!Macro que crea una nueva clase derivada de AlgoritmoGeneticoAsincrono
+/*!Es equivalente a DECLARAR_ALGORITMO_ESTACIONARIO, pero los hijos se evalan de forma
+asncrona (Ver AlgoritmoGeneticoAsincrono).
+La declaracin se termina con FIN_DECLARAR_ALGORITMO.
+\param nombreAlgoritmo Nombre de la nueva clase.*/
+#if defined(USAR_VENTANA)
+
+#define DECLARAR_ALGORITMO_ASINCRONO(nombreAlgoritmo)							\
+	class nombreAlgoritmo : public AlgoritmoGeneticoAsincrono					\
+	{																			\
+	public:																		\
+		nombreAlgoritmo(AGFrame* pFrame):AlgoritmoGeneticoAsincrono(pFrame){}	\
+		AlgoritmoGenetico* crearInstancia(){ return new nombreAlgoritmo(m_pFrame); }	\
+		void codificacion(Individuo * pInd ,int estado);						\
+		double objetivo();
+
+#else
+
+#define DECLARAR_ALGORITMO_ASINCRONO(nombreAlgoritmo)				\
+	class nombreAlgoritmo : public AlgoritmoGeneticoAsincrono		\
+	{																\
+	public:															\
+		nombreAlgoritmo(){}											\
+		AlgoritmoGenetico* crearInstancia(){ return new nombreAlgoritmo; }	\
+		void codificacion(Individuo * pInd ,int estado);			\
+		double objetivo();
+
+#endif
+
+
+#endif
@@ -7,6 +7,9 @@
 
 #pragma warning(push, 3)	//Evita  "warning(level 4) C4100" ocasionada por parmetros de funciones no referenciados
 
+template<class G, class T> class OperadorMutacionArreglo;
+template<class G, class T> class OperadorCruceArreglo;
+
 
 /************************************************************
                       GEN ARREGLO
@@ -17,7 +20,11 @@
 /*!Se utiliza para representar y almacenar la informacin gentica de variables 
 cuya codificacin se realiza con un arreglo de datos que pueden se enteros, 
 reales o booleanos.
-G puede ser GenBool, GenEntero o GenReal. T puede ser bool, long o double.*/
+G puede ser GenBool, GenEntero o GenReal. T puede ser bool, long o double.
+
+Los datos se almacenan como valores de tipo T en un bloque contiguo de memoria, cuya
+capacidad se reutiliza al cambiar el tamao del arreglo. Los lmites de tamao y de valor
+se guardan una sola vez por gen, de modo que los elementos no son objetos G individuales.*/
 template<class G, class T>
 class GenArreglo:public Gen
 {
@@ -48,15 +55,58 @@ public:
 		operator=(*((const GenArreglo<G,T>*)(&origen)));
 	}
 
+	//!Retorna la distancia promedio entre los datos de dos arreglos
+	double distancia(const Gen& otro) const;
+
+	//!El gen se representa con un valor por cada dato del arreglo
+	int numValores() const
+	{
+		return m_items;
+	}
+
+	//!Escribe los datos del arreglo
+	void getValores(double *pDestino) const
+	{
+		for(int i=0; i<m_items; i++)
+			pDestino[i] = (double)m_pDatos[i];
+	}
+
+	//!Cambia el tamao del arreglo a \a numValores y le asigna los valores de \a pOrigen
+	void setValores(const double *pOrigen, int numValores)
+	{
+		setTam(numValores);
+		for(int i=0; i<m_items; i++)
+			setVal(i, (T)pOrigen[i]);
+	}
+
 	//!Operador de asignacin a partir de otro objeto GenArreglo<G,T>	
 	const GenArreglo<G,T>& operator = ( const GenArreglo<G,T>& origen);
 
 	//!Operador de asignacin a partir de un objeto Arreglo<T>
 	const GenArreglo<G,T>& operator = ( const Arreglo<T>& origen );
 
+	//!Operador de asignacin a partir de un objeto VistaArreglo<T>
+	const GenArreglo<G,T>& operator = ( const VistaArreglo<T>& origen );
+
 	//!Convierte el objeto GenArreglo<G,T> en un objeto Arreglo<T>
 	void convertArreglo(Arreglo<T> &destino) const;
 
+	//!Decodifica el gen copiando sus datos en un objeto Arreglo<T>
+	/*!Es equivalente a \a convertArreglo().
+	\param destino Referencia al arreglo destino*/
+	void decodificar(Arreglo<T> &destino) const
+	{
+		convertArreglo(destino);
+	}
+
+	//!Decodifica el gen haciendo que \a destino apunte a sus datos, sin copiarlos
+	/*!La vista es vlida mientras el gen no cambie de tamao ni sea destruido.
+	\param destino Referencia a la vista destino*/
+	void decodificar(VistaArreglo<T> &destino) const
+	{
+		destino.asignar(m_pDatos, m_items);
+	}
+
     //!Destructor.
     ~GenArreglo();
 	
@@ -71,50 +121,111 @@ public:
 	
 	//!Retorna un objeto correspondiente al operador de cruce establecido por defecto para genes de tipo arreglo
     OperadorCruce *operadorCruceDefecto() const;
+
+	//!Tipo del operador de mutacin por defecto para genes de tipo arreglo
+	typedef OperadorMutacionArreglo<G,T> TipoOperadorMutacionDefecto;
+
+	//!Tipo del operador de cruce por defecto para genes de tipo arreglo
+	typedef OperadorCruceArreglo<G,T> TipoOperadorCruceDefecto;
 	
-	//!Retorna el apuntador al gen indicado por \a pos en el arreglo de genes
+	//!Retorna el valor actual del dato en la posicin \a pos del arreglo
 	/*!
-	\param pos Posicin dentro del arreglo de genes
-	\return Apuntador al Gen en la posicin \a pos*/
-	G& getGen(int pos) const
+	\param pos Posicin dentro del arreglo. Se restringe al rango de posiciones vlidas.
+	\return Valor actual del dato en la posicin \a pos*/
+	T getVal(int pos) const
 	{
-		return m_pArregloGen->getObj(pos);
+		return m_pDatos[ restringir(pos, 0, m_items-1) ];
 	}
 
-	//!Retorna el valor actual del gen en la posicin \a pos del arreglo de genes
-	/*!
-	\param pos Posicin dentro del arreglo de genes
-	\return Valor actual del gen en la posicin \a pos*/
-	T getVal(int pos) const
+	//!Asigna un nuevo valor al dato ubicado en la posicin \a pos
+	bool setVal(int pos, T valor );
+
+	//!Retorna un apuntador al bloque contiguo de datos del arreglo
+	/*!Solo es vlido mientras no cambie el tamao del arreglo.
+	\return Apuntador al primer dato del arreglo.*/
+	const T* getDatos() const
 	{
-		return m_pArregloGen->getObj(pos).getVal();
+		return m_pDatos;
 	}
 
-	//!Asigna un nuevo valor al gen ubicado en la posicin \a pos
-	bool setVal(int pos, T valor );
+	//!Referencia a un dato del arreglo que se usa como un gen de tipo G
+	/*!Permite que el cdigo escrito cuando los datos se almacenaban como genes siga funcionando:
+	\a setVal() modifica el dato en el arreglo. Es vlida mientras el arreglo exista.*/
+	class ReferenciaGen
+	{
+	public:
+		//!Constructor
+		ReferenciaGen(GenArreglo<G,T> &arreglo, int pos) : m_Arreglo(arreglo), m_Pos(pos) {}
+
+		//!Retorna el valor del dato
+		T getVal() const
+		{
+			return m_Arreglo.getVal(m_Pos);
+		}
+
+		//!Asigna un nuevo valor al dato, restringido a los lmites del arreglo. Retorna el valor asignado
+		T setVal(T nuevoValor)
+		{
+			m_Arreglo.setVal(m_Pos, nuevoValor);
+			return getVal();
+		}
 
-	//!Retorna el GenEntero que almacena el tamao del arreglo variable.	
-	const GenEntero* getGenItems() const
+		//!Retorna un gen de tipo G con los lmites del arreglo y el valor del dato
+		operator G() const
+		{
+			return G(m_Arreglo.getMinVal(), m_Arreglo.getMaxVal(), getVal());
+		}
+
+	private:
+		//!Arreglo al que pertenece el dato
+		GenArreglo<G,T> &m_Arreglo;
+		//!Posicin del dato en el arreglo
+		int m_Pos;
+	};
+
+	//!Retorna una referencia al dato en la posicin \a pos, que se usa como un gen de tipo G
+	/*!\deprecated Los datos ya no se almacenan como genes. Debe usarse \a getVal() o \a setVal().
+	\param pos Posicin dentro del arreglo. Se restringe al rango de posiciones vlidas.
+	\return Referencia cuyas modificaciones cambian el dato en el arreglo.*/
+	ReferenciaGen getGen(int pos)
 	{
-		return m_pGenItems;
+		return ReferenciaGen(*this, restringir(pos, 0, m_items-1));
+	}
+
+	//!Retorna un gen de tipo G con el valor del dato en la posicin \a pos
+	/*!\deprecated Los datos ya no se almacenan como genes. Debe usarse \a getVal().
+	El gen es una copia constante, por lo que no puede modificarse por error.
+	\param pos Posicin dentro del arreglo.
+	\return Gen con los lmites de valor del arreglo y el valor del dato.*/
+	const G getGen(int pos) const
+	{
+		return G(m_valMin, m_valMax, getVal(pos));
+	}
+
+	//!Retorna un GenEntero con el tamao actual del arreglo y sus lmites
+	/*!\deprecated El tamao ya no se almacena como gen, por lo que se retorna una copia.
+	Debe usarse \a getTam(), \a getMinTam() y \a getMaxTam().*/
+	GenEntero getGenItems() const
+	{
+		return GenEntero(m_tamMin, m_tamMax, m_items);
 	}
 
 	//!Retorna el tamao actual del arreglo de genes
 	int getTam() const
 	{
-		return m_pArregloGen->getSize();
+		return m_items;
 	}
 
 	//!Retorna el tamao mnimo del arreglo variable
 	int getMinTam() const
 	{
-		return  m_pGenItems->getMin();
+		return  m_tamMin;
 	}
 
 	//!Retorna el tamao mximo del arreglo variable
 	int getMaxTam() const 
 	{
-		return  m_pGenItems->getMax();
+		return  m_tamMax;
 	}
 
 	//!Retorna el valor mnimo vlido para los datos almacenados en el arreglo de genes
@@ -131,14 +242,26 @@ public:
 	
 protected:
 
-	//!Crea un nuevo objeto del tipo de genes contenidos en el arreglo y retorna su apuntador
-	G* crearGen() const;
+	//!Retorna el valor con el que se crea un nuevo dato del arreglo
+	T valorNuevo(bool aleatorio) const;
+
+	//!Garantiza que el bloque de datos tenga capacidad para \a n elementos
+	void reservar(int n);
+
+	//!Bloque contiguo con los datos del arreglo
+	T *m_pDatos;
+
+	//!Nmero de datos contenidos actualmente en el arreglo
+	int m_items;
 
-	//!Apuntador al GenEntero que almacena el tamao actual del arreglo
-	GenEntero* m_pGenItems;
+	//!Nmero de datos que caben en el bloque \a m_pDatos sin pedir ms memoria
+	int m_capacidad;
 
-    //!Arreglo que contiene la informacion gentica, con genes del tipo especificado por \a G
-    Arreglo<G> *m_pArregloGen;
+	//!Tamao mnimo que puede tomar el arreglo
+	int m_tamMin;
+
+	//!Tamao mximo que puede tomar el arreglo
+	int m_tamMax;
     
 	//!Mnimo valor vlido para los datos contenidos en el arreglo    
     T m_valMin;
@@ -174,11 +297,22 @@ public:
 	\param ProbabilidadMutacion Valor inicial para la probabilidad de mutacin propia del operador. Por defecto es 0.01.	*/
     OperadorMutacionArreglo(double ProbabilidadMutacion=0.01):OperadorMutacion(ProbabilidadMutacion)
 	{
+		m_PrimeraMutacion = -1.0;
 		G gen;
 		m_pOperadorMutacionGenes = gen.operadorMutacionDefecto();		
 		m_pOperadorMutacionGenes->AsignarProbabilidadMutacion(ProbabilidadMutacion);
 	}
 	
+	//!Constructor por copia
+	/*!Crea su propio operador de mutacin para los datos, con la misma probabilidad de mutacin.*/
+    OperadorMutacionArreglo(const OperadorMutacionArreglo& origen):OperadorMutacion(origen.m_ProbabilidadMutacion)
+	{
+		m_PrimeraMutacion = -1.0;
+		G gen;
+		m_pOperadorMutacionGenes = gen.operadorMutacionDefecto();		
+		m_pOperadorMutacionGenes->AsignarProbabilidadMutacion(m_ProbabilidadMutacion);
+	}
+
 	//!Destructor
 	/*!Destruye objetos creados*/
     ~OperadorMutacionArreglo()
@@ -198,16 +332,32 @@ public:
 		return (m_ProbabilidadMutacion = Probabilidad);
 	}
 
+	//!Sin conocer el gen no puede decidirse si algo muta, por lo que siempre retorna \a true (Ver \a decidirMutacionGen())
+	bool decidirMutacion()
+	{
+		return true;
+	}
+
+	//!Decide si muta el tamao o alguno de los datos del arreglo
+	bool decidirMutacionGen(const Gen *pGen);
+
+	//!La mutacin no se decide con un solo nmero aleatorio
+	bool decisionSimple() const
+	{
+		return false;
+	}
+
 	//!Ejecuta una mutacin sobre un objeto de la clase GenArreglo<G,T>
-	void mutar(Gen *pGen);
+	void mutarGen(Gen *pGen);
 	
 protected:
 
-    //!Existe por compatibilidad con la clase base. La mutacin la realiza la funcion \a mutar().
-    void mutarGen(Gen *g){};
-
 	//!Apuntador al operador de mutacion de los genes que hacen parte del arreglo
 	OperadorMutacion* m_pOperadorMutacionGenes;
+
+	//!Primera posicin que muta, elegida en \a decidirMutacionGen(), o -1 si no hay una pendiente
+	/*!La posicin 0 es el tamao y la posicin \a i+1 es el dato \a i.*/
+	double m_PrimeraMutacion;
 };
 
 /*******************************************************************
@@ -217,13 +367,16 @@ protected:
 //!Clase derivada de la clase OperadorCruce usada en genes de tipo arreglo. G puede ser GenBool, GenEntero o GenReal. T puede ser bool, long o double
 /*!Efecta un cruce entre dos genes de tipo arreglo, creando nuevos genes hijos. 
 El tamao de los nuevos genes es definido por el cruce de los tamaos de los padres.
-Cada uno de los genes que hacen parte del nuevo arreglo, se obtiene cruzando 
-los genes de la misma posicin en el arreglo de los padres,
+Cada uno de los datos que hacen parte del nuevo arreglo, se obtiene cruzando 
+los datos de la misma posicin en el arreglo de los padres,
 usando el operador de cruce por defecto para genes de tipo G.
 Si el tamao del nuevo gen es mayor que el tamao del padre de menor tamao, 
 los elementos restantes se copian exactamente del padre de mayor tamao.
 Si el tamao del nuevo gen es an mayor que el tamao de ambos padres, 
-los genes restantes se crean aleatoriamente. */
+los datos restantes se crean aleatoriamente. 
+
+Los tamaos y los datos se cruzan por valor mediante \a cruzarValor(), por lo que 
+no se crean genes intermedios durante el cruce.*/
 template< class G, class T >
 class OperadorCruceArreglo : public OperadorCruce
 {
@@ -232,9 +385,17 @@ public:
     OperadorCruceArreglo()
 	{
 		G gen;
-		m_pOperadorCruceGenes = gen.operadorCruceDefecto();
+		m_pOperadorCruceGenes = (typename G::TipoOperadorCruce*)gen.operadorCruceDefecto();
+		GenEntero g;
+		m_pOperadorCruceTamanos = (GenEntero::TipoOperadorCruce*)g.operadorCruceDefecto();
+	}
+  //!Constructor por copia. Crea sus propios operadores de cruce para los datos y el tamao.
+    OperadorCruceArreglo(const OperadorCruceArreglo&)
+	{
+		G gen;
+		m_pOperadorCruceGenes = (typename G::TipoOperadorCruce*)gen.operadorCruceDefecto();
 		GenEntero g;
-		m_pOperadorCruceTamanos = g.operadorCruceDefecto();
+		m_pOperadorCruceTamanos = (GenEntero::TipoOperadorCruce*)g.operadorCruceDefecto();
 	}
   //!Destructor de la clase OperadorCruceArreglo
     ~OperadorCruceArreglo()
@@ -242,13 +403,26 @@ public:
 		delete m_pOperadorCruceGenes;
 		delete m_pOperadorCruceTamanos;
 	}
+  //!Entrega las funciones objetivo de los padres a los operadores de los datos y del tamao
+    void asignarObjetivos(double mejor, double peor)
+	{
+		OperadorCruce::asignarObjetivos(mejor, peor);
+		m_pOperadorCruceGenes->asignarObjetivos(mejor, peor);
+		m_pOperadorCruceTamanos->asignarObjetivos(mejor, peor);
+	}
   //!Define el proceso de cruce de los genes de tipo arreglo
     void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+  //!Cruza dos genes de tipo arreglo guardando el resultado en un gen hijo existente
+    void cruzarEn(const GenArreglo<G,T>& Mejor, const GenArreglo<G,T>& Peor, GenArreglo<G,T>& Hijo, int hijo, int indice=-1);
+  //!Cruza el gen en varias parejas copiando el resultado en los genes que ya tienen los hijos
+    void cruzarLote(Individuo **ppMejores, Individuo **ppPeores, Individuo **ppHijos1, Individuo **ppHijos2, const int *pIndices, const double *pObjetivos, int numParejas, const int *pPosiciones, int numPosiciones);
 protected:
-	//!Apuntador al operador de cruce de los genes que hacen parte del arreglo
-	OperadorCruce* m_pOperadorCruceGenes;
+	//!Genes en los que se cruza cada pareja antes de copiarse en los hijos, que pueden ser los mismos padres
+	GenArreglo<G,T> m_Temporal[2];
+	//!Apuntador al operador de cruce de los datos que hacen parte del arreglo
+	typename G::TipoOperadorCruce* m_pOperadorCruceGenes;
 	//!Apuntador al operador de cruce para el tamao del arreglo
-	OperadorCruce* m_pOperadorCruceTamanos;
+	GenEntero::TipoOperadorCruce* m_pOperadorCruceTamanos;
 };
 
 
@@ -275,9 +449,12 @@ GenArreglo<G, T>::GenArreglo(int TamanoMinimo, int TamanoMaximo, T ValorMinimo ,
 
 	m_valMax = ValorMaximo;
 	m_valMin = ValorMinimo;
+	m_valInicial = ValorMinimo;
 	m_usarValInicial = false;
-	m_pArregloGen = new Arreglo<G>;
-	m_pGenItems = new GenEntero(TamanoMinimo, TamanoMaximo);
+	m_tamMin = TamanoMinimo;
+	m_tamMax = TamanoMaximo;
+	m_pDatos = NULL;
+	m_items = m_capacidad = 0;
 
 	setTam( (TamanoMinimo+TamanoMaximo)/2, false);
 }
@@ -299,12 +476,14 @@ GenArreglo<G, T>::GenArreglo(int TamanoMinimo, int TamanoMaximo, T ValorMinimo ,
 	if(TamanoMaximo < TamanoMinimo) TamanoMaximo = TamanoMinimo;
 	if(ValorMaximo < ValorMinimo )  ValorMaximo = ValorMinimo;
 
-	m_pArregloGen = new Arreglo<G>;	
 	m_valMax = ValorMaximo;
 	m_valMin = ValorMinimo;
 	m_valInicial = restringir(ValorInicial, ValorMinimo, ValorMaximo);
 	m_usarValInicial = true;
-	m_pGenItems = new GenEntero(TamanoMinimo, TamanoMaximo);
+	m_tamMin = TamanoMinimo;
+	m_tamMax = TamanoMaximo;
+	m_pDatos = NULL;
+	m_items = m_capacidad = 0;
 	setTam( (TamanoMinimo+TamanoMaximo)/2, false);
 }
 
@@ -315,29 +494,32 @@ de otro objeto de la clase GenArreglo.
 template<class G, class T>
 GenArreglo<G, T>::GenArreglo(const GenArreglo<G,T>& origen)
 {
-	m_valMin = origen.m_valMin;
-	m_valMax = origen.m_valMax;
-	m_valInicial = origen.m_valInicial;
-	m_usarValInicial = origen.m_usarValInicial;
-	m_pGenItems = new GenEntero(*origen.m_pGenItems);
-	m_pArregloGen = new Arreglo<G>(*origen.m_pArregloGen);
+	m_pDatos = NULL;
+	m_items = m_capacidad = 0;
+	operator=(origen);
 }
 
 
 
 
-/*!Asigna nuevos valores al gen copiando las propiedades de otro gen del mismo tipo
+/*!Asigna nuevos valores al gen copiando las propiedades de otro gen del mismo tipo.
+Reutiliza el bloque de datos actual si tiene capacidad suficiente.
 \param origen Objeto del que se hace copia
 \return Referencia al objeto actual.*/
 template<class G, class T>
 const GenArreglo<G,T>& GenArreglo<G, T>::operator = ( const GenArreglo<G,T>& origen )
 {
+	if(this == &origen) return *this;
 	m_valMin = origen.m_valMin;
 	m_valMax = origen.m_valMax;
 	m_valInicial = origen.m_valInicial;
 	m_usarValInicial = origen.m_usarValInicial;
-	*m_pGenItems = *origen.m_pGenItems;
-	*m_pArregloGen = *origen.m_pArregloGen;
+	m_tamMin = origen.m_tamMin;
+	m_tamMax = origen.m_tamMax;
+	reservar(origen.m_items);
+	m_items = origen.m_items;
+	for(int i=0; i<m_items; i++)
+		m_pDatos[i] = origen.m_pDatos[i];
 	return *this;
 }
 
@@ -356,12 +538,27 @@ const GenArreglo<G,T>& GenArreglo<G, T>::operator = ( const Arreglo<T>& origen )
 }
 
 
-/*!Destruye todos los objetos contenidos en el arreglo*/
+/*!Asigna nuevos valores al gen copiando los valores de una vista sobre datos de tipo T
+\param origen Vista de la que se toman los valores
+\return Referencia al objeto actual.*/
+template<class G, class T>
+const GenArreglo<G,T>& GenArreglo<G, T>::operator = ( const VistaArreglo<T>& origen )
+{
+	//si la vista apunta a los datos de este mismo gen no hay nada que copiar
+	if(origen.begin() == m_pDatos && origen.getSize() == m_items) return *this;
+	int tam = origen.getSize();
+	setTam(tam);
+	for(int i=0; i<tam && i<m_items; i++)
+		setVal(i, origen[i]  );
+	return *this;
+}
+
+
+/*!Libera el bloque de datos*/
 template<class G, class T>
 GenArreglo<G, T>::~GenArreglo()
 {
-	delete m_pGenItems;
-	delete m_pArregloGen;
+	delete[] m_pDatos;
 }
 
 
@@ -369,55 +566,75 @@ GenArreglo<G, T>::~GenArreglo()
 template<class G, class T>
 void GenArreglo<G, T>::generarAleatorio()
 {
-	int old = m_pGenItems->getVal();
+	int old = m_items;
 	//el nuevo tamao es generado aleatoriamente entre los limites
 	double azar = (double)rand()/(double)RAND_MAX ;
-	int nuevo = redondear(m_pGenItems->getMin() + azar*(m_pGenItems->getMax() - m_pGenItems->getMin()));
+	int nuevo = redondear(m_tamMin + azar*(m_tamMax - m_tamMin));
 	for(int i=0; i<old && i<nuevo; i++)
 	{
-		m_pArregloGen->getObj(i).generarAleatorio();
+		m_pDatos[i] = valorNuevo(true);
 	}
 	setTam(nuevo, true);
 }
 
 
-/*!Si el objeto GenArreglo fue creado utilizando un velor inicial establecido, 
-el nuevo gen se crea usando este mismo valor. De lo contrario se crea con el valor 
-por defecto del tipo G.
-\return Apuntador a un objeto del tipo de genes del arreglo,*/
+/*!Si \a aleatorio es true, el valor se genera aleatoriamente dentro de los lmites.
+Si no, y el objeto GenArreglo fue creado utilizando un valor inicial establecido, 
+se usa este mismo valor. De lo contrario se usa el valor por defecto del tipo G.
+\param aleatorio Indica si se debe generar un valor aleatorio.
+\return Valor para el nuevo dato del arreglo.*/
 template<class G, class T>
-G* GenArreglo<G, T>::crearGen() const
+T GenArreglo<G, T>::valorNuevo(bool aleatorio) const
 {
+	if(aleatorio)
+	{
+		G gen(m_valMin, m_valMax, m_valMin);
+		gen.generarAleatorio();
+		return gen.getVal();
+	}
 	if(m_usarValInicial)
-		return ( new G(m_valMin, m_valMax, m_valInicial) );
-	else
-		return ( new G(m_valMin, m_valMax) );
+		return m_valInicial;
+	G gen(m_valMin, m_valMax);
+	return gen.getVal();
+}
+
+
+/*!Si la capacidad actual es menor que \a n se crea un bloque nuevo, al menos del
+doble de la capacidad anterior sin exceder el tamao mximo, y se copian los datos actuales.
+La capacidad nunca se reduce.
+\param n Nmero de datos que debe poder contener el bloque.*/
+template<class G, class T>
+void GenArreglo<G, T>::reservar(int n)
+{
+	if(n <= m_capacidad) return;
+	int nueva = _MAXIMO(n, _MINIMO(2*m_capacidad, m_tamMax) );
+	T *pNuevo = new T[nueva];
+	for(int i=0; i<m_items; i++)
+		pNuevo[i] = m_pDatos[i];
+	delete[] m_pDatos;
+	m_pDatos = pNuevo;
+	m_capacidad = nueva;
 }
 
 
 
-/*!Si el nuevo tamao es menor que el anterior, se eliminan los genes restantes. Si 
-es mayor, los nuevos genes son creados aleatoriamente dependiendo del valor de 
-\a crearAleatorios
+/*!Si el nuevo tamao es menor que el anterior, se descartan los datos restantes sin
+liberar memoria. Si es mayor, los nuevos datos son creados aleatoriamente dependiendo
+del valor de \a crearAleatorios
 \param nuevoTam Nuevo tamao del arreglo. 
 \param crearAleatorios Si su valor es true se crean genes aleatorios. Si es false se crean genes con valores iniciales preestablecidos
 \return Nuevo tamao del arreglo. */
 template<class G, class T>
 int GenArreglo<G,T>::setTam(int nuevoTam, bool crearAleatorios)
 {	
-	int old=m_pArregloGen->getSize();
+	int old=m_items;
 	if( nuevoTam==old ) return old;	//no hay nada que cambiar
-	nuevoTam = restringir(nuevoTam, (int)m_pGenItems->getMin(), (int)m_pGenItems->getMax() );
+	nuevoTam = restringir(nuevoTam, m_tamMin, m_tamMax );
 
-	m_pArregloGen->asignarMemoria(nuevoTam);
-	*m_pGenItems = nuevoTam;
+	reservar(nuevoTam);
 	for(int i=old; i<nuevoTam; i++)
-	{
-		G *pNuevo = crearGen();
-		if(crearAleatorios) pNuevo->generarAleatorio();
-		m_pArregloGen->Adicionar(pNuevo);
-	}
-	m_pArregloGen->Truncar(nuevoTam, true, false); //eliminar objetos pero no liberar memoria.
+		m_pDatos[i] = valorNuevo(crearAleatorios);
+	m_items = nuevoTam;
 	return nuevoTam;
 }
 
@@ -425,17 +642,38 @@ int GenArreglo<G,T>::setTam(int nuevoTam, bool crearAleatorios)
 /*!Si \a pos no es una posicin vlida en al arreglo, no se asigna 
 el valor especificado.
 \param pos Posicin dentro del arreglo de genes
-\param valor Valor a asignar al gen en la posicin \a pos
+\param valor Valor a asignar al gen en la posicin \a pos. Se restringe al rango [m_valMin, m_valMax].
 \return true si el valor especificado fue asignado, false en caso contrario.*/
 template<class G, class T>
 bool GenArreglo<G,T>::setVal(int pos, T valor )
 {
-	if(pos<0 || pos >= m_pArregloGen->getSize()) return false;
-	m_pArregloGen->getObj(pos) = valor;
+	if(pos<0 || pos >= m_items) return false;
+	m_pDatos[pos] = restringir(valor, m_valMin, m_valMax);
 	return true;
 }
 
 
+/*!Los datos ubicados en la misma posicin se comparan con su diferencia relativa al rango
+[m_valMin, m_valMax]; cada dato presente en solo uno de los arreglos aporta 1.
+\param otro Gen del mismo tipo con el que se compara.
+\return Valor en el intervalo [0, 1].*/
+template<class G, class T>
+double GenArreglo<G,T>::distancia(const Gen& otro) const
+{
+	const GenArreglo<G,T> &arr = *((const GenArreglo<G,T>*)(&otro));
+	int tmenor = _MINIMO(m_items, arr.m_items);
+	int tmayor = _MAXIMO(m_items, arr.m_items);
+	if(tmayor == 0) return 0.0;
+
+	double rango = (double)m_valMax - (double)m_valMin;
+	double suma = (double)(tmayor - tmenor);
+	if(rango > 0.0)
+		for(int i=0; i<tmenor; i++)
+			suma += fabs((double)m_pDatos[i] - (double)arr.m_pDatos[i]) / rango;
+	return suma/tmayor;
+}
+
+
 /*!El arreglo destino toma el mismo tamao del GenArreglo. Los valores del arreglo 
 destino toman los mismos valores de los genes contenidos en el GenArreglo, en sus
 respectivas posiciones.
@@ -443,15 +681,15 @@ respectivas posiciones.
 template<class G, class T>
 void GenArreglo<G,T>::convertArreglo(Arreglo<T> &destino) const
 {
-	int tamg=m_pArregloGen->getSize();
+	int tamg=m_items;
 
 	destino.asignarMemoria(tamg);
 	int j, tam=destino.getSize();
 	for(j=0; j<tam && j<tamg; j++)
-		destino[j] = m_pArregloGen->getObj(j).getVal();
+		destino[j] = m_pDatos[j];
 	for(j=tam; j<tamg; j++)
 	{
-		T* nuevoDato = new T( m_pArregloGen->getObj(j).getVal() );
+		T* nuevoDato = new T( m_pDatos[j] );
 		destino.Adicionar(nuevoDato);
 	}
 	destino.Truncar(tamg);
@@ -483,33 +721,61 @@ OperadorCruce* GenArreglo<G,T>::operadorCruceDefecto() const
 
 
 /*!Mtodo sobrecargado de la clase operador mutacion. 
+El tamao y los datos que mutan se eligen con saltos geomtricos, comenzando en la posicin
+elegida por \a decidirMutacionGen() si la hay. Cada dato que muta se carga en un gen de tipo G
+creado en la pila, se somete al operador de mutacin de los genes y se guarda de nuevo en el arreglo.
 \param pGen Apuntador al objeto de la clase GenArreglo<G,T> que ser sometido a mutacin.
 */
 template< class G, class T >
-void OperadorMutacionArreglo<G, T>::mutar(Gen *pGen)
+void OperadorMutacionArreglo<G, T>::mutarGen(Gen *pGen)
 {
 	GenArreglo<G,T> *gr=(GenArreglo<G,T> *)pGen;
 
-	//decidimos si debe mutar el tamao
-	double azar= (double)rand()/(double)RAND_MAX;
-	if(azar<m_ProbabilidadMutacion)
+	//la posicin 0 es el tamao y las siguientes son los datos
+	double pos = m_PrimeraMutacion;
+	m_PrimeraMutacion = -1.0;
+	if(pos < 0.0)
+		pos = __saltoMutacion(m_ProbabilidadMutacion) - 1.0;
+
+	if(pos < 1.0)
 	{		
 		//obtener aleatoriamente el nuevo tamao	
-		azar = (double)rand()/(double)RAND_MAX ;	
+		double azar = (double)rand()/(double)RAND_MAX ;	
 		int nuevo = redondear(gr->getMinTam() + azar*(gr->getMaxTam() - gr->getMinTam() ) );		
 		//cambiar el tamao creando aleatorios si es necesario
 		gr->setTam(nuevo, true);
+		pos += __saltoMutacion(m_ProbabilidadMutacion);
 	}
 
-	//se hace mutar cada gen dependiendo de su probabilidad de mutacin
+	//solo se visitan los datos que mutan
 	int tam=gr->getTam();
-	for(int i=0; i<tam; i++)
+	T valMin=gr->getMinVal(), valMax=gr->getMaxVal();
+	for(; pos <= tam; pos += __saltoMutacion(m_ProbabilidadMutacion))
 	{
-		m_pOperadorMutacionGenes->mutar( &gr->getGen(i) );
+		int i = (int)pos - 1;
+		G gen(valMin, valMax, gr->getVal(i));
+		m_pOperadorMutacionGenes->aplicarMutacion( &gen );
+		gr->setVal(i, gen.getVal());
 	}
 }
 
 
+/*!Elige la primera posicin que muta con un salto geomtrico (Ver Poblacion::mutar()), contando
+el tamao como la posicin 0 y cada dato como una posicin ms, y la conserva para \a mutarGen().
+\param pGen Apuntador al objeto de la clase GenArreglo<G,T> sobre el que se toma la decisin.
+\return \a true si muta el tamao o alguno de los datos.*/
+template< class G, class T >
+bool OperadorMutacionArreglo<G, T>::decidirMutacionGen(const Gen *pGen)
+{
+	const GenArreglo<G,T> *gr=(const GenArreglo<G,T> *)pGen;
+	m_PrimeraMutacion = __saltoMutacion(m_ProbabilidadMutacion) - 1.0;
+	if(m_PrimeraMutacion <= gr->getTam())
+		return true;
+	m_PrimeraMutacion = -1.0;
+	return false;
+}
+
+
 /*******************************************************************
                 OperadorCruceArreglo (Inplementacin)
 *******************************************************************/
@@ -526,52 +792,98 @@ void OperadorMutacionArreglo<G, T>::mutar(Gen *pGen)
 template< class G, class T >
 void OperadorCruceArreglo<G,T>::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
 {
-	GenArreglo<G,T> *pMadre = (GenArreglo<G,T> *)pMejor;
-	GenArreglo<G,T> *pPadre = (GenArreglo<G,T> *)pPeor;
-	int j;
+	const GenArreglo<G,T> *pMadre = (const GenArreglo<G,T> *)pMejor;
+	const GenArreglo<G,T> *pPadre = (const GenArreglo<G,T> *)pPeor;
+
 	for(int i=0;i<numHijos;i++)
 	{
-		//gr ser el nuevo hijo
-		GenArreglo<G,T> *gr = new GenArreglo<G,T>( pMadre->getMinTam(), pMadre->getMaxTam(), 
-			pMadre->getMinVal() , pMadre->getMaxVal() );
-
-		//pNuevoTam: arreglo donde estar el GenEntero del nuevo tamao
-		Arreglo<GenEntero>* pNuevoTam = new Arreglo<GenEntero>;	
-		
-		//definir y ajustar el tamao del hijo cruzando los tamaos de los padres
-		m_pOperadorCruceTamanos->cruzarGenes( (Gen*)pMadre->getGenItems(), (Gen*)pPadre->getGenItems(), (Arreglo<Gen> *)pNuevoTam, 1, -1);	
-		int tnuevo = pNuevoTam->getObj(0);
-		delete pNuevoTam;		
-		tnuevo = gr->setTam( tnuevo , true); 
-
-		//encontrar cual de los padres tiene mayor tamao y asignarlo a pMayor
-		int tmenor= _MINIMO( pPadre->getTam(), pMadre->getTam() );
-		int tmayor= _MAXIMO( pPadre->getTam(), pMadre->getTam() );
-		GenArreglo<G,T> *pMayor;
-		if(tmayor==pPadre->getTam() )
-			pMayor=pPadre;
-		else
-			pMayor=pMadre;
-		
-		//cruzar los genes uno a uno
-		for(j=0; j<tmenor && j<tnuevo; j++)
-		{			
-			Arreglo<G> *Hijo = new Arreglo<G>; 
-			m_pOperadorCruceGenes->cruzarGenes( &pMadre->getGen(j), &pPadre->getGen(j), (Arreglo<Gen>*)Hijo , 1, -1);
-			gr->setVal(j, Hijo->getObj(0).getVal() );			
-			delete Hijo;
-		}
-		//asignar el valor de los genes del padre de mayor tamao
-		for(j=tmenor; j<tmayor && j<tnuevo; j++)
-		{
-			gr->setVal(j, pMayor->getVal(j) );
-		}
+		//gr ser el nuevo hijo, con los mismos lmites de la madre
+		GenArreglo<G,T> *gr = new GenArreglo<G,T>( *pMadre );
+		cruzarEn(*pMadre, *pPadre, *gr, i, indice);
 		//una vez obtenido el hijo se adiciona al arreglo recibido como parametro
  		pHijos->Adicionar(gr);
 	}
 }
 
 
+/*!Los hijos de cada pareja se cruzan en \a m_Temporal y se copian en los genes de los individuos 
+hijos, reutilizando sus bloques de datos, de modo que no se crean genes por cada hijo.
+\param ppMejores Padres con la mejor funcin de evaluacin de cada pareja.
+\param ppPeores Padres con la peor funcin de evaluacin de cada pareja.
+\param ppHijos1 Individuos que reciben el primer hijo de cada pareja.
+\param ppHijos2 Individuos que reciben el segundo hijo de cada pareja.
+\param pIndices Valor que identifica a cada pareja, que se pasa como \a indice a \a cruzarEn().
+\param pObjetivos Funciones objetivo de los mejores padres y luego de los peores (Ver OperadorCruce::cruzarLote()).
+\param numParejas Nmero de parejas.
+\param pPosiciones Posiciones del genoma que usan este operador.
+\param numPosiciones Nmero de posiciones.*/
+template< class G, class T >
+void OperadorCruceArreglo<G,T>::cruzarLote(Individuo **ppMejores, Individuo **ppPeores, Individuo **ppHijos1, Individuo **ppHijos2, const int *pIndices, const double *pObjetivos, int numParejas, const int *pPosiciones, int numPosiciones)
+{
+	for(int k=0; k<numPosiciones; k++)
+	{
+		int j = pPosiciones[k];
+		for(int i=0; i<numParejas; i++)
+		{
+			const GenArreglo<G,T> &Mejor = (const GenArreglo<G,T> &)ppMejores[i]->getGen(j);
+			const GenArreglo<G,T> &Peor = (const GenArreglo<G,T> &)ppPeores[i]->getGen(j);
+			asignarObjetivos(pObjetivos[i], pObjetivos[numParejas+i]);
+			for(int h=0; h<2; h++)
+			{
+				m_Temporal[h] = Mejor;
+				cruzarEn(Mejor, Peor, m_Temporal[h], h, pIndices[i]);
+			}
+			(GenArreglo<G,T> &)ppHijos1[i]->getGenModificable(j) = m_Temporal[0];
+			(GenArreglo<G,T> &)ppHijos2[i]->getGenModificable(j) = m_Temporal[1];
+		}
+	}
+}
+
+
+/*!Realiza el cruce sobre un gen hijo ya existente, sin crear objetos en el montn.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param Hijo Gen en el que se almacena el resultado. Debe tener los mismos lmites de \a Mejor.
+\param hijo Nmero del hijo que se est creando.
+\param indice Valor que identifica al individuo de cuyos genes se realiza el cruce.
+*/
+template< class G, class T >
+void OperadorCruceArreglo<G,T>::cruzarEn(const GenArreglo<G,T>& Mejor, const GenArreglo<G,T>& Peor, GenArreglo<G,T>& Hijo, int hijo, int indice)
+{
+	T valMin=Mejor.getMinVal(), valMax=Mejor.getMaxVal();
+	int j;
+
+	//los tamaos de los padres se cruzan como genes enteros
+	GenEntero tamMadre(Mejor.getMinTam(), Mejor.getMaxTam(), Mejor.getTam());
+	GenEntero tamPadre(Mejor.getMinTam(), Mejor.getMaxTam(), Peor.getTam());
+
+	//encontrar cual de los padres tiene mayor tamao y asignarlo a pMayor
+	int tmenor= _MINIMO( Peor.getTam(), Mejor.getTam() );
+	int tmayor= _MAXIMO( Peor.getTam(), Mejor.getTam() );
+	const GenArreglo<G,T> *pMayor;
+	if(tmayor==Peor.getTam() )
+		pMayor=&Peor;
+	else
+		pMayor=&Mejor;
+
+	//definir y ajustar el tamao del hijo cruzando los tamaos de los padres
+	int tnuevo = m_pOperadorCruceTamanos->cruzarValor(tamMadre, tamPadre, hijo, indice);
+	tnuevo = Hijo.setTam( tnuevo , true); 
+
+	//cruzar los datos uno a uno
+	for(j=0; j<tmenor && j<tnuevo; j++)
+	{			
+		G madre(valMin, valMax, Mejor.getVal(j));
+		G padre(valMin, valMax, Peor.getVal(j));
+		Hijo.setVal(j, m_pOperadorCruceGenes->cruzarValor(madre, padre, hijo, indice) );
+	}
+	//asignar el valor de los datos del padre de mayor tamao
+	for(j=tmenor; j<tmayor && j<tnuevo; j++)
+	{
+		Hijo.setVal(j, pMayor->getVal(j) );
+	}
+}
+
 
 
 
@@ -585,6 +897,12 @@ typedef Arreglo<bool>							ArregloBool;
 typedef Arreglo<long>							ArregloEntero;
 //!Define un arreglo de datos de tipo real \a (double)
 typedef Arreglo<double>							ArregloReal;
+//!Define una vista de solo lectura sobre datos de tipo booleano \a (bool)
+typedef VistaArreglo<bool>						VistaArregloBool;
+//!Define una vista de solo lectura sobre datos de tipo entero \a (long)
+typedef VistaArreglo<long>						VistaArregloEntero;
+//!Define una vista de solo lectura sobre datos de tipo real \a (double)
+typedef VistaArreglo<double>					VistaArregloReal;
 //!Define un gen de tipo arreglo con datos de tipo booleano \a (bool)
 typedef GenArreglo<GenBool,bool>				GenArregloBool;
 //!Define un gen de tipo arreglo con datos de tipo entero \a (long)
@@ -624,13 +942,13 @@ utiliza el \a constructor, el cual debe ser de la forma:  (param1, param2, ...)
 		}																	\
 		else if(estado==ESTADO_CODIFICAR)									\
 		{																	\
-			tipoGenArreglo &_gen = (tipoGenArreglo&)(pIndividuo->getGen(pos));	\
+			tipoGenArreglo &_gen = (tipoGenArreglo&)(pIndividuo->getGenModificable(pos));	\
 			_gen = var;													\
 		}																	\
 		else if(estado==ESTADO_DECODIFICAR)									\
 		{																	\
 			tipoGenArreglo &_gen = (tipoGenArreglo&)(pIndividuo->getGen(pos));	\
-			_gen.convertArreglo(var);										\
+			_gen.decodificar(var);											\
 		}																	\
 	}
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -652,7 +970,7 @@ y tama
 
 \param pIndividuo Apuntador al individuo donde se adiciona el gen.
 \param pos Posicin en la que se adiciona el gen.
-\param var Nombre de la variable del sistema a optimizar asociada con el gen adicionado. Debe ser de tipo ArregloBool, 
+\param var Nombre de la variable del sistema a optimizar asociada con el gen adicionado. Debe ser de tipo ArregloBool o VistaArregloBool para decodificar sin copiar los datos.
 \param tamMin Tamao mnimo que puede tomar el gen.
 \param tamMax Tamao mximo que puede tomar el gen.
 */
@@ -673,7 +991,7 @@ tama
 
 \param pIndividuo Apuntador al individuo donde se adiciona el gen.
 \param pos Posicin en la que se adiciona el gen.
-\param var Nombre de la variable del sistema a optimizar asociada con el gen adicionado. Debe ser de tipo ArregloEntero, 
+\param var Nombre de la variable del sistema a optimizar asociada con el gen adicionado. Debe ser de tipo ArregloEntero o VistaArregloEntero para decodificar sin copiar los datos.
 \param tamMin Tamao mnimo que puede tomar el gen.
 \param tamMax Tamao mximo que puede tomar el gen.
 \param valMin Valor mnimo que puede tomar cada gen del arreglo.
@@ -696,7 +1014,7 @@ tama
 
 \param pIndividuo Apuntador al individuo donde se adiciona el gen.
 \param pos Posicin en la que se adiciona el gen.
-\param var Nombre de la variable del sistema a optimizar asociada con el gen adicionado. Debe ser de tipo ArregloReal, 
+\param var Nombre de la variable del sistema a optimizar asociada con el gen adicionado. Debe ser de tipo ArregloReal o VistaArregloReal para decodificar sin copiar los datos.
 \param tamMin Tamao mnimo que puede tomar el gen.
 \param tamMax Tamao mximo que puede tomar el gen.
 \param valMin Valor mnimo que puede tomar cada gen del arreglo.
@@ -14,7 +14,7 @@ correspondiente al operador de mutaci
 \return Apuntador al nuevo objeto de la clase OperadorMutacionBoolUniforme*/
 inline OperadorMutacion *GenBool::operadorMutacionDefecto() const
 {
-    return (new OperadorMutacionBoolUniforme);
+    return (new TipoOperadorMutacionDefecto);
 }
 
 /*!Crea un nuevo objeto de la clase OperadorCruceBoolDiscreto,
@@ -22,7 +22,7 @@ correspondiente al operador de cruce establecido por defecto para genes de tipo
 \return Apuntador al nuevo objeto de la clase OperadorCruceBoolPlano*/
 inline OperadorCruce *GenBool::operadorCruceDefecto() const
 {
-	return (new OperadorCruceBoolDiscreto);
+	return (new TipoOperadorCruceDefecto);
 }
 
 
@@ -43,23 +43,37 @@ void OperadorMutacionBoolUniforme::mutarGen(Gen *pGen)
 /*****************************************************
                 Operadores de Cruce
 *****************************************************/
-#pragma warning(push, 3)	//Para evitar  "warning(level 4) C4100" ocasionada por parmetros de funciones no referenciados
 /*!
 \param pMejor Gen del individuo padre con mejor funcin de evaluacin.
 \param pPeor Gen del individuo padre con peor funcin de evaluacin.
 \param pHijos Arreglo de genes al cual se adicionan los genes hijos.
 \param numHijos Numero de genes hijos a crear en el cruce.
-\param indice Es ignorado. Existe por compatibilidad.*/
-void OperadorCruceBoolDiscreto::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+\param indice Valor que identifica al individuo de cuyos genes se realiza el cruce.
+
+Crea \a numHijos genes con los valores calculados por \a cruzarValor() para cada hijo.
+Los genes resultantes se agregan al arreglo de genes \a pHijos*/
+void OperadorCruceBool::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+{
+	const GenBool *pMadre=(const GenBool*)pMejor, *pPadre=(const GenBool*)pPeor;
+	for(int i=0;i<numHijos;i++)
+	{
+		GenBool *gr=new GenBool(*pMadre);
+		*gr = cruzarValor(*pMadre, *pPadre, i, indice);
+		pHijos->Adicionar(gr);
+	}
+}
+
+#pragma warning(push, 3)	//Para evitar  "warning(level 4) C4100" ocasionada por parmetros de funciones no referenciados
+/*!
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
+\param indice Es ignorado. Existe por compatibilidad.
+\return Valor tomado aleatoriamente del gen padre o del gen madre.*/
+bool OperadorCruceBoolDiscreto::cruzarValor(const GenBool& Mejor, const GenBool& Peor, int hijo, int indice)
 {
-    GenBool *pMadre=(GenBool*)pMejor, *pPadre=(GenBool*)pPeor;
-    for(int i=0;i<numHijos;i++)
-    {
-		GenBool *gr;
-        double azar = (double)rand()/(double)RAND_MAX;
-		azar<0.5? gr=new GenBool(*pMadre) : gr=new GenBool(*pPadre);
-        pHijos->Adicionar(gr);
-    }
+	double azar = (double)rand()/(double)RAND_MAX;
+	return azar<0.5 ? Mejor.getVal() : Peor.getVal();
 }
 
 #pragma warning(pop)
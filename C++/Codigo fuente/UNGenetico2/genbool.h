@@ -3,6 +3,10 @@
 
 #include "genetico.h"
 
+class OperadorCruceBool;
+class OperadorMutacionBoolUniforme;
+class OperadorCruceBoolDiscreto;
+
 /*****************************************************
                 GEN BOOL (bool)
 *****************************************************/
@@ -60,6 +64,32 @@ public:
 		operator=(*((const class GenBool*)(&origen))); 
 	}
 
+	//!Retorna 1 si los valores de los dos genes son diferentes y 0 si son iguales
+	/*!
+	\param otro Gen de tipo GenBool con el que se compara.*/
+	double distancia(const Gen& otro) const
+	{
+		return m_Valor != ((const GenBool*)(&otro))->m_Valor ? 1.0 : 0.0;
+	}
+
+	//!El gen se representa con un valor: 1 o 0
+	int numValores() const
+	{
+		return 1;
+	}
+
+	//!Escribe 1 si el gen es verdadero y 0 si es falso
+	void getValores(double *pDestino) const
+	{
+		*pDestino = m_Valor ? 1.0 : 0.0;
+	}
+
+	//!Asigna al gen el primer valor de \a pOrigen
+	void setValores(const double *pOrigen, int)
+	{
+		m_Valor = pOrigen[0] != 0.0;
+	}
+
 	//!Operador de asignacin a partir de un dato tipo bool.
 	/*!Asigna al gen el valor de un dato de tipo bool. 
 	\param nuevoValor Booleano que se asigna al gen
@@ -111,6 +141,15 @@ public:
     //!Retorna un objeto correspondiente al operador de cruce establecido por defecto para genes booleanos
     inline OperadorCruce *operadorCruceDefecto() const;
 
+	//!Tipo base de los operadores de cruce de genes booleanos
+	typedef OperadorCruceBool TipoOperadorCruce;
+
+	//!Tipo del operador de mutacin por defecto para genes booleanos
+	typedef OperadorMutacionBoolUniforme TipoOperadorMutacionDefecto;
+
+	//!Tipo del operador de cruce por defecto para genes booleanos
+	typedef OperadorCruceBoolDiscreto TipoOperadorCruceDefecto;
+
 protected:
 	//!Almacena la informacin del gen
     bool m_Valor;
@@ -144,11 +183,28 @@ public:
                 Operadores de Cruce
 *****************************************************/
 
-//!Clase derivada de la clase OperadorCruce que define el cruce discreto entre dos genes de tipo booleano
+//!Clase abstracta derivada de la clase OperadorCruce empleada en genes booleanos
+/*!Las clases derivadas solo definen el valor de cada hijo en \a cruzarValor(); la
+creacin de los genes hijos la realiza \a cruzarGenes(). As el operador de cruce de
+GenArregloBool puede cruzar directamente los valores de sus elementos.*/
+class OperadorCruceBool:public OperadorCruce
+{
+public:
+    //!Constructor 
+    OperadorCruceBool(){}
+    //!Destructor 
+    virtual ~OperadorCruceBool(){}
+    //!Crea los genes hijos con los valores calculados por \a cruzarValor()
+    void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+    //!Calcula el valor de un hijo a partir de los genes padres
+    virtual bool cruzarValor(const GenBool& Mejor, const GenBool& Peor, int hijo, int indice)=0;
+};
+
+//!Clase derivada de la clase OperadorCruceBool que define el cruce discreto entre dos genes de tipo booleano
 /*!Crea \a numHijos genes cuyos valores corresponden a
 datos booleanos escogidos aleatoriamente entre los valores de \a pMejor y \a pPeor.
 Los valores resultantes se agregan al arreglo de genes \a pHijos.*/
-class OperadorCruceBoolDiscreto:public OperadorCruce
+class OperadorCruceBoolDiscreto:public OperadorCruceBool
 {
 public:
     //!Constructor 
@@ -156,7 +212,7 @@ public:
     //!Destructor 
     ~OperadorCruceBoolDiscreto(){}
     //!Ejecuta un cruce discreto sobre genes booleanos
-    void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+    bool cruzarValor(const GenBool& Mejor, const GenBool& Peor, int hijo, int indice);
 };
 
 
@@ -43,7 +43,7 @@ correspondiente al operador de mutaci
 \return Apuntador al nuevo objeto de la clase OperadorMutacionEnteroUniforme*/
 inline OperadorMutacion *GenEntero::operadorMutacionDefecto() const
 {
-	return (new OperadorMutacionEnteroUniforme);
+	return (new TipoOperadorMutacionDefecto);
 }
 
 /*!Crea un nuevo objeto de la clase OperadorCruceEnteroBLX,
@@ -51,7 +51,7 @@ correspondiente al operador de cruce establecido por defecto para genes enteros.
 \return Apuntador al nuevo objeto de la clase OperadorCruceEnteroBLX*/
 inline OperadorCruce *GenEntero::operadorCruceDefecto() const
 {
-	return (new OperadorCruceEnteroBLX());
+	return (new TipoOperadorCruceDefecto);
 }
 
 
@@ -138,251 +138,193 @@ void OperadorMutacionEnteroMuhlenbein::mutarGen(Gen *pGen)
                 Operadores de Cruce
 *****************************************************/
 
-#pragma warning(push, 3)	//Para evitar  "warning(level 4) C4100" ocasionada por parmetros de funciones no referenciados
-
 /*!
 \param pMejor Gen del individuo padre con mejor funcin de evaluacin.
 \param pPeor Gen del individuo padre con peor funcin de evaluacin.
 \param pHijos Arreglo de genes al cual se adicionan los genes hijos.
 \param numHijos Numero de genes hijos a crear en el cruce.
-\param indice Es ignorado. Existe por compatibilidad.
-Crea \a numHijos genes cuyos valores corresponden a 
-nmeros enteros aleatorios que pertenecen al intervalo \f$[pMejor,pPeor]\f$
-Los valores resultantes se agregan al arreglo de genes \a pHijos.*/
-void OperadorCruceEnteroPlano::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+\param indice Valor que identifica al individuo de cuyos genes se realiza el cruce.
+
+Crea \a numHijos genes copiando los lmites de \a pMejor y les asigna
+el valor calculado por \a cruzarValor() para cada hijo.
+Los genes resultantes se agregan al arreglo de genes \a pHijos*/
+void OperadorCruceEntero::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
 {
-	GenEntero *pMadre=(GenEntero*)pMejor, *pPadre=(GenEntero*)pPeor;	
+	const GenEntero *pMadre=(const GenEntero*)pMejor, *pPadre=(const GenEntero*)pPeor;
 	for(int i=0;i<numHijos;i++)
-	{		
-		double azar = (double)rand()/(double)RAND_MAX;
-		long valor = redondear( *pMadre + azar*( *pPadre - *pMadre ) );
+	{
 		GenEntero *gr=new GenEntero(*pMadre);
-		*gr = valor;
+		*gr = cruzarValor(*pMadre, *pPadre, i, indice);
 		pHijos->Adicionar(gr);
 	}
 }
 
+#pragma warning(push, 3)	//Para evitar  "warning(level 4) C4100" ocasionada por parmetros de funciones no referenciados
+
 /*!
-\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
-\param pPeor Gen del individuo padre con peor funcin de evaluacin.
-\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
-\param numHijos Numero de genes hijos a crear en el cruce.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
+\param indice Es ignorado. Existe por compatibilidad.
+\return Nmero entero aleatorio que pertenece al intervalo \f$[Mejor,Peor]\f$*/
+long OperadorCruceEnteroPlano::cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice)
+{
+	double azar = (double)rand()/(double)RAND_MAX;
+	return redondear( Mejor + azar*( Peor - Mejor ) );
+}
+
+/*!
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
 \param indice Es ignorado. Existe por compatibilidad.
 
-Crea \a numHijos genes cuyos valores corresponden a 
-nmeros enteros que se obtienen as:
-\f[h_1=\lambda pMejor+(1-\lambda)pPeor\f]
-\f[h_2=\lambda pPeor+(1-\lambda)pMejor\f]
-Los valores resultantes se agregan al arreglo de genes \a pHijos*/
-void OperadorCruceEnteroAritmetico::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+Los hijos pares y los impares se obtienen as:
+\f[h_1=\lambda Mejor+(1-\lambda)Peor\f]
+\f[h_2=\lambda Peor+(1-\lambda)Mejor\f]
+\return Valor entero del hijo.*/
+long OperadorCruceEnteroAritmetico::cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice)
 {
-	GenEntero *pMadre=(GenEntero*)pMejor, *pPadre=(GenEntero*)pPeor;
-    double alfa;
-    for(int i=0;i<numHijos;i++)
-    {
-        if(i%2 == 0){alfa=m_Lambda;}else{alfa=1.0-m_Lambda;}
-		long valor = redondear(alfa * (*pMadre) + (1.0-alfa) * (*pPadre) );
-		GenEntero *gr=new GenEntero(*pMadre);
-		*gr = valor;
-        pHijos->Adicionar(gr);
-    }
+	double alfa;
+	if(hijo%2 == 0){alfa=m_Lambda;}else{alfa=1.0-m_Lambda;}
+	return redondear(alfa * Mejor + (1.0-alfa) * Peor );
 }
 
 /*!
-\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
-\param pPeor Gen del individuo padre con peor funcin de evaluacin.
-\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
-\param numHijos Numero de genes hijos a crear en el cruce.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
 \param indice Es ignorado. Existe por compatibilidad.
 
-Crea \a numHijos genes cuyos valores corresponden a 
-nmeros enteros aleatorios del intervalo
+\return Nmero entero aleatorio del intervalo
 \f$[c_{min} - I \alpha , c_{max} + I \alpha]\f$ donde
-\f$c_{min}=min[pMejor,pPeor]\f$, \f$c_{max}=max[pMejor,pPeor]\f$
-e \f$I=c_{max}-c_{min}\f$.
-Los valores resultantes se agregan al arreglo de genes \a pHijos*/
-void OperadorCruceEnteroBLX::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+\f$c_{min}=min[Mejor,Peor]\f$, \f$c_{max}=max[Mejor,Peor]\f$
+e \f$I=c_{max}-c_{min}\f$.*/
+long OperadorCruceEnteroBLX::cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice)
 {
-	GenEntero *pMadre=(GenEntero*)pMejor, *pPadre=(GenEntero*)pPeor;    
-    long cMin = _MINIMO( *pMadre, *pPadre);
-	long cMax = _MAXIMO( *pMadre, *pPadre);
-    long I = cMax - cMin;
+	long cMin = _MINIMO( (long)Mejor, (long)Peor);
+	long cMax = _MAXIMO( (long)Mejor, (long)Peor);
+	long I = cMax - cMin;
 	double minimo = cMin - I*m_Alfa;
-    double maximo = cMax + I*m_Alfa;
-	for(int i=0;i<numHijos;i++)
-	{		
-        double azar = (double)rand()/(double)RAND_MAX;
-        long valor = redondear(minimo + azar*(maximo-minimo));
-		GenEntero *gr=new GenEntero(*pMadre);
-		*gr = valor;
-        pHijos->Adicionar(gr);
-    }
+	double maximo = cMax + I*m_Alfa;
+	double azar = (double)rand()/(double)RAND_MAX;
+	return redondear(minimo + azar*(maximo-minimo));
 }
 
 /*!
-\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
-\param pPeor Gen del individuo padre con peor funcin de evaluacin.
-\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
-\param numHijos Numero de genes hijos a crear en el cruce.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
 \param indice Es ignorado. Existe por compatibilidad.
 
-Crea \a numHijos valores que corresponden a 
-nmeros enteros que se obtienen as:
-\f[ h_1= \frac{1}{2} pMejor + \frac{1}{2} pPeor \f]
-\f[ h_2= \frac{3}{2} pMejor - \frac{1}{2} pPeor \f]
-\f[ h_3= - \frac{1}{2} pMejor + \frac{3}{2} pPeor \f]
-La seleccin de los valores que se almacenan en los genes depende del 
-valor de la variable \a numHijos. 
-Los valores resultantes se agregan al arreglo de genes \a pHijos*/
-void OperadorCruceEnteroLineal::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+Los hijos se obtienen de forma cclica as:
+\f[ h_1= \frac{3}{2} Mejor - \frac{1}{2} Peor \f]
+\f[ h_2= \frac{1}{2} Mejor + \frac{1}{2} Peor \f]
+\f[ h_3= - \frac{1}{2} Mejor + \frac{3}{2} Peor \f]
+\return Valor entero del hijo.*/
+long OperadorCruceEnteroLineal::cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice)
 {
-	GenEntero *pMadre=(GenEntero*)pMejor, *pPadre=(GenEntero*)pPeor;
 	long valor=0;
-	for(int i=0; i<numHijos; i++)
-	{		
-		switch (i%3)
-		{
-		case 0:
-			valor= redondear( (*pMadre)*1.5 - (*pPadre)*0.5) ; break;			
-		case 1:
-			valor= redondear( (*pMadre)*0.5 + (*pPadre)*0.5) ; break;
-		case 2:
-			valor= redondear(-(*pMadre)*0.5 + (*pPadre)*1.5) ; break;
-		}
-		GenEntero *gr=new GenEntero(*pMadre);
-		*gr = valor;
-		pHijos->Adicionar(gr);
+	switch (hijo%3)
+	{
+	case 0:
+		valor= redondear( Mejor*1.5 - Peor*0.5) ; break;			
+	case 1:
+		valor= redondear( Mejor*0.5 + Peor*0.5) ; break;
+	case 2:
+		valor= redondear(-Mejor*0.5 + Peor*1.5) ; break;
 	}
+	return valor;
 }
 
 /*!
-\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
-\param pPeor Gen del individuo padre con peor funcin de evaluacin.
-\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
-\param numHijos Numero de genes hijos a crear en el cruce.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
 \param indice Es ignorado. Existe por compatibilidad.
-
-Crea \a numHijos genes cuyos valores son tomados aleatoriamente 
-del valor del gen padre o el del gen madre.
-Los genes resultantes se agregan al arreglo de genes \a pHijos*/
-void OperadorCruceEnteroDiscreto::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+\return Valor tomado aleatoriamente del gen padre o del gen madre.*/
+long OperadorCruceEnteroDiscreto::cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice)
 {
-	GenEntero *pMadre=(GenEntero*)pMejor, *pPadre=(GenEntero*)pPeor;
-	long valor;
-	for(int i=0;i<numHijos;i++)
-	{		
-		double azar = (double)rand()/(double)RAND_MAX;
-		azar>0.5 ?  valor=(*pMadre) : valor=(*pPadre);
-		GenEntero *gr=new GenEntero(*pMadre);
-		*gr = valor;
-		pHijos->Adicionar(gr);
-	}
+	double azar = (double)rand()/(double)RAND_MAX;
+	return azar>0.5 ? Mejor.getVal() : Peor.getVal();
 }
 
 /*!
-\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
-\param pPeor Gen del individuo padre con peor funcin de evaluacin.
-\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
-\param numHijos Numero de genes hijos a crear en el cruce.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
 \param indice Es ignorado. Existe por compatibilidad.
 
-Crea \a numHijos genes cuyos valores corresponden a 
-nmeros enteros que se obtienen as:
-\f[ h= pMejor + \alpha _i(pPeor - pMejor)\f]
+El valor del hijo se obtiene as:
+\f[ h= Peor + \alpha _i(Mejor - Peor)\f]
 \f$\alpha _i\f$ se escoge aleatoriamente en el intervalo \f$[-0.25,1.25]\f$
-Los valores resultantes se agregan al arreglo de genes \a pHijos*/
-void OperadorCruceEnteroIntermedioExtendido::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+\return Valor entero del hijo.*/
+long OperadorCruceEnteroIntermedioExtendido::cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice)
 {
-	GenEntero *pMadre=(GenEntero*)pMejor, *pPadre=(GenEntero*)pPeor;        
-    for(int i=0; i<numHijos; i++)
-	{		
-		double azar=(double)rand()/(double)RAND_MAX;
-		double Alfa = -0.25 + 1.5*azar;
-		long valor = redondear( *pPadre + Alfa*( *pMadre - *pPadre ));
-		GenEntero *gr=new GenEntero(*pMadre);
-		*gr = valor;
-		pHijos->Adicionar(gr);
-	}
+	double azar=(double)rand()/(double)RAND_MAX;
+	double Alfa = -0.25 + 1.5*azar;
+	return redondear( Peor + Alfa*( Mejor - Peor ));
 }
 
 /*!
-\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
-\param pPeor Gen del individuo padre con peor funcin de evaluacin.
-\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
-\param numHijos Numero de genes hijos a crear en el cruce.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
 \param indice Es ignorado. Existe por compatibilidad.
 
-Crea \a numHijos genes cuyos valores corresponden a 
-nmeros enteros que se obtienen as:
-\f[ h = r (pMejor - pPeor) + pMejor \f]
-\a r es un nmero aleatorio perteneciente al intervalo [0, 1] y \a pMejor corresponde al
+El valor del hijo se obtiene as:
+\f[ h = r (Mejor - Peor) + Mejor \f]
+\a r es un nmero aleatorio perteneciente al intervalo [0, 1] y \a Mejor corresponde al
 gen padre que tiene la mejor funcin de evaluacin.
-Los valores resultantes se agregan al arreglo de genes \a pHijos*/
-void OperadorCruceEnteroHeuristico::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+\return Valor entero del hijo.*/
+long OperadorCruceEnteroHeuristico::cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice)
 {
-	GenEntero *pMadre=(GenEntero*)pMejor, *pPadre=(GenEntero*)pPeor;
-	for(int i=0;i<numHijos;i++)
-	{
-		double r = (double)rand()/(double)RAND_MAX;
-		long valor = redondear( *pMadre + r*( *pMadre - *pPadre));
-		GenEntero *gr=new GenEntero(*pMadre);
-		*gr = valor;
-		pHijos->Adicionar(gr);
-	}
+	double r = (double)rand()/(double)RAND_MAX;
+	return redondear( Mejor + r*( Mejor - Peor));
 }
 
 #pragma warning(pop)
 
 
 /*!
-\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
-\param pPeor Gen del individuo padre con peor funcin de evaluacin.
-\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
-\param numHijos Numero de genes hijos a crear en el cruce.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
 \param indice Valor que identifica al individuo de cuyos genes se realiza el cruce.
 
-Crea \a numHijos genes cuyos valores corresponden a 
-nmeros enteros que se obtienen as:
+El valor del hijo se obtiene as:
 
-\f[ h_1= pMejor + rango_i \gamma \Delta \f]
+\f[ h_1= Mejor + rango_i \gamma \Delta \f]
 
 Donde: 
-\f[ \Delta= frac{pPeor - pMejor}{\left|Fevaluacion_{pMejor}-Fevaluacion_{pPeor}\right|} \f]
+\f[ \Delta= frac{Peor - Mejor}{\left|Fevaluacion_{Mejor}-Fevaluacion_{Peor}\right|} \f]
 
 \f[ \Gamma= \sum_{k=0}^{15} \alpha_k 2^{-k} \f]
 \f[rango_i = 0.5 (Mximo - Mnimo)\f]  
 
-\a pMejor corresponde al gen padre que tiene la mejor funcin de evaluacin,
+\a Mejor corresponde al gen padre que tiene la mejor funcin de evaluacin,
 \a Mximo y \a Mnimo corresponden a los lmites establecidos en el gen y
 \f$\alpha_k\f$ puede ser 0  1, con probabilidad de ser 1 de 0.0625,
-Los valores resultantes se agregan al arreglo de genes \a pHijos*/
-void OperadorCruceEnteroLinealBGA::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+\return Valor entero del hijo.*/
+long OperadorCruceEnteroLinealBGA::cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice)
 {
-	GenEntero *pMadre=(GenEntero*)pMejor, *pPadre=(GenEntero*)pPeor;
 	double dif, delta, gamma, azar, alfa, rango;
-	for(int i=0; i<numHijos; i++)
+	dif=fabs( m_ObjetivoMejor - m_ObjetivoPeor );
+	if(dif!=0)
+		delta = ( Peor - Mejor)/dif;
+	else
+		delta = 1.0;
+	gamma=0.0;
+	for(int j=0;j<16;j++)
 	{
-		dif=fabs( m_pAG->m_pPoblacionActual->getIndividuo(indice).objetivo() - 
-			m_pAG->m_pPoblacionActual->getIndividuo(indice).getPareja()->objetivo());		
-		if(dif!=0)
-			delta = ( *pPadre - *pMadre)/dif;
-		else
-			delta = 1.0;
-		gamma=0.0;
-		for(int j=0;j<16;j++)
-		{
-			azar = (double)rand()/(double)RAND_MAX;
-			azar<0.0625?  alfa=1.0  : alfa=0.0;
-			gamma += alfa*pow(2.0,-(double)(j));
-		}
-		rango = 0.5*(pMadre->getMax() - pMadre->getMin());
-		
-		long valor = redondear( *pMadre +  rango * gamma * delta);
-		GenEntero *gr=new GenEntero(*pMadre);
-		*gr = valor;
-		pHijos->Adicionar(gr);
+		azar = (double)rand()/(double)RAND_MAX;
+		azar<0.0625?  alfa=1.0  : alfa=0.0;
+		gamma += alfa*pow(2.0,-(double)(j));
 	}
+	rango = 0.5*(Mejor.getMax() - Mejor.getMin());
+	
+	return redondear( Mejor +  rango * gamma * delta);
 }
 
 
-#endif		//__GENENTERO_CPP
\ No newline at end of file
+#endif		//__GENENTERO_CPP
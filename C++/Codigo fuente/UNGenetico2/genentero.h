@@ -4,6 +4,10 @@
 
 #include "genetico.h"
 
+class OperadorCruceEntero;
+class OperadorMutacionEnteroUniforme;
+class OperadorCruceEnteroBLX;
+
 
 /*****************************************************
                GEN ENTERO (long)
@@ -47,6 +51,35 @@ public:
 		operator=(*((const GenEntero*)(&origen)));
 	}
 
+	//!Retorna la diferencia entre los valores de dos genes, relativa al rango del gen
+	/*!
+	\param otro Gen de tipo GenEntero con el que se compara.
+	\return Valor en el intervalo [0, 1].*/
+	double distancia(const Gen& otro) const
+	{
+		double rango = (double)(m_Maximo - m_Minimo);
+		double dif = fabs((double)(m_Valor - ((const GenEntero*)(&otro))->m_Valor));
+		return rango>0.0 ? dif/rango : 0.0;
+	}
+
+	//!El gen se representa con un valor
+	int numValores() const
+	{
+		return 1;
+	}
+
+	//!Escribe el valor actual del gen
+	void getValores(double *pDestino) const
+	{
+		*pDestino = (double)m_Valor;
+	}
+
+	//!Asigna al gen el primer valor de \a pOrigen
+	void setValores(const double *pOrigen, int)
+	{
+		setVal((long)floor(pOrigen[0]+0.5));
+	}
+
 	//!Operador de asignacin a partir de un dato entero.
 	/*!Asigna al gen el valor de un dato de tipo entero. 
 	\param nuevoValor Nmero entero que se asigna al gen
@@ -116,6 +149,15 @@ public:
 	//!Retorna un objeto correspondiente al operador de cruce establecido por defecto para genes enteros
 	inline OperadorCruce *operadorCruceDefecto() const;
 
+	//!Tipo base de los operadores de cruce de genes enteros
+	typedef OperadorCruceEntero TipoOperadorCruce;
+
+	//!Tipo del operador de mutacin por defecto para genes enteros
+	typedef OperadorMutacionEnteroUniforme TipoOperadorMutacionDefecto;
+
+	//!Tipo del operador de cruce por defecto para genes enteros
+	typedef OperadorCruceEnteroBLX TipoOperadorCruceDefecto;
+
 protected:
 	
 	//!Almacena la informacin del gen
@@ -239,9 +281,27 @@ private:
                 Operadores de Cruce
 *****************************************************/
 
-//!Clase derivada de la clase OperadorCruce empleada en genes enteros
+//!Clase abstracta derivada de la clase OperadorCruce empleada en genes enteros
+/*!Es la base de todos los operadores de cruce de genes enteros. Las clases derivadas
+solo definen el valor de cada hijo en \a cruzarValor(); la creacin de los genes hijos
+la realiza \a cruzarGenes(). As el operador de cruce de GenArregloEntero puede
+cruzar directamente los valores enteros de sus elementos.*/
+class OperadorCruceEntero:public OperadorCruce
+{
+public:
+	//!Constructor
+	OperadorCruceEntero(){}
+	//!Destructor
+	virtual ~OperadorCruceEntero(){}
+	//!Crea los genes hijos con los valores calculados por \a cruzarValor()
+	void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+	//!Calcula el valor entero de un hijo a partir de los genes padres
+	virtual long cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice)=0;
+};
+
+//!Clase derivada de la clase OperadorCruceEntero empleada en genes enteros
 /*!Efecta un cruce plano entre dos genes de tipo entero*/
-class OperadorCruceEnteroPlano:public OperadorCruce
+class OperadorCruceEnteroPlano:public OperadorCruceEntero
 {
 public:
     //!Constructor
@@ -251,13 +311,13 @@ public:
     ~OperadorCruceEnteroPlano(){}
 
     //!Ejecuta un cruce plano sobre genes enteros
-    void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+    long cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice);
 };
 
 
-//!Clase derivada de la clase OperadorCruce empleada en genes enteros
+//!Clase derivada de la clase OperadorCruceEntero empleada en genes enteros
 /*!Efecta un cruce aritmtico entre dos genes de tipo entero*/
-class OperadorCruceEnteroAritmetico:public OperadorCruce
+class OperadorCruceEnteroAritmetico:public OperadorCruceEntero
 {
 public:
 	//!Constructor
@@ -285,16 +345,16 @@ public:
 	~OperadorCruceEnteroAritmetico(){}	
 	
 	//!Ejecuta un cruce aritmtico sobre genes enteros
-	void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+	long cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice);
 
 private:
 	//!Parmetro que pondera cada uno de los genes padres.
 	double m_Lambda;
 };
 
-//!Clase derivada de la clase OperadorCruce empleada en genes enteros
+//!Clase derivada de la clase OperadorCruceEntero empleada en genes enteros
 /*!Efecta un cruce BLX -\f$\alpha\f$ entre dos genes de tipo entero*/
-class OperadorCruceEnteroBLX:public OperadorCruce
+class OperadorCruceEnteroBLX:public OperadorCruceEntero
 {
 public:
 	//!Constructor
@@ -318,15 +378,15 @@ public:
 	//!Destructor
 	~OperadorCruceEnteroBLX(){}
 	//!Ejecuta un cruce BLX - \f$\alpha\f$ sobre genes enteros
-	void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+	long cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice);
 private:
 	//!Establece la amplitud del intervalo de definicin.
 	double m_Alfa;
 };
 
-//!Clase derivada de la clase OperadorCruce empleada en genes enteros
+//!Clase derivada de la clase OperadorCruceEntero empleada en genes enteros
 /*!Efecta un cruce lineal entre dos genes de tipo entero*/
-class OperadorCruceEnteroLineal:public OperadorCruce
+class OperadorCruceEnteroLineal:public OperadorCruceEntero
 {
 public:
 	//!Constructor
@@ -334,12 +394,12 @@ public:
 	//!Destructor 
 	~OperadorCruceEnteroLineal(){}
 	//!Ejecuta un cruce lineal sobre genes enteros
-	void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+	long cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice);
 };
 
-//!Clase derivada de la clase OperadorCruce empleada en genes enteros
+//!Clase derivada de la clase OperadorCruceEntero empleada en genes enteros
 /*!Efecta un cruce discreto entre dos genes de tipo entero*/
-class OperadorCruceEnteroDiscreto:public OperadorCruce
+class OperadorCruceEnteroDiscreto:public OperadorCruceEntero
 {
 public:
   //!Constructor
@@ -347,13 +407,13 @@ public:
   //!Destructor
     ~OperadorCruceEnteroDiscreto(){}
   //!Ejecuta un cruce discreto sobre genes enteros
-    void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+    long cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice);
 };
 
 
-//!Clase derivada de la clase OperadorCruce empleada en genes enteros
+//!Clase derivada de la clase OperadorCruceEntero empleada en genes enteros
 /*!Efecta un cruce extendido intermedio entre dos genes de tipo entero*/
-class OperadorCruceEnteroIntermedioExtendido:public OperadorCruce
+class OperadorCruceEnteroIntermedioExtendido:public OperadorCruceEntero
 {
 public:
 	//!Constructor
@@ -361,13 +421,13 @@ public:
 	//!Destructor
 	~OperadorCruceEnteroIntermedioExtendido(){}
 	//!Ejecuta un cruce intermedio extendido sobre genes enteros
-	void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+	long cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice);
 };
 
 
-//!Clase derivada de la clase OperadorCruce empleada en genes enteros
+//!Clase derivada de la clase OperadorCruceEntero empleada en genes enteros
 /*!Efecta un cruce heurstico entre dos genes de tipo entero*/
-class OperadorCruceEnteroHeuristico:public OperadorCruce
+class OperadorCruceEnteroHeuristico:public OperadorCruceEntero
 {
 public:
   //!Constructor
@@ -375,12 +435,13 @@ public:
   //!Destructor
     ~OperadorCruceEnteroHeuristico(){}
   //!Ejecuta un cruce heurstico sobre genes enteros
-    void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+    long cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice);
 };
  
-//!Clase derivada de la clase OperadorCruce empleada en genes enteros
-/*!Efecta un cruce BGA lineal entre dos genes de tipo entero*/
-class OperadorCruceEnteroLinealBGA:public OperadorCruce
+//!Clase derivada de la clase OperadorCruceEntero empleada en genes enteros
+/*!Efecta un cruce BGA lineal entre dos genes de tipo entero
+Las funciones objetivo de los padres las recibe en OperadorCruce::asignarObjetivos().*/
+class OperadorCruceEnteroLinealBGA:public OperadorCruceEntero
 {
 public:
 	//!Constructor
@@ -388,9 +449,9 @@ public:
 	//!Destructor
 	~OperadorCruceEnteroLinealBGA(){}
 	//!Ejecuta el cruce lineal BGA sobre genes enteros
-	void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+	long cruzarValor(const GenEntero& Mejor, const GenEntero& Peor, int hijo, int indice);
 private:
-	//!Apuntador al objeto AlgoritmoGenetico en el que opera
+	//!Apuntador al objeto AlgoritmoGenetico en el que opera. Se conserva por compatibilidad
 	AlgoritmoGenetico *m_pAG;
 };
 
@@ -22,6 +22,42 @@ long redondear(double x)
 		return (long)floor(x);
 }
 
+/*!Retorna un entero aleatorio uniforme en el rango [0, n-1]. Combina dos valores 
+de \a rand() para que el resultado sea til aun cuando \a n es mayor que RAND_MAX.
+\param n Nmero de valores posibles. Debe ser mayor que cero.
+\return Entero aleatorio entre 0 y n-1*/
+long azarEntero(long n)
+{
+	double base = (double)RAND_MAX + 1.0;
+	double azar = ( (double)rand()*base + (double)rand() ) / (base*base);
+	long valor = (long)(azar*n);
+	return valor<n ? valor : n-1;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+//Distancia hasta la siguiente posicin que muta cuando cada una muta con probabilidad p (distribucin geomtrica).
+//logNoMutar es log(1-p)
+static double __saltoGeometrico(double logNoMutar)
+{
+	//el azar est en (0,1), para que su logaritmo sea finito
+	double azar = ((double)rand() + 1.0)/((double)RAND_MAX + 2.0);
+	return 1.0 + floor(log(azar)/logNoMutar);
+}
+
+//Distancia hasta la siguiente posicin que muta con probabilidad prob, incluyendo los extremos:
+//con prob>=1 muta cada posicin y con prob<=0 ninguna
+static double __saltoMutacion(double prob)
+{
+	if(prob >= 1.0)
+		return 1.0;
+	if(prob <= 0.0)
+		return HUGE_VAL;
+	return __saltoGeometrico(log(1.0 - prob));
+}
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
 /*****************************************************
 			INDIVIDUO (Implementacion)
 *****************************************************/
@@ -32,26 +68,34 @@ long redondear(double x)
 Individuo::Individuo(AlgoritmoGenetico *pAG) 
 {
 	m_pAG=pAG;
-	m_pGenoma = new Arreglo<Gen>;
+	m_pGenoma = new GenomaCompartido;
 	m_Probabilidad = 0.0;
 	m_pPareja = NULL;
 	m_objetivoActualizado = false;
+	m_objetivoEsCota = false;
 }
 
 //Constructor por copia de otro individuo
-/*!Construye el nuevo objeto copiando idnticamente las propiedades 
-de otro objeto de la clase Individuo.
+/*!Construye el nuevo objeto copiando las propiedades de otro objeto de la 
+clase Individuo. El genoma no se copia sino que se comparte con \a origen
+hasta que alguno de los dos lo modifique.
 \param origen Objeto del que se hace copia.*/
 Individuo::Individuo(const Individuo& origen)
 {
-	m_pGenoma = new Arreglo<Gen>;
-	operator = (origen);
+	m_pGenoma = origen.m_pGenoma;
+	m_pGenoma->m_referencias++;
+	m_pAG=origen.m_pAG;
+	m_Objetivo = origen.m_Objetivo;
+	m_pPareja = origen.m_pPareja;
+	m_Probabilidad = origen.m_Probabilidad;
+	m_objetivoActualizado = origen.m_objetivoActualizado;
+	m_objetivoEsCota = origen.m_objetivoEsCota;
 }
 
 
 
-/*!Copia idnticamente las propiedades de otro objeto 
-de la clase Individuo.
+/*!Copia las propiedades de otro objeto de la clase Individuo. 
+El genoma se comparte con \a origen hasta que alguno de los dos lo modifique.
 \param origen Objeto del que se hace copia
 \return Referencia al individuo*/
 const Individuo& Individuo:: operator = (const Individuo& origen)
@@ -61,28 +105,44 @@ const Individuo& Individuo:: operator = (const Individuo& origen)
 	m_pPareja = origen.m_pPareja;
 	m_Probabilidad = origen.m_Probabilidad;
 	m_objetivoActualizado = origen.m_objetivoActualizado;	//Si el otro est actualizado, este tambin lo estar.
+	m_objetivoEsCota = origen.m_objetivoEsCota;
 
-	int i, tam=origen.m_pGenoma->getSize();
-	int miTam=m_pGenoma->getSize();
-
-	m_pGenoma->asignarMemoria(tam);
-	for(i=0; i<tam && i<miTam; i++)
-	{	
-		m_pGenoma->getObj(i).copiar( origen.m_pGenoma->getObj(i) );
-	}
-	for(i=miTam; i<tam; i++)
+	if(m_pGenoma != origen.m_pGenoma)
 	{
-		Gen* pNuevo = origen.m_pGenoma->getObj(i).crearCopia();
-		m_pGenoma->Adicionar(pNuevo);
+		origen.m_pGenoma->m_referencias++;
+		soltarGenoma();
+		m_pGenoma = origen.m_pGenoma;
 	}
-	m_pGenoma->Truncar(tam);
 	return *this;
 }
 
 /*!Destruye todos sus componentes*/
 Individuo::~Individuo()
 {
-	if(m_pGenoma) delete m_pGenoma;
+	if(m_pGenoma) soltarGenoma();
+}
+
+
+/*!Crea un nuevo genoma con copias de los genes del genoma compartido
+y deja de usar este ltimo.*/
+void Individuo::copiarGenoma()
+{
+	int tam=m_pGenoma->getSize();
+	GenomaCompartido *pNuevo = new GenomaCompartido;
+	pNuevo->asignarMemoria(tam);
+	for(int i=0; i<tam; i++)
+		pNuevo->Adicionar( m_pGenoma->getObjDirecto(i).crearCopia() );
+	soltarGenoma();
+	m_pGenoma = pNuevo;
+}
+
+
+/*!Si ningn otro individuo comparte el genoma, ste se destruye junto con sus genes.*/
+void Individuo::soltarGenoma()
+{
+	if(--m_pGenoma->m_referencias == 0)
+		delete m_pGenoma;
+	m_pGenoma = NULL;
 }
 
 
@@ -91,9 +151,10 @@ Individuo::~Individuo()
 invocando su miembro \a generarAleatorio().*/
 void Individuo::generarAleatorio()
 {
+	separarGenoma();
 	int tam=m_pGenoma->getSize();
-	for(int i=0;i<tam;i++) m_pGenoma->getObj(i).generarAleatorio();
-	m_objetivoActualizado = false;
+	for(int i=0;i<tam;i++) m_pGenoma->getObjDirecto(i).generarAleatorio();
+	desactualizarObjetivo();
 }
 
 
@@ -113,21 +174,129 @@ double Individuo::objetivo(bool actualizarAG)
 	{		
 		m_Objetivo = m_pAG->objetivo();
 		m_objetivoActualizado = true;	
+		m_objetivoEsCota = false;
+	}
+	return m_Objetivo;
+}
+
+
+/*!Lo usan los operadores que solo necesitan saber si el individuo es mejor que \a cota, como
+OperadorSeleccionTorneo, OperadorReproduccionMejorPadreMejorHijo y 
+OperadorReproduccionMejoresEntrePadresEHijos. La evaluacin la hace AlgoritmoGenetico::objetivoAcotado(),
+que puede terminar antes de tiempo. Si el valor obtenido no es mejor que \a cota, el individuo 
+guarda solo una cota de su funcin objetivo, que se reutiliza mientras el genoma no cambie y que
+\a objetivo() remplaza por el valor exacto cuando se necesite. Si el algoritmo no sobrecarga
+AlgoritmoGenetico::objetivoAcotado(), el valor siempre es exacto y se guarda como tal.
+
+Sin AlgoritmoGenetico::m_IndicadorObjetivoAcotado equivale a \a objetivo().
+\param cota Valor que el individuo debe superar.
+\return El valor exacto de la funcin objetivo si es mejor que \a cota. Si no, un valor que no es
+mejor que \a cota.*/
+double Individuo::objetivoAcotado(double cota)
+{
+	if(m_objetivoActualizado || !m_pAG->m_IndicadorObjetivoAcotado)
+		return objetivo();
+
+	//una cota calculada antes basta si tampoco es mejor que la nueva
+	bool Maximizar = m_pAG->m_IndicadorMaximizar;
+	if( m_objetivoEsCota && ((Maximizar && m_Objetivo<=cota) || (!Maximizar && m_Objetivo>=cota)) )
+		return m_Objetivo;
+
+	m_pAG->codificacion(this, ESTADO_DECODIFICAR);
+	bool exacto;
+	m_Objetivo = m_pAG->calcularObjetivoAcotado(cota, exacto);
+	if( exacto || (Maximizar && m_Objetivo>cota) || (!Maximizar && m_Objetivo<cota) )
+	{
+		m_objetivoActualizado = true;
+		m_objetivoEsCota = false;
 	}
+	else
+		m_objetivoEsCota = true;
 	return m_Objetivo;
 }
 
 
 /*!Hace que cada uno de los genes presentes en el individuo pase por el operador 
-de mutacin respectivo*/
+de mutacin respectivo. Cada operador decide primero si el gen debe mutar; solo 
+entonces, si el genoma es compartido, se crea una copia propia. La funcin objetivo
+se conserva si ningn gen muta.*/
 void Individuo::mutar()
 {	
 	int tamGenoma = getTamGenoma();
 	for(int i=0; i<tamGenoma; i++)
 	{
-		m_pAG->m_pListaOperadorMutacion->getObj(i).mutar( &m_pGenoma->getObj(i) );
+		OperadorMutacion &OM = m_pAG->m_pListaOperadorMutacion->getObjDirecto( m_pAG->m_GruposMutacion.getOperador(i) );
+		if(OM.decidirMutacionGen( &m_pGenoma->getObjDirecto(i) ))
+		{
+			separarGenoma();
+			OM.aplicarMutacion( &m_pGenoma->getObjDirecto(i) );
+			desactualizarObjetivo();
+		}
+	}
+}
+
+
+/*!Si el genoma es compartido, primero se crea una copia propia.
+\param pos Posicin del gen en el genoma.*/
+void Individuo::mutarGen(int pos)
+{
+	separarGenoma();
+	m_pAG->m_pListaOperadorMutacion->getObjDirecto( m_pAG->m_GruposMutacion.getOperador(pos) ).aplicarMutacion( &m_pGenoma->getObjDirecto(pos) );
+	desactualizarObjetivo();
+}
+
+
+/*!Suma las distancias entre los genes ubicados en la misma posicin de ambos genomas
+(Ver Gen::distancia()).
+\param otro Individuo con el que se compara. Debe tener la misma estructura de genoma.
+\return Distancia entre los dos individuos. Es 0 si comparten el genoma.*/
+double Individuo::distancia(const Individuo& otro) const
+{
+	if(mismoGenoma(otro))
+		return 0.0;
+	double suma = 0.0;
+	int tamGenoma = getTamGenoma();
+	for(int i=0; i<tamGenoma; i++)
+		suma += m_pGenoma->getObjDirecto(i).distancia( otro.m_pGenoma->getObjDirecto(i) );
+	return suma;
+}
+
+
+/*!Suma el nmero de valores de cada gen (Ver Gen::numValores()).*/
+int Individuo::numValores() const
+{
+	int num = 0;
+	int tamGenoma = getTamGenoma();
+	for(int i=0; i<tamGenoma; i++)
+		num += m_pGenoma->getObjDirecto(i).numValores();
+	return num;
+}
+
+
+/*!\param pDestino Apuntador a un arreglo con espacio para \a numValores() datos.*/
+void Individuo::getValores(double *pDestino) const
+{
+	int tamGenoma = getTamGenoma();
+	for(int i=0; i<tamGenoma; i++)
+	{
+		const Gen &gen = m_pGenoma->getObjDirecto(i);
+		gen.getValores(pDestino);
+		pDestino += gen.numValores();
+	}
+}
+
+
+/*!La funcin objetivo del individuo queda desactualizada.
+\param pOrigen Apuntador a los valores de todos los genes, uno tras otro.
+\param pNumValores Apuntador al nmero de valores de cada gen.*/
+void Individuo::setValores(const double *pOrigen, const int *pNumValores)
+{
+	int tamGenoma = getTamGenoma();
+	for(int i=0; i<tamGenoma; i++)
+	{
+		getGenModificable(i).setValores(pOrigen, pNumValores[i]);
+		pOrigen += pNumValores[i];
 	}
-	m_objetivoActualizado = false;
 }
 
 
@@ -142,6 +311,10 @@ void Individuo::mutar()
 Poblacion::Poblacion(AlgoritmoGenetico* pAG, int nIndividuos, bool crearAleatorios)
 {
 	m_pGeneracion = new Arreglo<Individuo>;
+	m_pSiguiente = new Arreglo<Individuo>;
+	m_pValoresMutacion = NULL;
+	m_pFilasMutacion = NULL;
+	m_capacidadMutacion = 0;
 	m_pAG = pAG;
 	setTam(nIndividuos, false, crearAleatorios);
 }
@@ -153,6 +326,10 @@ Poblacion::Poblacion(const Poblacion& origen)
 {
 	m_pAG = origen.m_pAG;
 	m_pGeneracion = new Arreglo<Individuo>(*origen.m_pGeneracion);
+	m_pSiguiente = new Arreglo<Individuo>;
+	m_pValoresMutacion = NULL;
+	m_pFilasMutacion = NULL;
+	m_capacidadMutacion = 0;
 }
 
 /*!Copia idnticamente las propiedades de otro objeto 
@@ -171,6 +348,9 @@ const Poblacion& Poblacion::operator = (const Poblacion& origen)
 Poblacion::~Poblacion()
 {
 	if(m_pGeneracion) delete m_pGeneracion;
+	if(m_pSiguiente) delete m_pSiguiente;
+	delete [] m_pValoresMutacion;
+	delete [] m_pFilasMutacion;
 }
 
 
@@ -214,14 +394,191 @@ int Poblacion::InsertarIndividuo(Individuo* ind, int pos)
 }
 
 /*!Hace que cada uno de los individuos presentes en poblacin realice 
-el proceso de mutacin.*/
+el proceso de mutacin.
+
+Si todos los operadores deciden la mutacin con un solo nmero aleatorio (Ver
+OperadorMutacion::decisionSimple()) y la mayor probabilidad de mutacin \a p no supera
+__PROBABILIDAD_MAXIMA_SALTO, los genes de toda la poblacin se recorren como una sola secuencia
+y no se decide gen por gen: la distancia hasta el siguiente gen que muta se obtiene de una
+distribucin geomtrica, con un solo nmero aleatorio, y solo se visitan los genes que mutan.
+A un gen cuyo operador tiene una probabilidad menor que \a p se le aplica la mutacin con
+probabilidad igual a la razn entre ambas, de modo que cada gen muta con la probabilidad de su
+operador. Las probabilidades se leen en cada invocacin, por lo que los operadores de adaptacin
+pueden cambiarlas entre generaciones.
+
+Si adems todos los operadores pueden mutar varios valores a la vez (Ver
+OperadorMutacion::mutacionMatricial()) y todos los genes tienen un solo valor, se usa
+\a mutarColumnas().
+
+En los dems casos los genes se mutan por grupos de genes que comparten operador, con una sola
+invocacin de OperadorMutacion::mutarLote() por grupo para toda la poblacin (Ver GruposOperadores).*/
 void Poblacion::mutar()
 {	
+	Arreglo<OperadorMutacion> &Operadores = *m_pAG->m_pListaOperadorMutacion;
+	const GruposOperadores &Grupos = m_pAG->m_GruposMutacion;
+	int j, tamGenoma = Grupos.getNumPosiciones();
+	bool saltar = tamGenoma > 0;
+	bool matricial = saltar && MatrizPoblacion::admite(*m_pAG->m_pModelo);
+	double probMaxima = 0.0;
+	for(j=0; j<Grupos.getNumGrupos() && saltar; j++)
+	{
+		OperadorMutacion &OM = Operadores.getObjDirecto(j);
+		saltar = OM.decisionSimple();
+		matricial = matricial && OM.mutacionMatricial();
+		probMaxima = _MAXIMO(probMaxima, OM.ObtenerProbabilidadMutacion());
+	}
+
+	if(saltar && matricial)
+	{
+		mutarColumnas();
+		return;
+	}
+
+	if(!saltar || probMaxima > __PROBABILIDAD_MAXIMA_SALTO)
+	{
+		if(Grupos.getNumPosiciones() != m_pAG->m_pModelo->getTamGenoma())
+		{
+			for(Individuo **p=m_pGeneracion->begin(); p!=m_pGeneracion->end(); ++p)
+			{
+				(*p)->mutar();
+			}
+			return;
+		}
+		for(int g=0; g<Grupos.getNumGrupos(); g++)
+		{
+			const int *pPosiciones = Grupos.getPosiciones(g);
+			Operadores.getObjDirecto(g).mutarLote(m_pGeneracion->begin(), getTam(), pPosiciones, Grupos.getNumPosiciones(g));
+		}
+		return;
+	}
+	if(probMaxima <= 0.0)
+		return;
+
+	double logNoMutar = log(1.0 - probMaxima);
+	double total = (double)getTam()*(double)tamGenoma;
+	double pos = -1.0;
+	for(;;)
+	{
+		pos += __saltoGeometrico(logNoMutar);
+		if(pos >= total)
+			break;
+
+		long gen = (long)pos;
+		j = (int)(gen % tamGenoma);
+		double prob = Operadores.getObjDirecto( Grupos.getOperador(j) ).ObtenerProbabilidadMutacion();
+		if(prob < probMaxima && (double)rand()/(double)RAND_MAX*probMaxima >= prob)
+			continue;
+		getIndividuoDirecto((int)(gen / tamGenoma)).mutarGen(j);
+	}
+}
+
+
+/*!Para cada gen se eligen los individuos en los que muta, con la probabilidad de su operador:
+con saltos geomtricos si no supera __PROBABILIDAD_MAXIMA_SALTO, o individuo por individuo si
+la supera. Los valores del gen en esos individuos se renen en un arreglo contiguo, el operador
+los muta todos con OperadorMutacion::mutarColumna() y luego se devuelven a los individuos.
+Todos los genes deben tener un solo valor y todos los operadores deben permitirlo (Ver
+OperadorMutacion::mutacionMatricial()).*/
+void Poblacion::mutarColumnas()
+{
+	const Individuo &modelo = *m_pAG->m_pModelo;
+	Arreglo<OperadorMutacion> &Operadores = *m_pAG->m_pListaOperadorMutacion;
+	const GruposOperadores &Grupos = m_pAG->m_GruposMutacion;
+	int i, j, tam = getTam(), tamGenoma = Grupos.getNumPosiciones();
+	if(m_capacidadMutacion < tam)
+	{
+		delete [] m_pValoresMutacion;
+		delete [] m_pFilasMutacion;
+		m_pValoresMutacion = new double[tam];
+		m_pFilasMutacion = new int[tam];
+		m_capacidadMutacion = tam;
+	}
+
+	for(j=0; j<tamGenoma; j++)
+	{
+		OperadorMutacion &OM = Operadores.getObjDirecto( Grupos.getOperador(j) );
+		double prob = OM.ObtenerProbabilidadMutacion();
+		if(prob <= 0.0)
+			continue;
+
+		int num = 0;
+		if(prob > __PROBABILIDAD_MAXIMA_SALTO)
+		{
+			for(i=0; i<tam; i++)
+				if((double)rand()/(double)RAND_MAX < prob)
+					m_pFilasMutacion[num++] = i;
+		}
+		else
+		{
+			double logNoMutar = log(1.0 - prob);
+			for(double pos = __saltoGeometrico(logNoMutar) - 1.0; pos < tam; pos += __saltoGeometrico(logNoMutar))
+				m_pFilasMutacion[num++] = (int)pos;
+		}
+		if(num == 0)
+			continue;
+
+		for(i=0; i<num; i++)
+			getIndividuoDirecto(m_pFilasMutacion[i]).getGen(j).getValores(m_pValoresMutacion + i);
+		OM.mutarColumna(modelo.getGen(j), m_pValoresMutacion, num);
+		for(i=0; i<num; i++)
+			getIndividuoDirecto(m_pFilasMutacion[i]).getGenModificable(j).setValores(m_pValoresMutacion + i, 1);
+	}
+}
+
+
+/*!Si la siguiente generacin tiene menos individuos que la actual, se completa con copias 
+del individuo modelo. Si tiene ms, los sobrantes se conservan para ser reutilizados.*/
+void Poblacion::prepararSiguiente()
+{
+	int tam = m_pGeneracion->getSize();
+	int old = m_pSiguiente->getSize();
+	if(old >= tam) return;
+
+	m_pSiguiente->asignarMemoria(tam);
+	for(int i=old; i<tam; i++)
+		m_pSiguiente->Adicionar( new Individuo(*m_pAG->m_pModelo) );
+}
+
+
+/*!Intercambia los arreglos de la generacin actual y de la siguiente. Los individuos 
+de la generacin anterior quedan disponibles para construir la prxima generacin.
+La siguiente generacin debe tener al menos tantos individuos como la actual;
+los sobrantes se mantienen al final del arreglo.*/
+void Poblacion::intercambiar()
+{
+	int tam = m_pGeneracion->getSize();
+	Arreglo<Individuo> *pTemp = m_pGeneracion;
+	m_pGeneracion = m_pSiguiente;
+	m_pSiguiente = pTemp;
+
+	//los individuos sobrantes de la siguiente generacin pasan al final del arreglo de reserva
+	while(m_pGeneracion->getSize() > tam)
+	{
+		m_pSiguiente->Adicionar( m_pGeneracion->Detach(m_pGeneracion->getSize()-1) );
+	}
+}
+
+
+/*!Calcula la funcin objetivo de los individuos que no la tengan actualizada.
+\param Maximizar Si su valor es \a true, el peor es el de menor funcin de evaluacin. De lo contrario es el de mayor.
+\return Posicin del peor individuo, o -1 si la poblacin est vaca.*/
+int Poblacion::getPosPeor(bool Maximizar) const
+{
 	int tam = getTam();
-	for(int i=0; i<tam; i++)
+	if(tam == 0)
+		return -1;
+	int posPeor = 0;
+	double peor = getIndividuoDirecto(0).objetivo();
+	for(int i=1; i<tam; i++)
 	{
-		getIndividuo(i).mutar();
+		double valor = getIndividuoDirecto(i).objetivo();
+		if(Maximizar ? valor < peor : valor > peor)
+		{
+			peor = valor;
+			posPeor = i;
+		}
 	}
+	return posPeor;
 }
 
 
@@ -239,7 +596,7 @@ void Poblacion::ordenar(bool Maximizar)
 			cambio=false;
 			for(int j=0; j<2; j++)
 				for(int i=j; i<tam-1; i+=2)
-					if( m_pGeneracion->getObj(i).objetivo() < m_pGeneracion->getObj(i+1).objetivo() )
+					if( m_pGeneracion->getObjDirecto(i).objetivo() < m_pGeneracion->getObjDirecto(i+1).objetivo() )
 						cambio = m_pGeneracion->IntercambiarPos(i, i+1);
 		}
 	else
@@ -248,7 +605,7 @@ void Poblacion::ordenar(bool Maximizar)
 			cambio=false;
 			for(int j=0; j<2; j++)
 				for(int i=j; i<tam-1; i+=2)
-					if( m_pGeneracion->getObj(i).objetivo() > m_pGeneracion->getObj(i+1).objetivo() )
+					if( m_pGeneracion->getObjDirecto(i).objetivo() > m_pGeneracion->getObjDirecto(i+1).objetivo() )
 						cambio = m_pGeneracion->IntercambiarPos(i, i+1);						
 		}
 
@@ -263,6 +620,225 @@ void Poblacion::ordenar(bool Maximizar)
 
 
 
+/*****************************************************
+			MatrizPoblacion (Implementacion)
+*****************************************************/
+
+
+/*!La memoria solo se solicita si la actual no alcanza.
+\param numFilas Nmero de filas (individuos).
+\param numColumnas Nmero de columnas (genes).*/
+void MatrizPoblacion::dimensionar(int numFilas, int numColumnas)
+{
+	int tam = numFilas*numColumnas;
+	if(tam > m_capacidad)
+	{
+		delete [] m_pValores;
+		m_pValores = new double[tam];
+		m_capacidad = tam;
+	}
+	m_numFilas = numFilas;
+	m_numColumnas = numColumnas;
+}
+
+
+/*!\param fila Fila en la que se escriben los valores.
+\param ind Individuo del que se leen los valores. Debe tener \a getNumColumnas() genes.*/
+void MatrizPoblacion::leerFila(int fila, const Individuo &ind)
+{
+	double *pValor = m_pValores + fila;
+	for(int j=0; j<m_numColumnas; j++, pValor+=m_numFilas)
+		ind.getGen(j).getValores(pValor);
+}
+
+
+/*!Si el genoma es compartido, el individuo crea antes su propia copia. Su funcin objetivo
+queda desactualizada.
+\param fila Fila de la que se leen los valores.
+\param ind Individuo cuyos genes se modifican. Debe tener \a getNumColumnas() genes.*/
+void MatrizPoblacion::escribirFila(int fila, Individuo &ind) const
+{
+	const double *pValor = m_pValores + fila;
+	for(int j=0; j<m_numColumnas; j++, pValor+=m_numFilas)
+		ind.getGenModificable(j).setValores(pValor, 1);
+}
+
+
+/*!\param modelo Individuo cuyos genes se revisan, normalmente el modelo del algoritmo.
+\return \a true si tiene genes y cada uno tiene exactamente un valor (Ver Gen::numValores()).*/
+bool MatrizPoblacion::admite(const Individuo &modelo)
+{
+	int tamGenoma = modelo.getTamGenoma();
+	for(int j=0; j<tamGenoma; j++)
+		if(modelo.getGen(j).numValores() != 1)
+			return false;
+	return tamGenoma > 0;
+}
+
+
+
+/*****************************************************
+			GruposOperadores (Implementacion)
+*****************************************************/
+
+
+/*!\param operador Posicin del operador en su arreglo.
+\param numGenes Nmero de genes consecutivos a los que se aplica. Como mnimo es 1.*/
+void GruposOperadores::asignarGenes(int operador, int numGenes)
+{
+	if(operador < 0)
+		return;
+	if(operador >= m_numGenes)
+	{
+		int *pGenes = new int[operador+1];
+		for(int i=0; i<=operador; i++)
+			pGenes[i] = i<m_numGenes ? m_pGenes[i] : 1;
+		delete [] m_pGenes;
+		m_pGenes = pGenes;
+		m_numGenes = operador+1;
+	}
+	m_pGenes[operador] = _MAXIMO(numGenes, 1);
+}
+
+
+/*!\param numOperadores Nmero de operadores del arreglo. Los que no tienen genes asignados con
+\a asignarGenes() se aplican a un gen.*/
+int GruposOperadores::contarGenes(int numOperadores) const
+{
+	int total = 0;
+	for(int i=0; i<numOperadores; i++)
+		total += i<m_numGenes ? m_pGenes[i] : 1;
+	return total;
+}
+
+
+/*!Cada operador toma, en el orden del arreglo, tantas posiciones consecutivas como genes tenga
+asignados (Ver \a asignarGenes()), y forma un grupo con ellas.
+\param numOperadores Nmero de operadores del arreglo.
+\param numPosiciones Nmero de posiciones a agrupar. Si los operadores cubren menos, se agrupan
+solo las que cubren.*/
+void GruposOperadores::agrupar(int numOperadores, int numPosiciones)
+{
+	numPosiciones = restringir(numPosiciones, 0, contarGenes(numOperadores));
+	delete [] m_pPosiciones;
+	delete [] m_pInicio;
+	delete [] m_pOperador;
+	m_pPosiciones = new int[numPosiciones>0 ? numPosiciones : 1];
+	m_pOperador = new int[numPosiciones>0 ? numPosiciones : 1];
+	m_pInicio = new int[numOperadores+1];
+	m_numPosiciones = numPosiciones;
+	m_numGrupos = 0;
+
+	int j = 0;
+	m_pInicio[0] = 0;
+	for(int g=0; g<numOperadores && j<numPosiciones; g++)
+	{
+		int fin = _MINIMO(j + (g<m_numGenes ? m_pGenes[g] : 1), numPosiciones);
+		for(; j<fin; j++)
+		{
+			m_pPosiciones[j] = j;
+			m_pOperador[j] = g;
+		}
+		m_pInicio[++m_numGrupos] = j;
+	}
+}
+
+
+/*****************************************************
+			MonticuloIndexado (Implementacion)
+*****************************************************/
+
+
+MonticuloIndexado::MonticuloIndexado()
+{
+	m_tam = m_capacidad = 0;
+	m_raizMayor = true;
+	m_pMonticulo = m_pLugar = NULL;
+	m_pValores = NULL;
+}
+
+MonticuloIndexado::~MonticuloIndexado()
+{
+	delete[] m_pMonticulo;
+	delete[] m_pLugar;
+	delete[] m_pValores;
+}
+
+/*!La memoria solo se pide de nuevo cuando \a n supera la capacidad actual.
+Despus deben asignarse los valores con \a asignar() e invocarse \a construir().
+\param n Nmero de posiciones.
+\param raizMayor Si es true la raz es la posicin con el mayor valor; de lo contrario, la de menor valor.*/
+void MonticuloIndexado::iniciar(int n, bool raizMayor)
+{
+	if(n > m_capacidad)
+	{
+		delete[] m_pMonticulo;
+		delete[] m_pLugar;
+		delete[] m_pValores;
+		m_capacidad = n;
+		m_pMonticulo = new int[n];
+		m_pLugar = new int[n];
+		m_pValores = new double[n];
+	}
+	m_tam = n;
+	m_raizMayor = raizMayor;
+}
+
+/*!Se construye en O(n).*/
+void MonticuloIndexado::construir()
+{
+	int i;
+	for(i=0; i<m_tam; i++)
+		colocar(i, i);
+	for(i=m_tam/2-1; i>=0; i--)
+		hundir(i);
+}
+
+/*!\param indice Posicin en la poblacin, en el rango [0, getTam()-1].
+\param valor Nuevo valor asociado a la posicin.*/
+void MonticuloIndexado::actualizar(int indice, double valor)
+{
+	m_pValores[indice] = valor;
+	int lugar = m_pLugar[indice];
+	subir(lugar);
+	if(m_pLugar[indice] == lugar)
+		hundir(lugar);
+}
+
+/*!\param lugar Lugar del montculo cuyo elemento pudo quedar fuera de orden.*/
+void MonticuloIndexado::subir(int lugar)
+{
+	int indice = m_pMonticulo[lugar];
+	while(lugar > 0)
+	{
+		int padre = (lugar-1)/2;
+		if(!antes(indice, m_pMonticulo[padre]))
+			break;
+		colocar(lugar, m_pMonticulo[padre]);
+		lugar = padre;
+	}
+	colocar(lugar, indice);
+}
+
+/*!\param lugar Lugar del montculo cuyo elemento pudo quedar fuera de orden.*/
+void MonticuloIndexado::hundir(int lugar)
+{
+	int indice = m_pMonticulo[lugar];
+	for(;;)
+	{
+		int hijo = 2*lugar+1;
+		if(hijo >= m_tam)
+			break;
+		if(hijo+1 < m_tam && antes(m_pMonticulo[hijo+1], m_pMonticulo[hijo]))
+			hijo++;
+		if(!antes(m_pMonticulo[hijo], indice))
+			break;
+		colocar(lugar, m_pMonticulo[hijo]);
+		lugar = hijo;
+	}
+	colocar(lugar, indice);
+}
+
 
 
 
@@ -279,6 +855,7 @@ void Poblacion::ordenar(bool Maximizar)
 	AlgoritmoGenetico::AlgoritmoGenetico(AGFrame *pFrame)
 	{		
 		inicializarApuntadores();		
+		m_pMemoria = new MemoriaAG;
 		m_pFrame=pFrame;
 	}
 
@@ -295,6 +872,7 @@ void Poblacion::ordenar(bool Maximizar)
 	AlgoritmoGenetico::AlgoritmoGenetico()
 	{		
 		inicializarApuntadores();
+		m_pMemoria = new MemoriaAG;
 	}
 
 #endif
@@ -316,6 +894,8 @@ void AlgoritmoGenetico::inicializarApuntadores()
 	m_pOpSeleccion = NULL;
 	m_pOpParejas = NULL;
 	m_pOpReproduccion = NULL;
+	m_pGenesHijo = NULL;
+	m_ObjetivoAcotadoExacto = false;
 }
 
 
@@ -338,6 +918,10 @@ void AlgoritmoGenetico::inicializarVariables()
 	m_IndicadorArchivo = true;
 	m_IntervaloSalvar = 1;
 	sprintf(m_NombreArchivo, "salidas.txt");
+	m_NodoNUMA = -1;
+	m_IndicadorEvaluacionPerezosa = false;
+	m_IntervaloMedidasCompletas = 0;
+	m_IndicadorObjetivoAcotado = false;
 	m_IndicadorMostrar = false;
 	m_IndicadorMostrarMejorEnHistoria = true;
 	m_IndicadorMostrarGeneracionMejorHistorico = true;
@@ -363,6 +947,24 @@ void AlgoritmoGenetico::inicializarVariables()
 
 
 
+/*!Es invocada por \a crearOperadores() despus de \a definirOperadores(). Con evaluacin
+perezosa los operadores por defecto son los que no evalan toda la poblacin
+(Ver \a m_IndicadorEvaluacionPerezosa).*/
+void AlgoritmoGenetico::crearOperadoresGenerales()
+{
+	if(m_IndicadorEvaluacionPerezosa)
+	{
+		if(!m_pOpProbabilidad) m_pOpProbabilidad = new OperadorProbabilidadHomogenea();
+		if(!m_pOpSeleccion) m_pOpSeleccion = new OperadorSeleccionTorneo();
+		if(!m_pOpReproduccion) m_pOpReproduccion = new OperadorReproduccionDosPadresDosHijos();
+	}
+	if(!m_pOpProbabilidad) m_pOpProbabilidad = new OperadorProbabilidadLineal();
+	if(!m_pOpSeleccion) m_pOpSeleccion = new OperadorSeleccionEstocasticaRemplazo();
+	if(!m_pOpParejas) m_pOpParejas = new OperadorParejasAdyacentes();
+	if(!m_pOpReproduccion) m_pOpReproduccion = new OperadorReproduccionMejorPadreMejorHijo();
+}
+
+
 /*!Realiza las siguientes acciones:
 - Crea los arreglos contenedores de los Operadores de mutacion, cruce, 
 adaptacin y finalizacin.
@@ -381,15 +983,14 @@ void AlgoritmoGenetico::crearOperadores()
 	m_pListaOperadorCruce = new Arreglo<OperadorCruce>;
 	m_pListaOperadorAdaptacion = new Arreglo<OperadorAdaptacion>;
 	m_pListaOperadorFinalizacion = new Arreglo<OperadorFinalizacion>;
+	m_GruposMutacion.reiniciarGenes();
+	m_GruposCruce.reiniciarGenes();
 
 	//se permite al usuario definir sus operadores
 	definirOperadores();
 	
 	//se comprueba que se hayan definido los operadores correctamente.
-	if(!m_pOpProbabilidad) m_pOpProbabilidad = new OperadorProbabilidadLineal();
-	if(!m_pOpSeleccion) m_pOpSeleccion = new OperadorSeleccionEstocasticaRemplazo();
-	if(!m_pOpParejas) m_pOpParejas = new OperadorParejasAdyacentes();
-	if(!m_pOpReproduccion) m_pOpReproduccion = new OperadorReproduccionMejorPadreMejorHijo();
+	crearOperadoresGenerales();
 	
 	if(m_pListaOperadorAdaptacion->getSize()==0)
 	{
@@ -397,8 +998,9 @@ void AlgoritmoGenetico::crearOperadores()
 		m_pListaOperadorAdaptacion->Adicionar(OA);
 	}
 	
+	//los genes que no cubren los operadores definidos reciben los operadores por defecto
 	int tamGenoma = m_pModelo->getTamGenoma();
-	int tamArreglo = m_pListaOperadorMutacion->getSize();
+	int tamArreglo = m_GruposMutacion.contarGenes(m_pListaOperadorMutacion->getSize());
 	if(tamGenoma > tamArreglo)
 	{
 		OperadorMutacion *OM;
@@ -408,7 +1010,7 @@ void AlgoritmoGenetico::crearOperadores()
 			m_pListaOperadorMutacion->Adicionar(OM);
 		}
 	}
-	tamArreglo = m_pListaOperadorCruce->getSize();
+	tamArreglo = m_GruposCruce.contarGenes(m_pListaOperadorCruce->getSize());
 	if(tamGenoma > tamArreglo)
 	{
 		OperadorCruce *OC;
@@ -417,7 +1019,11 @@ void AlgoritmoGenetico::crearOperadores()
 			OC = m_pModelo->getGen(i).operadorCruceDefecto();
 			m_pListaOperadorCruce->Adicionar(OC);	
 		}
-	}		
+	}
+
+	//se asigna un operador a cada gen y se agrupan los genes que comparten operador
+	m_GruposMutacion.agrupar(m_pListaOperadorMutacion->getSize(), tamGenoma);
+	m_GruposCruce.agrupar(m_pListaOperadorCruce->getSize(), tamGenoma);
 }
 
 
@@ -454,7 +1060,22 @@ void AlgoritmoGenetico::iniciarOptimizacion()
 	finalizarOptimizacion();
 	
 	inicializarVariables();	
+#if defined(UN_PROCESOS)
+	//el identificador del proceso distingue las semillas de islas lanzadas en el mismo segundo
+	srand( (unsigned int) time(NULL) ^ ((unsigned int) getpid() << 16) );
+#else
 	srand( (unsigned int) time(NULL));
+#endif
+
+	//la memoria que se toque primero desde el nodo queda en el nodo
+	if(m_NodoNUMA >= 0)
+	{
+		m_AfinidadAnterior.guardar();
+		TopologiaNUMA::fijarHiloEnNodo(m_NodoNUMA);
+	}
+
+	//los objetos del algoritmo se crean en su propia memoria
+	MemoriaAG::activar(m_pMemoria);
 	
 	//inicializar variables
 	m_Generacion = 0;
@@ -465,6 +1086,8 @@ void AlgoritmoGenetico::iniciarOptimizacion()
 	m_MedidaOnLineAnterior = 0.0;
 	m_MedidaOffLineAnterior = 0.0;
 	m_Desviacion = 0.0;
+	m_IndividuosMedidos = 0;
+	m_AcumuladoOffLine = m_AcumuladoOnLine = m_TotalEvaluados = 0.0;
 	
 	m_pModelo = new Individuo(this);
 	codificacion(m_pModelo, ESTADO_CREAR);	
@@ -479,10 +1102,7 @@ void AlgoritmoGenetico::iniciarOptimizacion()
 /*!Si es la primera iteracin genera una nueva poblacin del tamao definido
 por \a m_TamanoPoblacion. Una iteracin contiene las 
 siguientes instrucciones:
-- asignarProbabilidad();
-- seleccionar();
-- asignarParejas();
-- reproducir();
+- aplicarOperadoresGenerales(), que invoca asignarProbabilidad(), seleccionar(), asignarParejas() y reproducir();
 - mutar();
 - adaptacion();
 - actualizarMedidas();
@@ -496,19 +1116,79 @@ invocando las funciones
 Es invocada por \a optimizar()*/
 void AlgoritmoGenetico::iterarOptimizacion()
 {
+	MemoriaAG::activar(m_pMemoria);
 	if(m_Generacion==0)
 	{
-		m_pPoblacionActual = new Poblacion(this, m_TamanoPoblacion, m_IndicadorInicializarPoblacionAleatoria);	
+		crearPoblacion();
 	}
 	else
 	{
-		asignarProbabilidad();
-		seleccionar();
-		asignarParejas();
-		reproducir();
+		aplicarOperadoresGenerales();
 		mutar();
 		adaptacion();  //es importante invocar adaptacion() antes de actualizarMedidas()
 	}
+	terminarIteracion();
+}
+
+
+/*!Invoca en orden \a asignarProbabilidad(), \a seleccionar(), \a asignarParejas() y \a reproducir().
+Es invocada por \a iterarOptimizacion().*/
+void AlgoritmoGenetico::aplicarOperadoresGenerales()
+{
+	asignarProbabilidad();
+	seleccionar();
+	asignarParejas();
+	reproducir();
+}
+
+
+/*!El hijo se crea como copia del mejor de los padres; luego cada uno de sus genes se remplaza
+por el obtenido con el operador de cruce correspondiente, y finalmente se muta. Si ambos padres
+son el mismo individuo solo se muta la copia. La usan los algoritmos que crean los hijos uno
+por uno, como AlgoritmoGeneticoEstacionario y AlgoritmoGeneticoCelular.
+\param hijo Individuo en el que se construye el hijo. Su contenido anterior se descarta.
+\param mejor Padre con la mejor funcin objetivo.
+\param peor Padre con la peor funcin objetivo.
+\param objMejor Funcin objetivo con que se compar \a mejor. Se entrega a OperadorCruce::asignarObjetivos().
+\param objPeor Funcin objetivo con que se compar \a peor.
+\param indice Se entrega a los operadores de cruce. Es la posicin en la poblacin del individuo
+que remplazar el hijo, como en OperadorReproduccion, o -1 si no se conoce al crearlo.*/
+void AlgoritmoGenetico::crearDescendiente(Individuo &hijo, const Individuo &mejor, const Individuo &peor, double objMejor, double objPeor, int indice)
+{
+	hijo = mejor;
+	if(&mejor != &peor)
+	{
+		if(!m_pGenesHijo)
+			m_pGenesHijo = new Arreglo<Gen>;
+		int tamGenoma = m_pModelo->getTamGenoma();
+		for(int j=0; j<tamGenoma; j++)
+		{
+			OperadorCruce &OC = m_pListaOperadorCruce->getObjDirecto( m_GruposCruce.getOperador(j) );
+			OC.asignarObjetivos(objMejor, objPeor);
+			OC.cruzarGenes( &mejor.getGen(j), &peor.getGen(j), m_pGenesHijo, 1, indice);
+			Gen *temp = hijo.remplazarGen( &m_pGenesHijo->getObjDirecto(0), j);
+			delete temp;
+			m_pGenesHijo->FlushDetach();
+		}
+	}
+	hijo.mutar();
+}
+
+
+/*!Crea la poblacin inicial con el tamao definido por \a m_TamanoPoblacion.
+Es invocada por \a iterarOptimizacion() en la primera iteracin.*/
+void AlgoritmoGenetico::crearPoblacion()
+{
+	m_pPoblacionActual = new Poblacion(this, m_TamanoPoblacion, m_IndicadorInicializarPoblacionAleatoria);	
+}
+
+
+/*!Invoca \a actualizarMedidas(), salva las medidas en archivo y las muestra en pantalla 
+dependiendo de los valores de m_IndicadorArchivo, m_IndicadorMostrar y m_IntervaloSalvar, 
+y avanza el contador de generaciones.
+Es invocada al final de \a iterarOptimizacion().*/
+void AlgoritmoGenetico::terminarIteracion()
+{
 	actualizarMedidas();
 
 	bool condicion= (m_Generacion==0)||(m_Generacion%m_IntervaloSalvar==0);
@@ -571,6 +1251,16 @@ void AlgoritmoGenetico::finalizarOptimizacion()
 		delete m_pPeorEnEstaGeneracion;
 	if(m_pMejorEnLaHistoria) 
 		delete m_pMejorEnLaHistoria;	
+	if(m_pGenesHijo)
+		delete m_pGenesHijo;
+
+	//todas las pginas de memoria se devuelven al sistema de una vez
+	if(MemoriaAG::getActiva()==m_pMemoria)
+		MemoriaAG::activar(NULL);
+	m_pMemoria->liberarTodo();
+
+	//el hilo vuelve a los ncleos que tena antes de fijarse al nodo
+	m_AfinidadAnterior.restaurar();
 }
 
 /*!Invoca la funcin \a asignarProbabilidad del operador de probabilidad del algoritmo.
@@ -640,73 +1330,88 @@ void AlgoritmoGenetico::adaptacion()
 	- m_GeneracionDelMejorEnLaHistoria
 	- m_MedidaOffLineAnterior
 	- m_MedidaOnLineAnterior
+	- m_IndividuosMedidos
+
+Con \a m_IndicadorEvaluacionPerezosa solo se tienen en cuenta los individuos ya evaluados, salvo
+en la generacin 0 y cada \a m_IntervaloMedidasCompletas generaciones. Si no hay ninguno, se
+conservan las medidas de la generacin anterior.
 */
 void AlgoritmoGenetico::actualizarMedidas()
 {
 	int i, nIndividuos = m_pPoblacionActual->getTam();
+	bool completas = medidasCompletas();
 
 	//Encontrar mejor y peor funciones objetivo en la generacion actual
-	double mejor, peor, SumaObj=0.0;
-	int PosMejor=0, PosPeor=0;
-	mejor = peor = m_pPoblacionActual->getIndividuo(0).objetivo();
+	double mejor=0.0, peor=0.0, SumaObj=0.0;
+	int PosMejor=-1, PosPeor=-1, nMedidos=0;
 	for(i=0; i < nIndividuos; i++)
 	{
-		double obj= m_pPoblacionActual->getIndividuo(i).objetivo();
+		Individuo &ind = m_pPoblacionActual->getIndividuo(i);
+		if(!completas && !ind.objetivoActualizado())
+			continue;
+		double obj= ind.objetivo();
 		SumaObj+=obj;
-		if(  (m_IndicadorMaximizar && (obj>mejor) ) || (!m_IndicadorMaximizar && (obj<mejor))  )
+		if( nMedidos==0 || (m_IndicadorMaximizar && (obj>mejor) ) || (!m_IndicadorMaximizar && (obj<mejor))  )
 		{
 			mejor=obj;
 			PosMejor=i;
 		}
-		if( (m_IndicadorMaximizar && (obj<peor) )  || (!m_IndicadorMaximizar && (obj>peor))  )
+		if( nMedidos==0 || (m_IndicadorMaximizar && (obj<peor) )  || (!m_IndicadorMaximizar && (obj>peor))  )
 		{
 			peor=obj;
 			PosPeor=i;
 		}
+		nMedidos++;
 	}
-	//calcular media actual
-	m_Media = SumaObj/(double)nIndividuos;
-
-	//actualizar el mejor individuo de la generacion
-	*m_pMejorEnEstaGeneracion = m_pPoblacionActual->getIndividuo(PosMejor);
-	*m_pPeorEnEstaGeneracion = m_pPoblacionActual->getIndividuo(PosPeor);
+	m_IndividuosMedidos = nMedidos;
 
-	//actualizar el mejor individuo de la historia
-	double valMejorHistoria = m_pMejorEnLaHistoria->objetivo();
-	if( (m_Generacion==0)||( m_IndicadorMaximizar&&(mejor>valMejorHistoria))||( !m_IndicadorMaximizar &&(mejor<valMejorHistoria)))
+	if(nMedidos>0)
 	{
-		*m_pMejorEnLaHistoria = *m_pMejorEnEstaGeneracion;
-		m_GeneracionDelMejorEnLaHistoria = m_Generacion;
+		//calcular media actual
+		m_Media = SumaObj/(double)nMedidos;
+
+		//actualizar el mejor individuo de la generacion
+		*m_pMejorEnEstaGeneracion = m_pPoblacionActual->getIndividuo(PosMejor);
+		*m_pPeorEnEstaGeneracion = m_pPoblacionActual->getIndividuo(PosPeor);
+
+		//actualizar el mejor individuo de la historia
+		double valMejorHistoria = m_pMejorEnLaHistoria->objetivo();
+		if( (m_Generacion==0)||( m_IndicadorMaximizar&&(mejor>valMejorHistoria))||( !m_IndicadorMaximizar &&(mejor<valMejorHistoria)))
+		{
+			*m_pMejorEnLaHistoria = *m_pMejorEnEstaGeneracion;
+			m_GeneracionDelMejorEnLaHistoria = m_Generacion;
+		}
 	}
 
 	//Actualizar medidas Offline y Online
-	static double AcumuladoOffLine=0.0;
-	static int TotalIndividuos=0;
-	static double AcumuladoOnLine=0.0;
-	
 	if(m_Generacion==0)
 	{
-		AcumuladoOffLine=0.0;
-		TotalIndividuos=0;
-		AcumuladoOnLine=0.0;
+		m_AcumuladoOffLine=0.0;
+		m_TotalEvaluados=0.0;
+		m_AcumuladoOnLine=0.0;
 	}
 	m_MedidaOffLineAnterior = m_MedidaOffLine;
-	AcumuladoOffLine += m_pMejorEnLaHistoria->objetivo();
-	m_MedidaOffLine = AcumuladoOffLine/((double)m_Generacion+1.0);
+	m_AcumuladoOffLine += m_pMejorEnLaHistoria->objetivo();
+	m_MedidaOffLine = m_AcumuladoOffLine/((double)m_Generacion+1.0);
 	
 	m_MedidaOnLineAnterior = m_MedidaOnLine;
-	AcumuladoOnLine+=SumaObj;
-	TotalIndividuos+=nIndividuos;
-	m_MedidaOnLine = AcumuladoOnLine/(double)TotalIndividuos;
+	if(nMedidos==0)
+		return;
+	m_AcumuladoOnLine+=SumaObj;
+	m_TotalEvaluados+=nMedidos;
+	m_MedidaOnLine = m_AcumuladoOnLine/m_TotalEvaluados;
 	
 	//Calcular desviacin
 	double acumDesv=0;
 	for(i=0;i < nIndividuos;i++)
 	{
-		double valor = m_pPoblacionActual->getIndividuo(i).objetivo();
+		Individuo &ind = m_pPoblacionActual->getIndividuo(i);
+		if(!completas && !ind.objetivoActualizado())
+			continue;
+		double valor = ind.objetivo();
 		acumDesv+= pow(valor-m_Media,2.0);
 	}
-	m_Desviacion=sqrt(acumDesv / nIndividuos);
+	m_Desviacion=sqrt(acumDesv / nMedidos);
 }
 
 
@@ -900,9 +1605,325 @@ void AlgoritmoGenetico::salvar()
 }
 
 
+/*************************************************************
+		AlgoritmoGeneticoEstacionario (Implementacion)
+**************************************************************/
+
+
+#if defined(USAR_VENTANA)
+
+	/*!Establece los parmetros por defecto del algoritmo estacionario: dos hijos por iteracin,
+	que remplazan al peor individuo.
+	\param pFrame Apuntador a la ventana de la aplicacin*/
+	AlgoritmoGeneticoEstacionario::AlgoritmoGeneticoEstacionario(AGFrame *pFrame):AlgoritmoGenetico(pFrame)
+	{
+		m_NumHijos = 2;
+		m_TipoRemplazo = REMPLAZO_PEOR;
+		m_FactorAglomeracion = 3;
+		m_pHijos = NULL;
+	}
+
+#else
+
+	/*!Establece los parmetros por defecto del algoritmo estacionario: dos hijos por iteracin,
+	que remplazan al peor individuo.*/
+	AlgoritmoGeneticoEstacionario::AlgoritmoGeneticoEstacionario()
+	{
+		m_NumHijos = 2;
+		m_TipoRemplazo = REMPLAZO_PEOR;
+		m_FactorAglomeracion = 3;
+		m_pHijos = NULL;
+	}
+
+#endif
+
+
+/*!Destruye los hijos. El resto de objetos los destruye AlgoritmoGenetico.*/
+AlgoritmoGeneticoEstacionario::~AlgoritmoGeneticoEstacionario()
+{
+	if(m_pHijos) delete m_pHijos;
+	m_pHijos = NULL;
+}
+
+
+/*!Destruye los hijos antes de que AlgoritmoGenetico::finalizarOptimizacion() devuelva
+la memoria del algoritmo.*/
+void AlgoritmoGeneticoEstacionario::finalizarOptimizacion()
+{
+	if(m_pHijos) delete m_pHijos;
+	m_pHijos = NULL;
+	AlgoritmoGenetico::finalizarOptimizacion();
+}
+
+
+/*!En la primera iteracin crea la poblacin. En las siguientes:
+- Crea \a m_NumHijos hijos a partir de la poblacin actual.
+- Cada hijo remplaza al individuo elegido por \a elegirRemplazo(), si no es peor que l,
+actualizando el montculo y las sumas.
+- Cuando se han creado tantos hijos como individuos tiene la poblacin, invoca los operadores
+de adaptacin y reconstruye el montculo.
+
+Al final invoca \a terminarIteracion().*/
+void AlgoritmoGeneticoEstacionario::iterarOptimizacion()
+{
+	MemoriaAG::activar(m_pMemoria);
+	if(m_Generacion==0)
+	{
+		crearPoblacion();
+		crearHijos();
+	}
+	else
+	{
+		int i, numHijos = m_pHijos->getSize();
+		for(i=0; i<numHijos; i++)
+			crearHijo(m_pHijos->getObjDirecto(i));
+
+		m_SumaHijos = 0.0;
+		m_HijosEnIteracion = 0;
+		for(i=0; i<numHijos; i++)
+			insertarHijo(m_pHijos->getObjDirecto(i));
+		revisarReconstruccion();
+	}
+	terminarIteracion();
+}
+
+
+/*!Crea \a m_NumHijos copias del individuo modelo. Es invocada en la primera iteracin.*/
+void AlgoritmoGeneticoEstacionario::crearHijos()
+{
+	if(m_NumHijos < 1) m_NumHijos = 1;
+	m_pHijos = new Arreglo<Individuo>;
+	m_pHijos->asignarMemoria(m_NumHijos);
+	for(int i=0; i<m_NumHijos; i++)
+		m_pHijos->Adicionar( new Individuo(*m_pModelo) );
+}
+
+
+/*!Si el hijo no es peor que el individuo elegido por \a elegirRemplazo(), lo remplaza
+actualizando el montculo y las sumas. En cualquier caso el hijo se cuenta para la medida OnLine.
+\param hijo Hijo a insertar. Si su funcin objetivo no est actualizada, se calcula.
+\return true si el hijo fue insertado en la poblacin.*/
+bool AlgoritmoGeneticoEstacionario::insertarHijo(Individuo &hijo)
+{
+	double valor = hijo.objetivo();
+	m_SumaHijos += valor;
+	m_HijosEnIteracion++;
+	m_HijosDesdeReconstruir++;
+
+	int pos = elegirRemplazo(hijo);
+	double anterior = m_Monticulo.getValor(pos);
+	if(esMejor(anterior, valor))
+		return false;
+
+	m_pPoblacionActual->getIndividuoDirecto(pos) = hijo;
+	m_Monticulo.actualizar(pos, valor);
+	m_SumaObj += valor - anterior;
+	m_SumaCuadrados += valor*valor - anterior*anterior;
+	if(!esMejor(m_Monticulo.getValor(m_posMejor), valor))
+		m_posMejor = pos;
+	return true;
+}
+
+
+/*!Cuando se han insertado tantos hijos como individuos tiene la poblacin, invoca los
+operadores de adaptacin y reconstruye el montculo.*/
+void AlgoritmoGeneticoEstacionario::revisarReconstruccion()
+{
+	if(m_HijosDesdeReconstruir >= m_pPoblacionActual->getTam())
+	{
+		adaptacion();
+		reconstruir();
+	}
+}
+
+
+/*!Asigna al montculo el valor de la funcin objetivo de cada individuo, y calcula de nuevo
+la posicin del mejor, la suma y la suma de cuadrados. Se invoca peridicamente para
+descartar el error acumulado en las sumas y para tener en cuenta los cambios que
+los operadores de adaptacin hagan en la poblacin.*/
+void AlgoritmoGeneticoEstacionario::reconstruir()
+{
+	int tamPob = m_pPoblacionActual->getTam();
+	m_Monticulo.iniciar(tamPob, !m_IndicadorMaximizar);
+	m_SumaObj = m_SumaCuadrados = 0.0;
+	m_posMejor = 0;
+	for(int i=0; i<tamPob; i++)
+	{
+		double valor = m_pPoblacionActual->getIndividuoDirecto(i).objetivo();
+		m_Monticulo.asignar(i, valor);
+		m_SumaObj += valor;
+		m_SumaCuadrados += valor*valor;
+		if(esMejor(valor, m_Monticulo.getValor(m_posMejor)))
+			m_posMejor = i;
+	}
+	m_Monticulo.construir();
+	m_HijosDesdeReconstruir = 0;
+}
+
+
+/*!En la primera iteracin las calcula AlgoritmoGenetico::actualizarMedidas() y se construye el
+montculo. En las siguientes se obtienen sin recorrer la poblacin:
+- La media y la desviacin, de la suma y la suma de cuadrados.
+- El peor individuo, de la raz del montculo.
+- La medida OnLine, con los hijos creados en la iteracin.*/
+void AlgoritmoGeneticoEstacionario::actualizarMedidas()
+{
+	if(m_Generacion==0)
+	{
+		AlgoritmoGenetico::actualizarMedidas();
+		reconstruir();
+		return;
+	}
+
+	double tamPob = (double)m_pPoblacionActual->getTam();
+	m_Media = m_SumaObj/tamPob;
+	double varianza = m_SumaCuadrados/tamPob - m_Media*m_Media;
+	m_Desviacion = varianza>0.0 ? sqrt(varianza) : 0.0;
+
+	*m_pMejorEnEstaGeneracion = m_pPoblacionActual->getIndividuoDirecto(m_posMejor);
+	*m_pPeorEnEstaGeneracion = m_pPoblacionActual->getIndividuoDirecto(m_Monticulo.getRaiz());
+
+	if(esMejor(m_Monticulo.getValor(m_posMejor), m_pMejorEnLaHistoria->objetivo()))
+	{
+		*m_pMejorEnLaHistoria = *m_pMejorEnEstaGeneracion;
+		m_GeneracionDelMejorEnLaHistoria = m_Generacion;
+	}
+
+	m_MedidaOffLineAnterior = m_MedidaOffLine;
+	m_AcumuladoOffLine += m_pMejorEnLaHistoria->objetivo();
+	m_MedidaOffLine = m_AcumuladoOffLine/((double)m_Generacion+1.0);
+
+	m_MedidaOnLineAnterior = m_MedidaOnLine;
+	m_AcumuladoOnLine += m_SumaHijos;
+	m_TotalEvaluados += m_HijosEnIteracion;
+	m_MedidaOnLine = m_AcumuladoOnLine/m_TotalEvaluados;
+}
+
+
+/*!Compara los valores guardados en el montculo, sin evaluar la funcin objetivo.
+\return Posicin del mejor de dos individuos elegidos al azar.*/
+int AlgoritmoGeneticoEstacionario::seleccionarPadre() const
+{
+	int tamPob = m_Monticulo.getTam();
+	int a = (int)azarEntero(tamPob);
+	int b = (int)azarEntero(tamPob);
+	return esMejor(m_Monticulo.getValor(b), m_Monticulo.getValor(a)) ? b : a;
+}
+
+
+/*!Los padres se eligen con \a seleccionarPadre() y el hijo se crea con \a crearDescendiente().
+Como el individuo que remplazar el hijo solo se elige despus de evaluarlo (Ver \a elegirRemplazo()),
+los operadores de cruce reciben -1 como ndice.
+\param hijo Individuo en el que se construye el hijo. Su contenido anterior se descarta.*/
+void AlgoritmoGeneticoEstacionario::crearHijo(Individuo &hijo)
+{
+	int p1 = seleccionarPadre();
+	int p2 = seleccionarPadre();
+	if(esMejor(m_Monticulo.getValor(p2), m_Monticulo.getValor(p1)))
+	{
+		int temp = p1;
+		p1 = p2;
+		p2 = temp;
+	}
+	crearDescendiente(hijo, m_pPoblacionActual->getIndividuoDirecto(p1), m_pPoblacionActual->getIndividuoDirecto(p2),
+		m_Monticulo.getValor(p1), m_Monticulo.getValor(p2), -1);
+}
+
+
+/*!\param hijo Hijo que se va a insertar en la poblacin.
+\return Posicin del individuo a remplazar, segn \a m_TipoRemplazo.*/
+int AlgoritmoGeneticoEstacionario::elegirRemplazo(const Individuo &hijo) const
+{
+	int tamPob = m_Monticulo.getTam();
+	switch(m_TipoRemplazo)
+	{
+	case REMPLAZO_AZAR:
+		return (int)azarEntero(tamPob);
+
+	case REMPLAZO_SIMILAR:
+		{
+			bool todos = m_FactorAglomeracion<=0 || m_FactorAglomeracion>=tamPob;
+			int n = todos ? tamPob : m_FactorAglomeracion;
+			int posSimilar = 0;
+			double menor = DBL_MAX;
+			for(int i=0; i<n; i++)
+			{
+				int pos = todos ? i : (int)azarEntero(tamPob);
+				double d = hijo.distancia( m_pPoblacionActual->getIndividuoDirecto(pos) );
+				if(d < menor)
+				{
+					menor = d;
+					posSimilar = pos;
+				}
+			}
+			return posSimilar;
+		}
+
+	default:
+		return m_Monticulo.getRaiz();
+	}
+}
+
+
 //////////////////////////////OPERADORES (Implementacion de Funciones)///////////////////////////////////
 
 
+/*!Poblacion::mutar() la invoca una vez por cada grupo de genes que comparten este operador (Ver
+GruposOperadores). Por defecto decide y muta gen por gen, como Individuo::mutar(): el genoma de un
+individuo solo se separa si alguno de sus genes muta. Las clases derivadas pueden sobrecargarla
+para recorrer el lote invocando sus propias funciones sin el mecanismo virtual.
+\param ppIndividuos Individuos de la poblacin.
+\param numIndividuos Nmero de individuos.
+\param pPosiciones Posiciones de los genes que usan el operador.
+\param numPosiciones Nmero de posiciones.*/
+void OperadorMutacion::mutarLote(Individuo **ppIndividuos, int numIndividuos, const int *pPosiciones, int numPosiciones)
+{
+	for(int k=0; k<numPosiciones; k++)
+	{
+		int j = pPosiciones[k];
+		for(int i=0; i<numIndividuos; i++)
+			if(decidirMutacionGen( &ppIndividuos[i]->getGen(j) ))
+				mutarGen( &ppIndividuos[i]->getGenModificable(j) );
+	}
+}
+
+
+/*!OperadorReproduccion::cruzarLotes() la invoca una vez por cada grupo de genes que comparten este
+operador (Ver GruposOperadores). Por defecto cruza gen por gen con \a cruzarGenes(), y remplaza
+los genes de los hijos por los obtenidos; los hijos pueden ser los mismos padres, pues cada gen
+de los padres se lee antes de remplazarse. Las clases derivadas pueden sobrecargarla para
+recorrer el lote invocando sus propias funciones sin el mecanismo virtual.
+\param ppMejores Padre con mejor funcin de evaluacin de cada pareja.
+\param ppPeores Padre con peor funcin de evaluacin de cada pareja.
+\param ppHijos1 Individuo que recibe el primer hijo de cada pareja.
+\param ppHijos2 Individuo que recibe el segundo hijo de cada pareja.
+\param pIndices ndice de cada pareja que se entrega a \a cruzarGenes().
+\param pObjetivos Funciones objetivo de los padres, que se entregan a \a asignarObjetivos(): primero
+las de los mejores de cada pareja y luego las de los peores. Se toman antes de cruzar, pues los
+hijos pueden ser los mismos padres.
+\param numParejas Nmero de parejas.
+\param pPosiciones Posiciones de los genes que usan el operador.
+\param numPosiciones Nmero de posiciones.*/
+void OperadorCruce::cruzarLote(Individuo **ppMejores, Individuo **ppPeores, Individuo **ppHijos1, Individuo **ppHijos2, const int *pIndices, const double *pObjetivos, int numParejas, const int *pPosiciones, int numPosiciones)
+{
+	Arreglo<Gen> Hijos;
+	for(int k=0; k<numPosiciones; k++)
+	{
+		int j = pPosiciones[k];
+		for(int i=0; i<numParejas; i++)
+		{
+			asignarObjetivos(pObjetivos[i], pObjetivos[numParejas+i]);
+			cruzarGenes( &ppMejores[i]->getGen(j), &ppPeores[i]->getGen(j), &Hijos, 2, pIndices[i]);
+			Gen *temp = ppHijos1[i]->remplazarGen( &Hijos.getObjDirecto(0), j);
+			delete temp;
+			temp = ppHijos2[i]->remplazarGen( &Hijos.getObjDirecto(1), j);
+			delete temp;
+			Hijos.Truncar(0, false, false);	//los genes pertenecen ahora a los hijos
+		}
+	}
+}
+
+
 //Mtodo para efectuar el proceso de adaptacion
 void OperadorAdaptacionElitismo::adaptacion(AlgoritmoGenetico *pAG)
 {
@@ -917,13 +1938,201 @@ void OperadorAdaptacionElitismo::adaptacion(AlgoritmoGenetico *pAG)
 		else
 			condicion = pAG->m_pMejorEnLaHistoria->objetivo() < pAG->m_pPoblacionActual->getIndividuo((int)posAzar).objetivo();
 
+		//la asignacin comparte el genoma del mejor, sin crear un individuo nuevo
 		if(condicion)
+			pAG->m_pPoblacionActual->getIndividuo((int)posAzar) = *pAG->m_pMejorEnLaHistoria;
+	}
+}
+
+
+/*!\param k Nmero mximo de individuos en el archivo. Si es menor que 1 se toma igual a 1.*/
+OperadorAdaptacionElitismoArchivo::OperadorAdaptacionElitismoArchivo(int k)
+{
+	m_k = k<1 ? 1 : k;
+	m_numArchivo = 0;
+	m_pArchivo = new Archivado[m_k];
+	for(int i=0; i<m_k; i++)
+		m_pArchivo[i].pInd = NULL;
+	m_maxPeores = m_numPeores = 0;
+	m_pPeores = new Peor[m_k];
+	m_pArchivadas = NULL;
+	m_capacidadArchivadas = 0;
+	m_maximizar = false;
+}
+
+/*!Destruye los individuos archivados*/
+OperadorAdaptacionElitismoArchivo::~OperadorAdaptacionElitismoArchivo()
+{
+	for(int i=0; i<m_k; i++)
+		delete m_pArchivo[i].pInd;
+	delete[] m_pArchivo;
+	delete[] m_pPeores;
+	delete[] m_pArchivadas;
+}
+
+/*!\param m Arreglo que contiene el montculo.
+\param i Posicin del elemento que pudo quedar fuera de orden.
+\param haciaMejor Si es true la raz es el mejor elemento; de lo contrario es el peor.*/
+template<class T> void OperadorAdaptacionElitismoArchivo::subir(T *m, int i, bool haciaMejor) const
+{
+	while(i>0)
+	{
+		int padre = (i-1)/2;
+		if(!prioridad(m[i].valor, m[padre].valor, haciaMejor))
+			break;
+		T temp = m[i];
+		m[i] = m[padre];
+		m[padre] = temp;
+		i = padre;
+	}
+}
+
+/*!\param m Arreglo que contiene el montculo.
+\param n Nmero de elementos del montculo.
+\param i Posicin del elemento que pudo quedar fuera de orden.
+\param haciaMejor Si es true la raz es el mejor elemento; de lo contrario es el peor.*/
+template<class T> void OperadorAdaptacionElitismoArchivo::hundir(T *m, int n, int i, bool haciaMejor) const
+{
+	for(;;)
+	{
+		int hijo = 2*i+1;
+		if(hijo>=n)
+			break;
+		if(hijo+1<n && prioridad(m[hijo+1].valor, m[hijo].valor, haciaMejor))
+			hijo++;
+		if(!prioridad(m[hijo].valor, m[i].valor, haciaMejor))
+			break;
+		T temp = m[i];
+		m[i] = m[hijo];
+		m[hijo] = temp;
+		i = hijo;
+	}
+}
+
+/*!Si el individuo ya est archivado solo se marca como presente en la generacin. Se busca
+comparando genomas; el valor de la funcin objetivo solo evita calcular distancias innecesarias.
+Si el archivo est lleno, el individuo remplaza al peor archivado cuando es mejor que l.
+\param pPob Poblacin de la generacin actual.
+\param pos Posicin del individuo en la poblacin.
+\param valor Valor de la funcin objetivo del individuo.*/
+void OperadorAdaptacionElitismoArchivo::archivar(Poblacion *pPob, int pos, double valor)
+{
+	//peor que el peor archivado: no puede estar en el archivo
+	if(m_numArchivo==m_k && prioridad(m_pArchivo[0].valor, valor, true))
+		return;
+
+	Individuo &ind = pPob->getIndividuoDirecto(pos);
+	for(int i=0; i<m_numArchivo; i++)
+	{
+		Archivado &arch = m_pArchivo[i];
+		if(ind.mismoGenoma(*arch.pInd) || (arch.valor==valor && ind.distancia(*arch.pInd)==0.0))
 		{
-			Individuo *temp = new Individuo(*pAG->m_pMejorEnLaHistoria);
-			temp = pAG->m_pPoblacionActual->remplazarIndividuo(temp, (int)posAzar );
-			delete temp;
+			arch.presente = true;
+			m_pArchivadas[pos] = true;
+			return;
 		}
 	}
+
+	if(m_numArchivo<m_k)
+	{
+		Archivado &nuevo = m_pArchivo[m_numArchivo];
+		if(nuevo.pInd)
+			*nuevo.pInd = ind;
+		else
+			nuevo.pInd = new Individuo(ind);
+		nuevo.valor = valor;
+		nuevo.presente = true;
+		m_pArchivadas[pos] = true;
+		subir(m_pArchivo, m_numArchivo++, false);
+	}
+	else if(prioridad(valor, m_pArchivo[0].valor, true))
+	{
+		*m_pArchivo[0].pInd = ind;
+		m_pArchivo[0].valor = valor;
+		m_pArchivo[0].presente = true;
+		m_pArchivadas[pos] = true;
+		hundir(m_pArchivo, m_numArchivo, 0, false);
+	}
+}
+
+/*!\param pos Posicin del individuo en la poblacin.
+\param valor Valor de la funcin objetivo del individuo.*/
+void OperadorAdaptacionElitismoArchivo::registrarPeor(int pos, double valor)
+{
+	if(m_numPeores<m_maxPeores)
+	{
+		m_pPeores[m_numPeores].pos = pos;
+		m_pPeores[m_numPeores].valor = valor;
+		subir(m_pPeores, m_numPeores++, true);
+	}
+	else if(prioridad(m_pPeores[0].valor, valor, true))
+	{
+		m_pPeores[0].pos = pos;
+		m_pPeores[0].valor = valor;
+		hundir(m_pPeores, m_numPeores, 0, true);
+	}
+}
+
+//Mtodo para efectuar el proceso de elitismo con archivo
+void OperadorAdaptacionElitismoArchivo::adaptacion(AlgoritmoGenetico *pAG)
+{
+	Poblacion *pPob = pAG->m_pPoblacionActual;
+	int i, tamPob = pPob->getTam();
+	if(tamPob<2)
+		return;
+
+	m_maximizar = pAG->m_IndicadorMaximizar;
+	m_maxPeores = m_k < tamPob/2 ? m_k : tamPob/2;
+	m_numPeores = 0;
+	for(i=0; i<m_numArchivo; i++)
+		m_pArchivo[i].presente = false;
+
+	if(m_capacidadArchivadas < tamPob)
+	{
+		delete[] m_pArchivadas;
+		m_pArchivadas = new bool[tamPob];
+		m_capacidadArchivadas = tamPob;
+	}
+	for(i=0; i<tamPob; i++)
+		m_pArchivadas[i] = false;
+
+	//con evaluacin perezosa solo se tienen en cuenta los individuos ya evaluados, como en actualizarMedidas()
+	bool completas = pAG->medidasCompletas();
+	for(i=0; i<tamPob; i++)
+	{
+		Individuo &ind = pPob->getIndividuoDirecto(i);
+		if(completas || ind.objetivoActualizado())
+			archivar(pPob, i, ind.objetivo());
+	}
+
+	//los peores se buscan entre los individuos no archivados, que no pueden ser sobrescritos
+	for(i=0; i<tamPob; i++)
+	{
+		Individuo &ind = pPob->getIndividuoDirecto(i);
+		if(!m_pArchivadas[i] && (completas || ind.objetivoActualizado()))
+			registrarPeor(i, ind.objetivo());
+	}
+
+	//ordenar los peores, dejando el peor de todos en la primera posicin
+	for(i=m_numPeores-1; i>0; i--)
+	{
+		Peor temp = m_pPeores[0];
+		m_pPeores[0] = m_pPeores[i];
+		m_pPeores[i] = temp;
+		hundir(m_pPeores, i, 0, true);
+	}
+
+	//los archivados ausentes de la generacin sobrescriben a los peores
+	int j=0;
+	for(i=0; i<m_numArchivo && j<m_numPeores; i++)
+	{
+		Archivado &arch = m_pArchivo[i];
+		if(arch.presente || !prioridad(arch.valor, m_pPeores[j].valor, true))
+			continue;
+		pPob->getIndividuoDirecto(m_pPeores[j].pos) = *arch.pInd;
+		arch.presente = true;
+		j++;
+	}
 }
 
 /*!Inicializa el valor correspondiente al tipo de adaptacin que ser implementado e invoca a los mtodos que 
@@ -978,12 +2187,14 @@ void OperadorAdaptacionProbMutacion::adaptacion(AlgoritmoGenetico *pAG)
 				contador=0;
 			if(contador >= m_maxCont)
 			{
-				int tam = pAG->m_pListaOperadorMutacion->getSize();
+				//cada operador se incrementa una sola vez, aunque lo compartan varios genes
+				int tam=pAG->m_pListaOperadorMutacion->getSize();
 				for(int i=0;i<tam;i++)
 				{
-					double nuevaProb = pAG->m_pListaOperadorMutacion->getObj(i).ObtenerProbabilidadMutacion() + m_escalon;
+					OperadorMutacion &OM = pAG->m_pListaOperadorMutacion->getObj(i);
+					double nuevaProb = OM.ObtenerProbabilidadMutacion() + m_escalon;
 					if(nuevaProb > m_maxProb) nuevaProb=m_maxProb;
-					pAG->m_pListaOperadorMutacion->getObj(i).AsignarProbabilidadMutacion( nuevaProb );
+					OM.AsignarProbabilidadMutacion( nuevaProb );
 				}
 				contador=0; 
 			}
@@ -1145,9 +2356,9 @@ void OperadorSeleccionEstocasticaRemplazo::seleccionar(Poblacion& pPob)
 	wxASSERT(suma-1 >= -1e-10  &&  suma-1<=1e-10);
 #endif
 
-	//se crea la nueva poblacion y se "juega a la ruleta", introduciendo cada individuo seleccionado.
+	//se "juega a la ruleta", copiando cada individuo seleccionado en la siguiente generacin
 	double azar;	
-	Poblacion *pNuevaPob = new Poblacion(pPob);
+	pPob.prepararSiguiente();
 
 	for(i=0;i<tam;i++)
 	{		
@@ -1156,49 +2367,104 @@ void OperadorSeleccionEstocasticaRemplazo::seleccionar(Poblacion& pPob)
 		wxASSERT( azar < suma); //azar no debe ser igual a suma
 #endif
 
-		for(j=0;j<tam;j++)
+		//bsqueda binaria del primer individuo cuyo ngulo supera a azar
+		int inf=0, sup=tam-1;
+		while(inf<sup)
 		{
+			j = (inf+sup)/2;
 			if(azar < angulo[j])
-			{				
-				Individuo *ind = new Individuo(pNuevaPob->getIndividuo(j));
-				ind = pPob.remplazarIndividuo(ind, i);
-				delete ind;
-				j=tam;
-			}
+				sup = j;
+			else
+				inf = j+1;
 		}
+		pPob.getSiguiente(i) = pPob.getIndividuo(inf);
 	}		
+	pPob.intercambiar();
 	delete [] angulo;
-	delete pNuevaPob;
+}
+
+
+/*!Solo se evala la funcin objetivo de los individuos que participan en algn torneo. Los rivales
+solo necesitan superar al ganador parcial, por lo que se evalan con Individuo::objetivoAcotado().
+\param pPob Referencia a la poblacin sobre la que opera.*/
+void OperadorSeleccionTorneo::seleccionar(Poblacion& pPob)
+{
+	int i, j, tam = pPob.getTam();
+	bool Maximizar = pPob.GetAG()->m_IndicadorMaximizar;
+
+	pPob.prepararSiguiente();
+	for(i=0;i<tam;i++)
+	{
+		int ganador = (int)azarEntero(tam);
+		double valGanador = pPob.getIndividuo(ganador).objetivo();
+		for(j=1;j<m_Tamano;j++)
+		{
+			int rival = (int)azarEntero(tam);
+			double valRival = pPob.getIndividuo(rival).objetivoAcotado(valGanador);
+			if( (Maximizar && valRival>valGanador) || (!Maximizar && valRival<valGanador) )
+			{
+				ganador = rival;
+				valGanador = valRival;
+			}
+		}
+		pPob.getSiguiente(i) = pPob.getIndividuo(ganador);
+	}
+	pPob.intercambiar();
 }
 
 
 /*!\param Pob Referencia a la poblacin sobre la que opera.*/
 void OperadorParejasAleatorias::asignarParejas(Poblacion& Pob)
 {
-	int i, pareja, tam = Pob.getTam();
+	int i, j, tam = Pob.getTam();
 	
 	//eliminar parejas actuales
 	for(i=0;i<tam;i++)
 	{
-		Pob.getIndividuo(i).asignarPareja(NULL); 
+		Pob.getIndividuoDirecto(i).asignarPareja(NULL); 
 	}	
-	
-	double azar;
-	for(i=0;i<tam-1;i++)
+	if(tam<2) return;
+
+	if(m_capacidad<tam)
 	{
-		if( Pob.getIndividuo(i).getPareja()==NULL)
+		delete [] m_pIndices;
+		m_pIndices = new int[tam];
+		m_capacidad = tam;
+	}
+
+	//barajar los ndices (Fisher-Yates)
+	for(i=0;i<tam;i++)
+		m_pIndices[i]=i;
+	for(i=tam-1;i>0;i--)
+	{
+		j = (int)azarEntero(i+1);
+		int temp = m_pIndices[i];
+		m_pIndices[i] = m_pIndices[j];
+		m_pIndices[j] = temp;
+	}
+
+	//emparejar posiciones consecutivas
+	for(i=0;i<tam-1;i+=2)
+	{
+		Individuo *pInd = &Pob.getIndividuoDirecto(m_pIndices[i]);
+		if(m_evitarIguales && pInd->mismoGenoma(Pob.getIndividuoDirecto(m_pIndices[i+1])))
 		{
-			do
+			//buscar al azar, con un nmero limitado de intentos, un individuo restante con genoma diferente
+			for(int intento=0; intento<MAX_INTENTOS && i+2<tam; intento++)
 			{
-				azar = (double)rand()/((double)RAND_MAX+1.0);
-				pareja = (int)( i+1.0 + azar*(tam-i-1.0) );
-#if defined(UN_DEBUG)
-				wxASSERT( pareja < tam && pareja > i);
-#endif
-			}while(Pob.getIndividuo(pareja).getPareja()!=NULL );
-			Pob.getIndividuo(i).asignarPareja( &Pob.getIndividuo(pareja) );
-			Pob.getIndividuo(pareja).asignarPareja( &Pob.getIndividuo(i) );
+				j = i+2+(int)azarEntero(tam-i-2);
+				if(!pInd->mismoGenoma(Pob.getIndividuoDirecto(m_pIndices[j])))
+				{
+					int temp = m_pIndices[i+1];
+					m_pIndices[i+1] = m_pIndices[j];
+					m_pIndices[j] = temp;
+					break;
+				}
+			}
 		}
+		Individuo *pPareja = &Pob.getIndividuoDirecto(m_pIndices[i+1]);
+		pInd->asignarPareja( pPareja );
+		pPareja->asignarPareja( pInd );
 	}
 }
 
@@ -1244,6 +2510,115 @@ void OperadorParejasExtremos::asignarParejas(Poblacion& Pob)
 
 
 
+/*!Los mejores de cada pareja quedan en las primeras posiciones de \a m_ppPadres y los peores en
+las siguientes, y las parejas quedan sin asignar. En \a m_pIndices queda la posicin en la poblacin
+del individuo que aport cada pareja, que se usa como ndice en los operadores de cruce, y en
+\a m_pObjetivos las funciones objetivo de los padres, en el mismo orden de \a m_ppPadres.
+\param Pob Referencia a la poblacin sobre la que opera.
+\param Maximizar Su valor sirve como referencia para determinar qu individuo es mejor a otro dependiendo de su funcin de evaluacin.
+\return Nmero de parejas.*/
+int OperadorReproduccion::reunirParejas(Poblacion& Pob, bool Maximizar)
+{
+	//los mejores se ubican al inicio de m_ppPadres y los peores a partir de tamPob
+	int i, tamPob = Pob.getTam(), numParejas = 0;
+	if(m_capacidad < 2*tamPob)
+	{
+		delete [] m_ppPadres;
+		delete [] m_pIndices;
+		delete [] m_pObjetivos;
+		m_ppPadres = new Individuo*[2*tamPob];
+		m_pIndices = new int[tamPob];
+		m_pObjetivos = new double[2*tamPob];
+		m_capacidad = 2*tamPob;
+	}
+	for(i=0; i<tamPob; i++)
+	{
+		Individuo *pInd = &Pob.getIndividuoDirecto(i);
+		Individuo *pPareja = pInd->getPareja();
+		if(!pPareja)
+			continue;
+		double objInd = pInd->objetivo(), objPareja = pPareja->objetivo();
+		bool condicion = objInd > objPareja;
+		bool indMejor = (Maximizar && condicion) || (!Maximizar && !condicion);
+		m_ppPadres[numParejas] = indMejor ? pInd : pPareja;
+		m_ppPadres[tamPob+numParejas] = indMejor ? pPareja : pInd;
+		m_pObjetivos[numParejas] = indMejor ? objInd : objPareja;
+		m_pObjetivos[tamPob+numParejas] = indMejor ? objPareja : objInd;
+		m_pIndices[numParejas] = i;
+		numParejas++;
+		pInd->asignarPareja(NULL);
+		pPareja->asignarPareja(NULL);
+	}
+	for(i=0; i<numParejas; i++)
+	{
+		m_ppPadres[numParejas+i] = m_ppPadres[tamPob+i];
+		m_pObjetivos[numParejas+i] = m_pObjetivos[tamPob+i];
+	}
+	return numParejas;
+}
+
+
+/*!Cada grupo de genes que comparten operador (Ver GruposOperadores) se cruza en todas las parejas
+con una sola invocacin de OperadorCruce::cruzarLote().
+\param Pob Referencia a la poblacin sobre la que opera.
+\param numParejas Nmero de parejas reunidas en \a m_ppPadres.
+\param ppHijos1 Individuo que recibe el primer hijo de cada pareja. Puede ser el mismo padre.
+\param ppHijos2 Individuo que recibe el segundo hijo de cada pareja. Puede ser el mismo padre.*/
+void OperadorReproduccion::cruzarLotes(Poblacion& Pob, int numParejas, Individuo **ppHijos1, Individuo **ppHijos2)
+{
+	AlgoritmoGenetico *pAG = Pob.GetAG();
+	const GruposOperadores &Grupos = pAG->m_GruposCruce;
+	Arreglo<OperadorCruce> &Operadores = *pAG->m_pListaOperadorCruce;
+	if(numParejas <= 0)
+		return;
+	for(int g=0; g<Grupos.getNumGrupos(); g++)
+	{
+		const int *pPosiciones = Grupos.getPosiciones(g);
+		Operadores.getObjDirecto(g).cruzarLote(m_ppPadres, m_ppPadres+numParejas, ppHijos1, ppHijos2,
+			m_pIndices, m_pObjetivos, numParejas, pPosiciones, Grupos.getNumPosiciones(g));
+	}
+}
+
+
+/*!Rene los valores de los padres de todas las parejas (Ver \a reunirParejas()) en \a m_Padres,
+con los mejores de cada pareja en las primeras filas y los peores en las siguientes, y cruza cada
+gen en todas las parejas con una sola invocacin de OperadorCruce::cruzarColumna(), que escribe
+los hijos en \a m_Hijos.
+Los individuos no se modifican; las clases derivadas deciden qu hacer con los hijos.
+\param Pob Referencia a la poblacin sobre la que opera.
+\param Maximizar Su valor sirve como referencia para determinar qu individuo es mejor a otro dependiendo de su funcin de evaluacin.
+\return Nmero de parejas cruzadas, o -1 si algn gen tiene ms de un valor o algn operador
+de cruce no lo permite (Ver OperadorCruce::cruceMatricial()). En ese caso no se hace nada.*/
+int OperadorReproduccion::cruzarMatriz(Poblacion& Pob, bool Maximizar)
+{
+	AlgoritmoGenetico *pAG = Pob.GetAG();
+	const Individuo &modelo = *pAG->m_pModelo;
+	Arreglo<OperadorCruce> &Operadores = *pAG->m_pListaOperadorCruce;
+	const GruposOperadores &Grupos = pAG->m_GruposCruce;
+	int i, j, tamGenoma = modelo.getTamGenoma();
+	if(!MatrizPoblacion::admite(modelo) || Grupos.getNumPosiciones() < tamGenoma)
+		return -1;
+	for(j=0; j<Grupos.getNumGrupos(); j++)
+		if(!Operadores.getObjDirecto(j).cruceMatricial())
+			return -1;
+
+	int numParejas = reunirParejas(Pob, Maximizar);
+	m_Padres.dimensionar(2*numParejas, tamGenoma);
+	m_Hijos.dimensionar(2*numParejas, tamGenoma);
+	if(numParejas == 0)
+		return 0;
+	for(i=0; i<2*numParejas; i++)
+		m_Padres.leerFila(i, *m_ppPadres[i]);
+	for(j=0; j<tamGenoma; j++)
+	{
+		const double *pPadres = m_Padres.getColumna(j);
+		double *pHijos = m_Hijos.getColumna(j);
+		Operadores.getObjDirecto( Grupos.getOperador(j) ).cruzarColumna(modelo.getGen(j), pPadres, pPadres+numParejas, pHijos, pHijos+numParejas, numParejas);
+	}
+	return numParejas;
+}
+
+
 #pragma warning(push, 3)	//Para evitar  "warning(level 4) C4100" ocasionada por parmetros de funciones no referenciados
 
 
@@ -1279,189 +2654,147 @@ void OperadorReproduccionCruceSimple::reproducir(Poblacion& Pob, bool Maximizar)
 }
 #pragma warning(pop)
 
-/*!\param Pob Referencia a la poblacin sobre la que opera
+/*!Si los genes y los operadores de cruce lo permiten, todas las parejas se cruzan por columnas
+(Ver OperadorReproduccion::cruzarMatriz()). Si no, se cruzan por grupos de genes que comparten
+operador (Ver OperadorReproduccion::cruzarLotes()), y cada padre recibe directamente su hijo.
+\param Pob Referencia a la poblacin sobre la que opera
 \param Maximizar Su valor sirve como referencia para determinar qu individuo es mejor a otro dependiendo de su funcin de evaluacin.*/
 void OperadorReproduccionDosPadresDosHijos::reproducir(Poblacion& Pob, bool Maximizar)
 {
-	AlgoritmoGenetico *pAG = Pob.GetAG();
-	int i, j, tamGenoma = pAG->m_pModelo->getTamGenoma();
-	int tamPob = Pob.getTam();
-	Individuo *pMejor,*pPeor,*pInd;
-	OperadorCruce *OC;
-
-	bool condicion;	
-	for(i=0;i<tamPob;i++)
+	int numParejas = cruzarMatriz(Pob, Maximizar);
+	if(numParejas >= 0)
 	{
-		pInd = &Pob.getIndividuo(i);
-		if(pInd->getPareja())
-		{
-			condicion= pInd->objetivo() > pInd->getPareja()->objetivo();
-			if((Maximizar && condicion) || (!Maximizar && !condicion))
-			{
-				pMejor=pInd;
-				pPeor=pInd->getPareja();
-			}
-			else
-			{
-				pMejor=pInd->getPareja();
-				pPeor=pInd;
-			}						
-			for(j=0;j<tamGenoma;j++)
-			{
-				Arreglo<Gen>* Hijos= new Arreglo<Gen>;
-				OC = &pAG->m_pListaOperadorCruce->getObj(j);			
-				OC->cruzarGenes( &pMejor->getGen(j) , &pPeor->getGen(j), Hijos, 2, i);
-				
-				Gen *temp = pMejor->remplazarGen( &Hijos->getObj(0) , j);
-				delete temp;
-				temp = pPeor->remplazarGen( &Hijos->getObj(1) , j);
-				delete temp;
-				Hijos->FlushDetach();
-				delete Hijos;
-			}
-			pMejor->asignarPareja(NULL);
-			pPeor->asignarPareja(NULL);
-		}		
+		//cada padre recibe el hijo de su misma fila
+		for(int k=0; k<2*numParejas; k++)
+			m_Hijos.escribirFila(k, *m_ppPadres[k]);
+		return;
 	}
+
+	//el mejor padre recibe el primer hijo y el peor el segundo
+	numParejas = reunirParejas(Pob, Maximizar);
+	cruzarLotes(Pob, numParejas, m_ppPadres, m_ppPadres+numParejas);
 }
 
-/*!\param Pob Referencia a la poblacin sobre la que opera
+/*!Si los genes y los operadores de cruce lo permiten, todas las parejas se cruzan por columnas
+(Ver OperadorReproduccion::cruzarMatriz()) y los hijos se construyen en dos individuos que se
+reutilizan para todas las parejas. Si no, los hijos se crean como copias del mejor padre y se
+cruzan por grupos de genes que comparten operador (Ver OperadorReproduccion::cruzarLotes()).
+El segundo hijo solo necesita superar al primero, por lo que se evala con Individuo::objetivoAcotado().
+\param Pob Referencia a la poblacin sobre la que opera
 \param Maximizar Su valor sirve como referencia para determinar qu individuo es mejor a otro dependiendo de su funcin de evaluacin.*/
 void OperadorReproduccionMejorPadreMejorHijo::reproducir(Poblacion& Pob, bool Maximizar)
 {
 	AlgoritmoGenetico *pAG = Pob.GetAG();
-	int i, j, tamGenoma = pAG->m_pModelo->getTamGenoma();
-	int tamPob = Pob.getTam();
-	Individuo *pMejor, *pPeor, *pHijo1, *pHijo2,*pInd;
-	OperadorCruce *OC;
-	bool condicion;
-	for(i=0;i<tamPob;i++)
+	int k, numParejas = cruzarMatriz(Pob, Maximizar);
+	if(numParejas > 0)
 	{
-		pInd = &Pob.getIndividuo(i);
-		if(pInd->getPareja())
+		Individuo hijo1(*pAG->m_pModelo), hijo2(*pAG->m_pModelo);
+		for(k=0; k<numParejas; k++)
 		{
-			condicion= pInd->objetivo() > pInd->getPareja()->objetivo();
-			if((Maximizar && condicion) || (!Maximizar && !condicion))
-			{
-				pMejor = pInd;
-				pPeor = pInd->getPareja();
-			}
+			m_Hijos.escribirFila(k, hijo1);
+			m_Hijos.escribirFila(numParejas+k, hijo2);
+			Individuo *pPeor = m_ppPadres[numParejas+k];
+			double val1 = hijo1.objetivo();
+			double val2 = hijo2.objetivoAcotado(val1);
+			if( (Maximizar && val1 >= val2)  ||  (!Maximizar && val1 <= val2) )
+				*pPeor = hijo1;
 			else
-			{
-				pMejor = pInd->getPareja();
-				pPeor = pInd;
-			}
-			pHijo1 = new Individuo(*pMejor);
-			pHijo2 = new Individuo(*pMejor);
-			for(j=0;j<tamGenoma;j++)
-			{
-				Arreglo<Gen>* Hijos= new Arreglo<Gen>;
-				OC = &pAG->m_pListaOperadorCruce->getObj(j);
-				OC->cruzarGenes( &pMejor->getGen(j) , &pPeor->getGen(j), Hijos, 2, i);
-				
-				Gen *temp = pHijo1->remplazarGen( &Hijos->getObj(0), j);
-				delete temp;
-				temp = pHijo2->remplazarGen( &Hijos->getObj(1), j);
-				delete temp;
-				Hijos->FlushDetach(); //antes de eliminar se deben desligar los elementos
-				delete Hijos;
-			}
-			if( (Maximizar &&  pHijo1->objetivo() > pHijo2->objetivo())  ||  (!Maximizar && pHijo1->objetivo() < pHijo2->objetivo()) )
-				*pPeor = *pHijo1;
-			else
-				*pPeor = *pHijo2;
-
+				*pPeor = hijo2;
 			pPeor->asignarPareja(NULL);
-			delete pHijo2;
-			delete pHijo1;			
-			pMejor->asignarPareja(NULL);			
 		}
 	}
+	if(numParejas >= 0)
+		return;
+
+	numParejas = reunirParejas(Pob, Maximizar);
+	if(numParejas == 0)
+		return;
+	Individuo **ppHijos = new Individuo*[2*numParejas];
+	for(k=0; k<numParejas; k++)
+	{
+		ppHijos[k] = new Individuo(*m_ppPadres[k]);
+		ppHijos[numParejas+k] = new Individuo(*m_ppPadres[k]);
+	}
+	cruzarLotes(Pob, numParejas, ppHijos, ppHijos+numParejas);
+	for(k=0; k<numParejas; k++)
+	{
+		Individuo *pHijo1 = ppHijos[k], *pHijo2 = ppHijos[numParejas+k];
+		double val1 = pHijo1->objetivo();
+		double val2 = pHijo2->objetivoAcotado(val1);
+		if( (Maximizar && val1 >= val2)  ||  (!Maximizar && val1 <= val2) )
+			*m_ppPadres[numParejas+k] = *pHijo1;
+		else
+			*m_ppPadres[numParejas+k] = *pHijo2;
+		delete pHijo2;
+		delete pHijo1;
+	}
+	delete [] ppHijos;
 }
 
 
-/*!\param Pob Referencia a la poblacin sobre la que opera
+/*!Los hijos se crean como copias del mejor padre y se cruzan por grupos de genes que comparten
+operador (Ver OperadorReproduccion::cruzarLotes()). Los hijos se evalan con Individuo::objetivoAcotado(),
+pues solo necesitan superar al segundo mejor.
+\param Pob Referencia a la poblacin sobre la que opera
 \param Maximizar Su valor sirve como referencia para determinar qu individuo es mejor a otro dependiendo de su funcin de evaluacin.*/
 void OperadorReproduccionMejoresEntrePadresEHijos::reproducir(Poblacion& Pob, bool Maximizar)
 {
-	AlgoritmoGenetico *pAG = Pob.GetAG();
-	int i, j, tamGenoma = pAG->m_pModelo->getTamGenoma();
-	int tamPob = Pob.getTam();
-	Individuo *pMejor, *pPeor, *pHijo1, *pHijo2, *pInd;
-	OperadorCruce *OC;
-	bool condicion;
-	for(i=0;i<tamPob;i++)
+	int j, k, numParejas = reunirParejas(Pob, Maximizar);
+	if(numParejas == 0)
+		return;
+	Individuo **ppHijos = new Individuo*[2*numParejas];
+	for(k=0; k<numParejas; k++)
 	{
-		pInd = &Pob.getIndividuo(i);
-		if(pInd->getPareja())
+		ppHijos[k] = new Individuo(*m_ppPadres[k]);
+		ppHijos[numParejas+k] = new Individuo(*m_ppPadres[k]);
+	}
+	cruzarLotes(Pob, numParejas, ppHijos, ppHijos+numParejas);
+	for(k=0; k<numParejas; k++)
+	{
+		Individuo *pIndiv[4]={m_ppPadres[k], m_ppPadres[numParejas+k], ppHijos[k], ppHijos[numParejas+k]};
+		double obj[4];
+		for(j=0;j<2;j++)
+			obj[j]=pIndiv[j]->objetivo();
+
+		//obtener posiciones de los dos mejores entre padres e hijos.
+		//Cada hijo solo necesita superar al segundo mejor encontrado hasta el momento
+		int p1=0, p2=1;
+		if( (Maximizar && obj[1]>obj[0]) || (!Maximizar && obj[1]<obj[0]) )
 		{
-			condicion= (pInd->objetivo() > pInd->getPareja()->objetivo());			
-			if((Maximizar && condicion) || (!Maximizar && !condicion))
-			{
-				pMejor = new Individuo(*pInd);
-				pPeor = new Individuo(*pInd->getPareja());
-			}
-			else
-			{
-				pMejor = new Individuo(*pInd->getPareja());
-				pPeor = new Individuo(*pInd);
-			}
-			pHijo1 = new Individuo(*pMejor);
-			pHijo2 = new Individuo(*pMejor);
-			for(j=0;j<tamGenoma;j++)
+			p1=1;
+			p2=0;
+		}
+		for(j=2;j<4;j++)
+		{
+			obj[j]=pIndiv[j]->objetivoAcotado(obj[p2]);
+			if( (Maximizar && obj[j]>obj[p1]) || (!Maximizar && obj[j]<obj[p1]) )
 			{
-				Arreglo<Gen>* Hijos = new Arreglo<Gen>;
-				OC = &pAG->m_pListaOperadorCruce->getObj(j);		
-				OC->cruzarGenes( &pMejor->getGen(j) , &pPeor->getGen(j) , Hijos, 2, i);
-				
-				Gen *pTemp = pHijo1->remplazarGen( &Hijos->getObj(0), j);
-				delete pTemp;
-				pTemp = pHijo2->remplazarGen( &Hijos->getObj(1), j);
-				delete pTemp;
-				Hijos->FlushDetach();
-				delete Hijos;
+				p2=p1;
+				p1=j;
 			}
-			Individuo *pIndiv[4]={pMejor,pPeor,pHijo1,pHijo2};
-			double obj[4];
-			for(j=0;j<4;j++)
+			else if( (Maximizar && obj[j]>obj[p2]) || (!Maximizar && obj[j]<obj[p2]) )
 			{
-				if(Maximizar)
-					obj[j]=pIndiv[j]->objetivo();
-				else
-					obj[j]=-(pIndiv[j]->objetivo());
+				p2=j;
 			}
-			//obtener posiciones de los dos mejores entre padres e hijos
-			int p1=0, p2=1;
-			for(j=1;j<4;j++)
-			{
-				if(obj[j]>obj[p1])
-				{
-					p2=p1;
-					p1=j;
-				}
-				else if(obj[j]>obj[p2])
-				{
-					p2=j;
-				}
-			}
-
+		}
 #if defined(UN_DEBUG)
-			if(Maximizar)
-				wxASSERT( pIndiv[p1]->objetivo() >= pIndiv[p2]->objetivo());
-			else
-				wxASSERT( pIndiv[p1]->objetivo() <= pIndiv[p2]->objetivo());
+		if(Maximizar)
+			wxASSERT( pIndiv[p1]->objetivo() >= pIndiv[p2]->objetivo());
+		else
+			wxASSERT( pIndiv[p1]->objetivo() <= pIndiv[p2]->objetivo());
 #endif
 
-			*(pInd->getPareja()) = *(pIndiv[p2]);
-			pInd->getPareja()->asignarPareja(NULL);
-			*pInd = *(pIndiv[p1]);
-			pInd->asignarPareja(NULL);
-			for(j=0;j<4;j++)
-			{				
-				delete pIndiv[j];
-			}		
-		}
+		//el individuo que aport la pareja recibe el mejor, y su pareja el segundo.
+		//Se copian antes, pues pueden ser los mismos padres que se sobrescriben
+		Individuo primero(*pIndiv[p1]), segundo(*pIndiv[p2]);
+		Individuo *pInd = &Pob.getIndividuoDirecto(m_pIndices[k]);
+		Individuo *pPareja = (pInd == pIndiv[0]) ? pIndiv[1] : pIndiv[0];
+		*pPareja = segundo;
+		*pInd = primero;
+		delete ppHijos[numParejas+k];
+		delete ppHijos[k];
 	}
+	delete [] ppHijos;
 }
 
  
@@ -9,6 +9,11 @@
 #include<time.h>
 
 #include "arreglos.h"
+#include "afinidad.h"
+
+#if defined(UN_PROCESOS)
+#	include <unistd.h>
+#endif
 
 
 /*Slo incluimos las clases que manejan entorno grfico si est
@@ -45,6 +50,14 @@ enum EstadosIndividuo
 	ESTADO_CREAR
 };
 
+//!Constantes que indican a cul individuo de la poblacin remplaza cada hijo en AlgoritmoGeneticoEstacionario
+enum TiposRemplazo
+{
+	REMPLAZO_PEOR	=	1,
+	REMPLAZO_AZAR,
+	REMPLAZO_SIMILAR
+};
+
 
 /************************************************************/
 /*					Declaracin de clases					*/
@@ -70,6 +83,8 @@ class OperadorSeleccion;
 
 long redondear(double);
 
+long azarEntero(long n);
+
 /*!Comprueba si \a valor se encuentra dentro de un rango determinado y lo
 restringe a los lmites.
 \param valor Valor a restringir
@@ -109,6 +124,9 @@ class Gen
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
 public:	
+	//!Los genes creados con \a new usan la memoria del algoritmo activo (Ver MemoriaAG)
+	USAR_MEMORIA_AG
+
 	//!Constructor por defecto
 	/*!Debe sobrecargarse en las clases derivadas si se requiere inicializar algn miembro*/
 	Gen(){}
@@ -141,6 +159,61 @@ public:
 	Esta funcin se podra reemplazar por el operador de asignacin (=) si Gen no 
 	fuera una clase abstracta.*/
 	virtual void copiar(const Gen& otro)=0;
+
+	//!Retorna la distancia entre el gen y otro gen del mismo tipo
+	/*!Se utiliza en el remplazo por similitud de AlgoritmoGeneticoEstacionario.
+	Puede sobrecargarse en las clases derivadas; por defecto todos los genes se consideran iguales.
+	\return Valor no negativo, preferiblemente en el intervalo [0, 1].*/
+	virtual double distancia(const Gen&) const
+	{
+		return 0.0;
+	}
+
+	//!Retorna el nmero de valores numricos con los que se representa el gen
+	/*!Se utiliza para enviar el gen a evaluadores externos (Ver EvaluadorProcesos).
+	Puede sobrecargarse en las clases derivadas; por defecto el gen no tiene valores.*/
+	virtual int numValores() const
+	{
+		return 0;
+	}
+
+	//!Escribe los valores numricos del gen
+	/*!Debe sobrecargarse junto con \a numValores().
+	\param pDestino Apuntador a un arreglo con espacio para \a numValores() datos.*/
+	virtual void getValores(double *pDestino) const
+	{
+	}
+
+	//!Asigna al gen los valores numricos escritos por \a getValores()
+	/*!Se utiliza para reconstruir el gen en otro proceso (Ver EvaluadorRed).
+	Puede sobrecargarse en las clases derivadas; por defecto no hace nada.
+	\param pOrigen Apuntador a los valores.
+	\param numValores Nmero de valores. Los genes de tamao variable toman este tamao.*/
+	virtual void setValores(const double *pOrigen, int numValores)
+	{
+	}
+};
+
+
+/************************************************************************/
+/*						CLASE GenomaCompartido							*/
+/************************************************************************/
+
+//!Arreglo de genes que puede ser compartido por varios individuos
+/*!Lleva la cuenta de los individuos que lo comparten. Un individuo que deba
+modificar un genoma compartido crea antes su propia copia (copia al escribir).*/
+class GenomaCompartido:public Arreglo<Gen>
+{
+public:
+	//!Crea un genoma vaco con una sola referencia
+	GenomaCompartido():m_referencias(1){}
+
+	//!Nmero de individuos que comparten el genoma
+#if defined(UN_CPP11)
+	std::atomic<int> m_referencias;
+#else
+	int m_referencias;
+#endif
 };
 
 
@@ -155,6 +228,9 @@ le proporcionan las caracter
 class Individuo
 {
 public:
+	//!Los individuos creados con \a new usan la memoria del algoritmo activo (Ver MemoriaAG)
+	USAR_MEMORIA_AG
+
 	//!Constructor por defecto
 	Individuo(AlgoritmoGenetico *pAG);
 
@@ -182,6 +258,18 @@ public:
 	{		
 		return m_pGenoma->getObj(pos);
 	}
+
+	//!Devuelve el gen ubicado en una posicin determinada del genoma para ser modificado. 
+	/*!Si el genoma es compartido con otros individuos, antes se crea una copia propia.
+	La funcin objetivo del individuo queda desactualizada.
+	\param pos Posicin del gen a obtener
+	\return referencia al gen ubicado en la posicin \a pos.*/
+	Gen& getGenModificable(int pos)
+	{		
+		separarGenoma();
+		desactualizarObjetivo();
+		return m_pGenoma->getObj(pos);
+	}
 	
 	//!Adiciona un gen al final del genoma del individuo. 
 	/*!
@@ -189,7 +277,8 @@ public:
 	\return Posicin en la que fue adicionado el gen.*/
 	int adicionarGen(Gen* pGen)
 	{
-		m_objetivoActualizado = false;
+		separarGenoma();
+		desactualizarObjetivo();
 		return m_pGenoma->Adicionar(pGen);
 	}
 	
@@ -197,19 +286,46 @@ public:
 	/*! 
 	\param pNuevoGen Apuntador al gen que remplazar al gen ubicado en la posicin especificada.
 	\param pos Posicin del gen a remplazar.
-	\return Apuntador al gen reemplazado.*/
+	\return Apuntador al gen reemplazado. Pertenece a quien invoca la funcin, que debe destruirlo.*/
 	Gen* remplazarGen(Gen* pNuevoGen, int pos)
 	{
-		m_objetivoActualizado = false;
+		separarGenoma();
+		desactualizarObjetivo();
 		return m_pGenoma->remplazar(pNuevoGen, pos);		
 	}
+
+	//!Indica si el genoma del individuo es compartido con otros individuos
+	bool genomaCompartido() const
+	{
+		return m_pGenoma->m_referencias > 1;
+	}
+
+	//!Retorna la distancia entre el genoma del individuo y el de otro individuo
+	double distancia(const Individuo& otro) const;
+
+	//!Retorna el nmero de valores numricos con los que se representa el genoma
+	int numValores() const;
+
+	//!Escribe los valores numricos de todos los genes, en el orden del genoma
+	void getValores(double *pDestino) const;
+
+	//!Asigna los valores numricos de todos los genes, en el orden del genoma
+	void setValores(const double *pOrigen, const int *pNumValores);
+
+	//!Indica si el individuo comparte el genoma con otro individuo
+	/*!\param otro Individuo con el que se compara.
+	\return \a true si ambos usan el mismo genoma, y por lo tanto son idnticos.*/
+	bool mismoGenoma(const Individuo& otro) const
+	{
+		return m_pGenoma == otro.m_pGenoma;
+	}
 	
 	//!Cambia el algoritmo genetico al que pertenece el individuo
 	/*!\param pAG Apuntador al objeto AlgoritmoGentico del que har parte el individuo.*/
 	void SetAG(AlgoritmoGenetico *pAG)
 	{
 		m_pAG = pAG;
-		m_objetivoActualizado = false;	//el nuevo algoritmo podra tener una funcin objetivo diferente.
+		desactualizarObjetivo();	//el nuevo algoritmo podra tener una funcin objetivo diferente.
 	}
 
 	//!Asigna la probabilidad de supervivencia del individuo
@@ -228,8 +344,37 @@ public:
 	/*!Retorna el valor de la funcion objetivo del individuo*/
 	double objetivo(bool actualizarAG = false);
 
+	//!Retorna el valor de la funcin objetivo, o una cota de l si no es mejor que \a cota
+	double objetivoAcotado(double cota);
+
+	//!Asigna el valor de la funcin objetivo calculado fuera del individuo
+	/*!Lo usan los evaluadores (Ver Evaluador), que calculan la funcin objetivo 
+	en otro hilo, proceso o equipo.
+	\param valor Valor de la funcin objetivo para el genoma actual del individuo.*/
+	void asignarObjetivo(double valor)
+	{
+		m_Objetivo = valor;
+		m_objetivoActualizado = true;
+		m_objetivoEsCota = false;
+	}
+
+	//!Indica si el valor de la funcin objetivo corresponde al genoma actual
+	bool objetivoActualizado() const
+	{
+		return m_objetivoActualizado;
+	}
+
+	//!Indica si el valor guardado de la funcin objetivo es solo una cota (Ver \a objetivoAcotado())
+	bool objetivoEsCota() const
+	{
+		return m_objetivoEsCota;
+	}
+
 	//!Ordena al individuo que pase por el proceso de mutacin
 	void mutar();
+
+	//!Muta el gen ubicado en la posicin \a pos, sin decidir si debe mutar
+	void mutarGen(int pos);
 	
 	//!Retorna la probabilidad de supervivencia del individuo
 	/*!\return Probabilidad de supervivencia del individuo*/
@@ -253,9 +398,23 @@ public:
 	}
 
 protected:
+
+	//!Crea una copia propia del genoma si ste es compartido con otros individuos
+	void separarGenoma()
+	{
+		if(m_pGenoma->m_referencias > 1)
+			copiarGenoma();
+	}
+
+	//!Reemplaza el genoma compartido por una copia propia
+	void copiarGenoma();
+
+	//!Deja de usar el genoma actual, destruyndolo si no lo comparte ningn otro individuo
+	void soltarGenoma();
 	
 	//!Arreglo de apuntadores a objetos de las clases derivadas de Gen que contienen la informacin gentica del individuo
-	Arreglo<Gen> *m_pGenoma;
+	/*!Puede ser compartido por varios individuos copiados unos de otros (Ver GenomaCompartido).*/
+	GenomaCompartido *m_pGenoma;
 
 	//!Apuntador al algoritmo genetico al que pertenece el individuo
 	AlgoritmoGenetico* m_pAG;
@@ -268,12 +427,24 @@ protected:
 
 
 private:
+	//!Marca la funcin objetivo como desactualizada, despus de un cambio en el genoma
+	void desactualizarObjetivo()
+	{
+		m_objetivoActualizado = false;
+		m_objetivoEsCota = false;
+	}
+
 	//!Indica si \a m_Objetivo refleja el valor actual de la funcin objetivo. 
 	/*!Se establece a \a false despus de cualquier cambio 
 	en el genoma para recalcular la funcion objetivo cuando es invocado el mtodo
 	\a objetivo().*/
 	bool m_objetivoActualizado;
 
+	//!Indica si \a m_Objetivo es una cota de la funcin objetivo calculada por \a objetivoAcotado()
+	/*!La cota es peor o igual que el valor exacto. Solo es vlida mientras \a m_objetivoActualizado
+	sea \a false y el genoma no cambie.*/
+	bool m_objetivoEsCota;
+
 	//!Almacena el valor de la funcin objetivo
 	double m_Objetivo;
 };
@@ -311,6 +482,9 @@ public:
 
 	//!Ordena los miembros de la poblacin segun su funcin de evaluacin
 	void ordenar(bool Maximizar=false);
+
+	//!Retorna la posicin del individuo con la peor funcin de evaluacin
+	int getPosPeor(bool Maximizar=false) const;
 	
 	//!Cambia el algoritmo genetico al que pertenece la poblacin
 	/*!\param Ag Apuntador al objeto AlgoritmoGentico del que har parte la poblacion.*/
@@ -328,6 +502,15 @@ public:
 		return m_pGeneracion->getObj(pos);
 	}
 
+	//!Devuelve el individuo ubicado en una posicin determinada de la poblacin, sin verificar la posicin
+	/*!
+	\param pos Posicin del individuo a obtener. Debe estar en el rango [0, getTam()-1].
+	\return referencia al individuo ubicado en la posicin \a pos.*/
+	Individuo &getIndividuoDirecto(int pos) const
+	{		
+		return m_pGeneracion->getObjDirecto(pos);
+	}
+
 	//!Inserta un individuo en una posicin determinada de la poblacin. 
 	int InsertarIndividuo(Individuo* ind, int indice=-1);
 	
@@ -354,15 +537,312 @@ public:
 	//!Ordena a la poblacin que pase por el proceso de mutacin
 	void mutar();
 
+	//!Muta la poblacin gen por gen, aplicando cada operador a la vez a todos los valores que mutan
+	void mutarColumnas();
+
+	//!Prepara el arreglo de la siguiente generacin con tantos individuos como la actual
+	void prepararSiguiente();
+
+	//!Devuelve el individuo ubicado en una posicin determinada de la siguiente generacin
+	/*!Debe invocarse antes \a prepararSiguiente(). El individuo puede modificarse 
+	libremente, por ejemplo asignndole otro individuo de la generacin actual.
+	\param pos Posicin del individuo a obtener
+	\return referencia al individuo ubicado en la posicin \a pos de la siguiente generacin.*/
+	Individuo &getSiguiente(int pos) const
+	{		
+		return m_pSiguiente->getObjDirecto(pos);
+	}
+
+	//!Convierte la siguiente generacin en la generacin actual
+	void intercambiar();
+
 protected:
 	//!Apuntador al objeto de la clase AlgoritmoGenetico al que pertenece la poblacion
 	AlgoritmoGenetico *m_pAG;
 
 	//!Arreglo de objetos de la clase Individuo que conforman la poblacin
 	Arreglo<Individuo> *m_pGeneracion;
+
+	//!Arreglo de individuos en el que se construye la siguiente generacin
+	/*!Sus individuos se reutilizan de una generacin a otra, intercambindolo con \a m_pGeneracion, 
+	de modo que solo se crean nuevos individuos cuando crece el tamao de la poblacin.*/
+	Arreglo<Individuo> *m_pSiguiente;
+
+	//!Valores de los genes que mutan en \a mutarColumnas(). Se reutiliza entre generaciones
+	double *m_pValoresMutacion;
+	//!Posiciones de los individuos cuyos valores estn en \a m_pValoresMutacion
+	int *m_pFilasMutacion;
+	//!Capacidad de \a m_pValoresMutacion y \a m_pFilasMutacion
+	int m_capacidadMutacion;
 }; 
 
 
+/************************************************************************/
+/*						CLASE MatrizPoblacion							*/
+/************************************************************************/
+
+//!Matriz con los valores de los genes de un conjunto de individuos
+/*!Cada fila corresponde a un individuo y cada columna a un gen, por lo que solo se usa
+cuando todos los genes se representan con un valor (Ver \a admite()), como GenReal.
+Los valores se almacenan por columnas: los de un mismo gen en todos los individuos
+quedan contiguos, y un operador puede procesarlos en un solo ciclo que el compilador
+vectoriza (Ver OperadorCruce::cruzarColumna() y OperadorMutacion::mutarColumna()).
+La memoria se conserva al cambiar las dimensiones, para reutilizarla entre generaciones.*/
+class MatrizPoblacion
+{
+public:
+	//!Constructor por defecto. Crea una matriz vaca
+	MatrizPoblacion():m_pValores(NULL),m_numFilas(0),m_numColumnas(0),m_capacidad(0){}
+
+	//!Destructor
+	~MatrizPoblacion()
+	{
+		delete [] m_pValores;
+	}
+
+	//!Cambia las dimensiones de la matriz. Los valores anteriores se pierden
+	void dimensionar(int numFilas, int numColumnas);
+
+	//!Retorna el nmero de filas (individuos)
+	int getNumFilas() const
+	{
+		return m_numFilas;
+	}
+
+	//!Retorna el nmero de columnas (genes)
+	int getNumColumnas() const
+	{
+		return m_numColumnas;
+	}
+
+	//!Retorna los valores del gen \a columna en todas las filas, uno tras otro
+	double *getColumna(int columna)
+	{
+		return m_pValores + columna*m_numFilas;
+	}
+
+	//!Copia en la fila \a fila los valores de los genes de un individuo
+	void leerFila(int fila, const Individuo &ind);
+
+	//!Asigna a los genes de un individuo los valores de la fila \a fila
+	void escribirFila(int fila, Individuo &ind) const;
+
+	//!Indica si todos los genes del individuo se representan con un solo valor
+	static bool admite(const Individuo &modelo);
+
+protected:
+	//!Valores de la matriz, por columnas
+	double *m_pValores;
+	//!Nmero de filas
+	int m_numFilas;
+	//!Nmero de columnas
+	int m_numColumnas;
+	//!Nmero de valores para los que hay memoria en \a m_pValores
+	int m_capacidad;
+
+private:
+	//!No se permite la copia
+	MatrizPoblacion(const MatrizPoblacion&);
+	//!No se permite la asignacin
+	const MatrizPoblacion& operator = (const MatrizPoblacion&);
+};
+
+
+/************************************************************************/
+/*						CLASE GruposOperadores							*/
+/************************************************************************/
+
+//!Asigna a cada posicin del genoma su operador y agrupa las posiciones que comparten operador
+/*!AlgoritmoGenetico::crearOperadores() la usa para planear la mutacin y el cruce: los genes de
+un grupo se procesan en todos los individuos con una sola invocacin de su operador (Ver
+OperadorMutacion::mutarLote() y OperadorCruce::cruzarLote()), en lugar de buscar el operador y
+invocarlo gen por gen.
+
+Los arreglos de operadores tienen un solo elemento por operador, de modo que cada operador se
+destruye una sola vez. Por defecto cada operador se aplica a un gen; con
+ADICIONAR_OPERADOR_MUTACION_GENES o ADICIONAR_OPERADOR_CRUCE_GENES se aplica a varios genes
+consecutivos (Ver \a asignarGenes()). Las posiciones del genoma se reparten entre los operadores en
+el orden del arreglo, y cada grupo corresponde al operador con el mismo ndice.
+Las posiciones de cada grupo quedan en orden creciente, y los grupos en el orden de su primera posicin.*/
+class GruposOperadores
+{
+public:
+	//!Constructor por defecto. No crea ningn grupo
+	GruposOperadores():m_pPosiciones(NULL),m_pInicio(NULL),m_pOperador(NULL),m_pGenes(NULL),
+		m_numGrupos(0),m_numPosiciones(0),m_numGenes(0){}
+
+	//!Destructor
+	~GruposOperadores()
+	{
+		delete [] m_pPosiciones;
+		delete [] m_pInicio;
+		delete [] m_pOperador;
+		delete [] m_pGenes;
+	}
+
+	//!Indica que el operador ubicado en \a operador se aplica a \a numGenes genes consecutivos
+	void asignarGenes(int operador, int numGenes);
+
+	//!Olvida los nmeros de genes asignados con \a asignarGenes()
+	void reiniciarGenes()
+	{
+		m_numGenes = 0;
+	}
+
+	//!Retorna el nmero de genes a los que se aplican los primeros \a numOperadores operadores
+	int contarGenes(int numOperadores) const;
+
+	//!Reparte las primeras \a numPosiciones posiciones del genoma entre \a numOperadores operadores
+	void agrupar(int numOperadores, int numPosiciones);
+
+	//!Retorna el nmero de grupos
+	int getNumGrupos() const
+	{
+		return m_numGrupos;
+	}
+
+	//!Retorna el nmero de posiciones agrupadas, contando todos los grupos
+	int getNumPosiciones() const
+	{
+		return m_numPosiciones;
+	}
+
+	//!Retorna el nmero de posiciones del grupo \a grupo
+	int getNumPosiciones(int grupo) const
+	{
+		return m_pInicio[grupo+1] - m_pInicio[grupo];
+	}
+
+	//!Retorna las posiciones del grupo \a grupo, en orden creciente
+	const int *getPosiciones(int grupo) const
+	{
+		return m_pPosiciones + m_pInicio[grupo];
+	}
+
+	//!Retorna el ndice en el arreglo de operadores del operador de la posicin \a pos del genoma
+	int getOperador(int pos) const
+	{
+		return m_pOperador[pos];
+	}
+
+protected:
+	//!Posiciones de todos los grupos, uno tras otro
+	int *m_pPosiciones;
+	//!Lugar en \a m_pPosiciones donde empieza cada grupo. Tiene \a m_numGrupos+1 elementos
+	int *m_pInicio;
+	//!ndice del operador de cada posicin del genoma
+	int *m_pOperador;
+	//!Nmero de genes de cada operador, segn \a asignarGenes(). Tiene \a m_numGenes elementos
+	int *m_pGenes;
+	//!Nmero de grupos
+	int m_numGrupos;
+	//!Nmero de posiciones agrupadas
+	int m_numPosiciones;
+	//!Nmero de operadores con genes asignados en \a m_pGenes
+	int m_numGenes;
+
+private:
+	//!No se permite la copia
+	GruposOperadores(const GruposOperadores&);
+	//!No se permite la asignacin
+	const GruposOperadores& operator = (const GruposOperadores&);
+};
+
+
+/************************************************************************/
+/*						CLASE MonticuloIndexado							*/
+/************************************************************************/
+
+//!Montculo de las posiciones de una poblacin ordenadas segn el valor de su funcin objetivo
+/*!Cada posicin \a indice de la poblacin tiene un valor asociado. La raz del montculo es la 
+posicin con el mayor valor, o con el menor si as se indica en \a iniciar(). Como se conoce en qu 
+lugar del montculo est cada posicin, cambiar el valor de cualquiera de ellas con \a actualizar() 
+cuesta O(log n), sin necesidad de ordenar de nuevo toda la poblacin.*/
+class MonticuloIndexado
+{
+public:
+	//!Constructor por defecto. Crea un montculo vaco
+	MonticuloIndexado();
+
+	//!Destructor
+	~MonticuloIndexado();
+
+	//!Prepara el montculo para las posiciones 0 a \a n-1
+	void iniciar(int n, bool raizMayor);
+
+	//!Asigna el valor de una posicin sin reordenar el montculo
+	/*!Debe invocarse \a construir() despus de asignar todos los valores.
+	\param indice Posicin en la poblacin, en el rango [0, getTam()-1].
+	\param valor Valor asociado a la posicin.*/
+	void asignar(int indice, double valor)
+	{
+		m_pValores[indice] = valor;
+	}
+
+	//!Ordena el montculo a partir de los valores asignados
+	void construir();
+
+	//!Cambia el valor de una posicin y restablece el orden del montculo
+	void actualizar(int indice, double valor);
+
+	//!Retorna la posicin que ocupa la raz del montculo
+	int getRaiz() const
+	{
+		return m_pMonticulo[0];
+	}
+
+	//!Retorna el valor asociado a una posicin
+	double getValor(int indice) const
+	{
+		return m_pValores[indice];
+	}
+
+	//!Retorna el nmero de posiciones del montculo
+	int getTam() const
+	{
+		return m_tam;
+	}
+
+protected:
+	//!Indica si la posicin \a a debe quedar ms cerca de la raz que la posicin \a b
+	bool antes(int a, int b) const
+	{
+		return m_raizMayor ? (m_pValores[a] > m_pValores[b]) : (m_pValores[a] < m_pValores[b]);
+	}
+
+	//!Ubica la posicin \a indice en el lugar \a lugar del montculo
+	void colocar(int lugar, int indice)
+	{
+		m_pMonticulo[lugar] = indice;
+		m_pLugar[indice] = lugar;
+	}
+
+	//!Mueve hacia la raz el elemento ubicado en \a lugar
+	void subir(int lugar);
+
+	//!Mueve hacia las hojas el elemento ubicado en \a lugar
+	void hundir(int lugar);
+
+	//!Nmero de posiciones
+	int m_tam;
+	//!Nmero de posiciones para las que hay espacio reservado
+	int m_capacidad;
+	//!Indica si la raz es el mayor valor o el menor
+	bool m_raizMayor;
+	//!Posiciones de la poblacin en el orden del montculo
+	int *m_pMonticulo;
+	//!Lugar en el montculo de cada posicin de la poblacin
+	int *m_pLugar;
+	//!Valor asociado a cada posicin de la poblacin
+	double *m_pValores;
+
+private:
+	//No se puede copiar
+	MonticuloIndexado(const MonticuloIndexado&);
+	const MonticuloIndexado& operator = (const MonticuloIndexado&);
+};
+
+
 /************************************************************************/
 /*						CLASE AlgoritmoGenetico							*/
 /************************************************************************/
@@ -406,6 +886,7 @@ public:
 	virtual ~AlgoritmoGenetico()
 	{	
 		finalizarOptimizacion();
+		m_pMemoria->soltar();
 	}
 
 	//!En esta funcin deben definirse los tres estados de codificacin de un individuo
@@ -447,20 +928,79 @@ public:
 	\return Valor de la funcin de evaluacin para las variables actuales del sistema.*/
 	virtual double objetivo()=0;
 
+	//!Calcula la funcin objetivo, pudiendo terminar en cuanto se sepa que no es mejor que \a cota
+	/*!Puede sobrecargarse en las clases derivadas cuando la funcin objetivo es una acumulacin 
+	montona, como una suma de errores o de castigos al minimizar. Se invoca igual que \a objetivo(),
+	despus de decodificar el individuo, y solo si \a m_IndicadorObjetivoAcotado es \a true
+	(Ver Individuo::objetivoAcotado()).
+	\param cota Valor que el individuo debe superar.
+	\return El valor exacto de la funcin objetivo, o, si termina antes, un valor parcial que no es 
+	mejor que \a cota y que tampoco es mejor que el valor exacto.*/
+	virtual double objetivoAcotado(double cota)
+	{
+		m_ObjetivoAcotadoExacto = true;
+		return objetivo();
+	}
+
+	//!Calcula la funcin objetivo con \a objetivoAcotado() e indica si el valor obtenido es exacto
+	/*!El valor es exacto si lo calcul la versin por defecto de \a objetivoAcotado(), que no
+	termina antes de tiempo. Lo usa Individuo::objetivoAcotado().
+	\param cota Valor que el individuo debe superar.
+	\param exacto Recibe \a true si el valor es exacto, o \a false si puede ser solo una cota.*/
+	double calcularObjetivoAcotado(double cota, bool &exacto)
+	{
+		m_ObjetivoAcotadoExacto = false;
+		double valor = objetivoAcotado(cota);
+		exacto = m_ObjetivoAcotadoExacto;
+		return valor;
+	}
+
 	//!Ejecuta todo el proceso de optimizacin
 	virtual void optimizar();
 
+	//!Crea otro objeto de la misma clase del algoritmo, con el constructor por defecto
+	/*!Los evaluadores que calculan la funcin objetivo en varios hilos (Ver EvaluadorHilos) 
+	usan una instancia por hilo, de modo que cada una decodifica los individuos en sus propias 
+	variables. La definen las macros DECLARAR_ALGORITMO; la instancia no se inicia, por lo que
+	los datos que necesite \a objetivo() deben prepararse en el constructor.
+	\return Apuntador al nuevo objeto, o NULL si la clase no lo permite.*/
+	virtual AlgoritmoGenetico* crearInstancia()
+	{
+		return NULL;
+	}
+
+	//!Recibe los datos fijos que necesita \a objetivo() cuando se evala en otro proceso
+	/*!Puede sobrecargarse en las clases derivadas. La invoca trabajarRed() cuando el
+	evaluador le enva los datos definidos con EvaluadorRed::setDatosEstaticos().
+	\param pDatos Apuntador a los datos. Solo es vlido durante la invocacin.
+	\param numDatos Nmero de datos.*/
+	virtual void asignarDatosEstaticos(const double *pDatos, int numDatos)
+	{
+	}
+
 	//!Prepara el algoritmo gentico para su ejecucin
 	void iniciarOptimizacion();
 
 	//!Efecta la siguiente iteracin del algoritmo
-	void iterarOptimizacion();
+	/*!Es virtual para que las clases derivadas puedan definir otra forma de iterar.*/
+	virtual void iterarOptimizacion();
 
 	//!Indica si el algoritmo debe finalizar
 	bool finalizar();
 
+	//!Indica si las medidas de la generacin actual se calculan con toda la poblacin
+	/*!Sin evaluacin perezosa siempre es \a true. Con ella, solo en la generacin 0 y cada
+	\a m_IntervaloMedidasCompletas generaciones; en las dems solo deben tenerse en cuenta
+	los individuos ya evaluados, para no forzar su evaluacin (Ver \a m_IndicadorEvaluacionPerezosa).*/
+	bool medidasCompletas() const
+	{
+		return !m_IndicadorEvaluacionPerezosa || m_Generacion==0 ||
+			(m_IntervaloMedidasCompletas>0 && m_Generacion%m_IntervaloMedidasCompletas==0);
+	}
+
 	//!Finaliza el algoritmo gentico
-	void finalizarOptimizacion();
+	/*!Es virtual para que las clases derivadas puedan destruir sus propios objetos.*/
+	virtual void finalizarOptimizacion();
 
 	//!Presenta en pantalla los resultados intermedios del algoritmo gentico
 	void mostrarMedidas();
@@ -479,6 +1019,48 @@ protected:
 	//!Crea los operadores a utilizar por el algoritmo
 	void crearOperadores();
 
+	//!Crea los operadores de probabilidad, seleccin, parejas y reproduccin que no defini el usuario
+	/*!Es virtual para que AlgoritmoGeneticoT cree los de la plantilla.*/
+	virtual void crearOperadoresGenerales();
+
+	//!Aplica a la poblacin los operadores de probabilidad, seleccin, parejas y reproduccin
+	/*!Es virtual para que AlgoritmoGeneticoT pueda invocar sus operadores sin el mecanismo virtual.*/
+	virtual void aplicarOperadoresGenerales();
+
+	//!Crea en \a hijo el descendiente de dos padres, cruzando cada gen con su operador, y lo muta
+	void crearDescendiente(Individuo &hijo, const Individuo &mejor, const Individuo &peor, double objMejor, double objPeor, int indice);
+
+	//!Recibe el operador de probabilidad creado por DEFINIR_OPERADOR_PROBABILIDAD
+	/*!AlgoritmoGeneticoT la oculta para aceptar solo operadores de la clase de la plantilla.*/
+	OperadorProbabilidad* definirOperadorProbabilidad(OperadorProbabilidad *pOp)
+	{
+		return pOp;
+	}
+
+	//!Recibe el operador de seleccin creado por DEFINIR_OPERADOR_SELECCION
+	OperadorSeleccion* definirOperadorSeleccion(OperadorSeleccion *pOp)
+	{
+		return pOp;
+	}
+
+	//!Recibe el operador de parejas creado por DEFINIR_OPERADOR_PAREJAS
+	OperadorParejas* definirOperadorParejas(OperadorParejas *pOp)
+	{
+		return pOp;
+	}
+
+	//!Recibe el operador de reproduccin creado por DEFINIR_OPERADOR_REPRODUCCION
+	OperadorReproduccion* definirOperadorReproduccion(OperadorReproduccion *pOp)
+	{
+		return pOp;
+	}
+
+	//!Crea la poblacin inicial del algoritmo
+	void crearPoblacion();
+
+	//!Actualiza las medidas, las salva o muestra si es necesario y avanza el contador de generaciones
+	void terminarIteracion();
+
 	//!Efecta la asignacin de probabilidad de supervivencia a los individuos de la poblacin	
 	void asignarProbabilidad();	
 
@@ -498,7 +1080,8 @@ protected:
 	void adaptacion();
 
 	//!Calcula los valores intermedios de las medidas de desempeo del algoritmo gentico
-	void actualizarMedidas();
+	/*!Es virtual para que AlgoritmoGeneticoEstacionario pueda actualizarlas de forma incremental.*/
+	virtual void actualizarMedidas();
 
 
 private:
@@ -532,15 +1115,23 @@ public:
 	Individuo *m_pModelo;
 
 	//!Arreglo de operadores de mutacin
-	/*!El tipo del operador en cada posicin del arreglo debe coincidir con 
-	el tipo de gen en la misma posicin del genoma del individuo modelo*/
+	/*!Cada operador se aplica por defecto a un gen, en el orden del genoma, y su tipo debe coincidir
+	con el de ese gen en el individuo modelo. Un operador que se aplica a varios genes aparece una
+	sola vez (Ver GruposOperadores)*/
 	Arreglo<OperadorMutacion> *m_pListaOperadorMutacion;
 
 	//!Arreglo de operadores de cruce
-	/*!El tipo del operador en cada posicin del arreglo debe coincidir con 
-	el tipo de gen en la misma posicin del genoma del individuo modelo*/	
+	/*!Cada operador se aplica por defecto a un gen, en el orden del genoma, y su tipo debe coincidir
+	con el de ese gen en el individuo modelo. Un operador que se aplica a varios genes aparece una
+	sola vez (Ver GruposOperadores)*/	
 	Arreglo<OperadorCruce> *m_pListaOperadorCruce;
 
+	//!Posiciones del genoma agrupadas segn su operador de mutacin. Se crean en \a crearOperadores()
+	GruposOperadores m_GruposMutacion;
+
+	//!Posiciones del genoma agrupadas segn su operador de cruce. Se crean en \a crearOperadores()
+	GruposOperadores m_GruposCruce;
+
 protected:
 	//!Apuntador al operador de asignacin de probabilidad de supervivencia
 	OperadorProbabilidad *m_pOpProbabilidad;
@@ -554,6 +1145,20 @@ protected:
 	Arreglo<OperadorAdaptacion> *m_pListaOperadorAdaptacion;
 	//!Arreglo de operadores de finalizacion
 	Arreglo<OperadorFinalizacion> *m_pListaOperadorFinalizacion;
+	//!Memoria en la que se crean los genes, individuos y arreglos durante la optimizacin
+	MemoriaAG *m_pMemoria;
+	//!Suma de las funciones objetivo del mejor en la historia en cada generacin, para la medida OffLine
+	double m_AcumuladoOffLine;
+	//!Suma de las funciones objetivo de los individuos medidos, para la medida OnLine
+	double m_AcumuladoOnLine;
+	//!Nmero de individuos medidos, para la medida OnLine
+	double m_TotalEvaluados;
+	//!Arreglo en el que los operadores de cruce entregan el gen del hijo en \a crearDescendiente()
+	Arreglo<Gen> *m_pGenesHijo;
+	//!Ncleos que tena el hilo antes de fijarse al nodo \a m_NodoNUMA
+	AfinidadHilo m_AfinidadAnterior;
+	//!Lo activa la versin por defecto de \a objetivoAcotado() (Ver \a calcularObjetivoAcotado())
+	bool m_ObjetivoAcotadoExacto;
 
 //@}
 public:
@@ -569,6 +1174,16 @@ public:
 	long m_IntervaloSalvar;
 	//!Nombre del archivo en que se guardan los valores intermedios de las iteraciones
 	char m_NombreArchivo[400];
+	//!Nodo NUMA en el que se ejecuta el algoritmo. Con -1 no se fija a ningn nodo (Ver TopologiaNUMA)
+	/*!El hilo que invoca \a iniciarOptimizacion() se fija a los ncleos del nodo antes de crear los
+	individuos, de modo que la memoria del algoritmo queda en ese nodo, y recupera los ncleos que
+	tena en \a finalizarOptimizacion(), que debe invocarse desde el mismo hilo. En un modelo de islas,
+	cada isla puede usar un nodo distinto. No tiene efecto en equipos con un solo nodo.*/
+	int m_NodoNUMA;
+	//!Cada cuntas generaciones se calculan las medidas con toda la poblacin cuando se usa la evaluacin perezosa
+	/*!En esas generaciones se evalan los individuos que no se han evaluado. Con 0 solo se evala
+	toda la poblacin inicial (Ver \a m_IndicadorEvaluacionPerezosa).*/
+	long m_IntervaloMedidasCompletas;
 	
 //@}
 
@@ -583,6 +1198,20 @@ public:
 	bool m_IndicadorInicializarPoblacionAleatoria;
 	//!Indica si debe maximizarse o minimizarse la funcin objetivo
 	bool m_IndicadorMaximizar;
+	//!Indica si la funcin objetivo solo se evala cuando un operador necesita su valor
+	/*!Sin evaluacin perezosa, \a actualizarMedidas() evala todos los individuos en cada generacin.
+	Con ella, las medidas de la generacin (media, desviacin, mejor y peor individuo y medida OnLine)
+	se calculan solo con los individuos que ya fueron evaluados, salvo cada \a m_IntervaloMedidasCompletas
+	generaciones y en la generacin 0, en las que se evala toda la poblacin.
+
+	Si no se definen, los operadores por defecto pasan a ser OperadorProbabilidadHomogenea,
+	OperadorSeleccionTorneo y OperadorReproduccionDosPadresDosHijos, que solo evalan los individuos
+	que comparan. Los hijos que no llegan a participar en un torneo se descartan sin evaluarse.
+	Los operadores que ordenan la poblacin, como OperadorProbabilidadLineal, la evalan completa.*/
+	bool m_IndicadorEvaluacionPerezosa;
+	//!Indica si los operadores que comparan individuos pueden usar \a objetivoAcotado() 
+	/*!Debe activarse en \a inicializarParametros() cuando se sobrecarga \a objetivoAcotado().*/
+	bool m_IndicadorObjetivoAcotado;
 	//!Indica si deben salvarse los resultados intermedios de las iteraciones del algoritmo gentico
 	bool m_IndicadorArchivo;
 	//!Indica si deben mostrarse en pantalla los resultados intermedios de las iteraciones del algoritmo gentico
@@ -629,6 +1258,9 @@ public:
 	double m_MedidaOffLineAnterior;
 	//!Desviacin estndar de las funciones objetivo de los individuos presentes en la generacin actual.
 	double m_Desviacion;
+	//!Nmero de individuos con los que se calcularon las medidas de la generacin actual
+	/*!Es el tamao de la poblacin, salvo con evaluacin perezosa, en la que solo se cuentan los evaluados.*/
+	int m_IndividuosMedidos;
 
 //@}
 };
@@ -688,9 +1320,72 @@ public:
 	teniendo en cuenta la probabilidad de mutacin de cada gen.
 	\param pGen Apuntador al objeto derivado de Gen sobre el que se toma la decisin.*/
 	virtual void mutar(Gen *pGen)
+	{
+		if(decidirMutacionGen(pGen)) mutarGen(pGen);
+	}
+
+	//!Decide aleatoriamente si un gen debe mutar, teniendo en cuenta la probabilidad de mutacin
+	/*!Puede sobrecargarse en las clases derivadas cuya mutacin no se decide 
+	con un solo nmero aleatorio; en ese caso debe retornar \a true.
+	\return \a true si el gen debe mutar.*/
+	virtual bool decidirMutacion()
 	{
 		double azar= (double)rand()/(double)RAND_MAX;
-		if(azar<m_ProbabilidadMutacion)	mutarGen(pGen);
+		return azar<m_ProbabilidadMutacion;
+	}
+
+	//!Decide aleatoriamente si algn valor de un gen debe mutar
+	/*!Los operadores de genes con varios valores (arreglos, vectores, genomas fijos) la sobrecargan
+	para decidir si muta al menos uno de ellos, y conservan esa decisin para la siguiente invocacin
+	de \a mutarGen(), que solo debe hacerse si retorna \a true y sobre el mismo gen. As no se separa
+	el genoma del individuo ni se desactualiza su funcin objetivo cuando nada muta.
+	Por defecto invoca \a decidirMutacion().
+	\param pGen Apuntador al gen sobre el que se toma la decisin. No se modifica.
+	\return \a true si algn valor del gen debe mutar.*/
+	virtual bool decidirMutacionGen(const Gen *pGen)
+	{
+		return decidirMutacion();
+	}
+
+	//!Indica si la mutacin se decide solo con \a decidirMutacion() de esta clase
+	/*!Poblacion::mutar() lo usa para decidir de una vez cules genes de toda la poblacin mutan,
+	sin invocar \a decidirMutacion() en cada gen. Las clases derivadas que sobrecarguen
+	\a decidirMutacion() deben sobrecargarla tambin y retornar \a false.
+	\return \a true si el gen muta con probabilidad \a m_ProbabilidadMutacion, con un solo nmero aleatorio.*/
+	virtual bool decisionSimple() const
+	{
+		return true;
+	}
+
+	//!Indica si el operador puede mutar a la vez los valores de un gen en varios individuos
+	/*!Poblacion::mutar() lo usa para mutar la poblacin por columnas (Ver \a mutarColumna()).
+	Las clases derivadas que sobrecarguen \a mutarColumna() deben sobrecargarla tambin.
+	\return \a true si el operador implementa \a mutarColumna().*/
+	virtual bool mutacionMatricial() const
+	{
+		return false;
+	}
+
+	//!Efecta la mutacin sobre los valores de un gen en varios individuos
+	/*!Todos los valores mutan; la decisin de cules mutan ya se tom. Debe sobrecargarse
+	junto con \a mutacionMatricial().
+	\param modelo Gen del individuo modelo, del que se toman los lmites.
+	\param pValores Valores del gen (Ver Gen::getValores()), que se remplazan por los mutados.
+	\param num Nmero de valores.*/
+	virtual void mutarColumna(const Gen &modelo, double *pValores, int num)
+	{
+	}
+
+	//!Efecta la mutacin de varios genes en todos los individuos de una poblacin
+	virtual void mutarLote(Individuo **ppIndividuos, int numIndividuos, const int *pPosiciones, int numPosiciones);
+
+	//!Efecta la mutacin sobre un gen, sin decidir si debe mutar
+	/*!Se usa junto con \a decidirMutacionGen(), por ejemplo para no crear una copia
+	del genoma de un individuo cuando ninguno de sus genes muta.
+	\param pGen Apuntador al gen sobre el que opera.*/
+	void aplicarMutacion(Gen *pGen)
+	{
+		mutarGen(pGen);
 	}
 
 	//!Retorna la probabilidad de mutacin del gen sobre el que opera
@@ -730,12 +1425,25 @@ class OperadorCruce
 public:
 	//!Constructor por defecto
 	/*!Debe sobrecargarse en las clases derivadas*/
-	OperadorCruce(){}
+	OperadorCruce():m_ObjetivoMejor(0.0),m_ObjetivoPeor(0.0){}
 
 	//!Destructor
 	/*!Es virtual para definirse en las clases derivadas*/
 	virtual ~OperadorCruce(){}
 
+	//!Asigna las funciones objetivo de los padres de la pareja que se cruza a continuacin
+	/*!Quienes invocan \a cruzarGenes() la invocan antes con los valores con los que se compararon
+	los padres, de modo que los operadores que los usan, como OperadorCruceRealLinealBGA, no
+	necesitan buscar a los padres en la poblacin. Los operadores compuestos la sobrecargan para
+	entregar los valores a los operadores que contienen.
+	\param mejor Funcin objetivo del padre con la mejor funcin de evaluacin.
+	\param peor Funcin objetivo del padre con la peor funcin de evaluacin.*/
+	virtual void asignarObjetivos(double mejor, double peor)
+	{
+		m_ObjetivoMejor = mejor;
+		m_ObjetivoPeor = peor;
+	}
+
 	//!Mtodo virtual que ejecuta el procedimiento de cruce entre dos indivduos
 	/*!Debe sobrecargarse en las clases derivadas.
 	\param pMejor Apuntador al gen padre con la mejor funcin de evaluacin.
@@ -744,6 +1452,37 @@ public:
 	\param numHijos Numero de genes hijos a crear en el cruce.
 	\param indice Valor que identifica al individuo de cuyos genes se realiza el cruce. No es utilizado en todas las clases derivadas*/
 	virtual void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos,int numHijos, int indice)=0;
+
+	//!Indica si el operador puede cruzar a la vez los valores de un gen en varias parejas
+	/*!Los operadores de reproduccin lo usan para cruzar la poblacin por columnas
+	(Ver OperadorReproduccion::cruzarMatriz()). Las clases derivadas que sobrecarguen
+	\a cruzarColumna() deben sobrecargarla tambin.
+	\return \a true si el operador implementa \a cruzarColumna().*/
+	virtual bool cruceMatricial() const
+	{
+		return false;
+	}
+
+	//!Cruza los valores de un gen en varias parejas, creando dos hijos por pareja
+	/*!Debe sobrecargarse junto con \a cruceMatricial().
+	\param modelo Gen del individuo modelo, del que se toman los lmites.
+	\param pMejor Valores del gen en el padre con la mejor funcin de evaluacin de cada pareja.
+	\param pPeor Valores del gen en el padre con la peor funcin de evaluacin de cada pareja.
+	\param pHijo1 Arreglo en el que se escriben los valores del primer hijo de cada pareja.
+	\param pHijo2 Arreglo en el que se escriben los valores del segundo hijo de cada pareja.
+	\param num Nmero de parejas.*/
+	virtual void cruzarColumna(const Gen &modelo, const double *pMejor, const double *pPeor, double *pHijo1, double *pHijo2, int num)
+	{
+	}
+
+	//!Cruza varios genes en varias parejas, creando dos hijos por pareja
+	virtual void cruzarLote(Individuo **ppMejores, Individuo **ppPeores, Individuo **ppHijos1, Individuo **ppHijos2, const int *pIndices, const double *pObjetivos, int numParejas, const int *pPosiciones, int numPosiciones);
+
+protected:
+	//!Funcin objetivo del mejor padre de la pareja que se cruza (Ver \a asignarObjetivos())
+	double m_ObjetivoMejor;
+	//!Funcin objetivo del peor padre de la pareja que se cruza (Ver \a asignarObjetivos())
+	double m_ObjetivoPeor;
 };
 
 
@@ -819,17 +1558,45 @@ class OperadorReproduccion
 public:
 	//!Constructor por defecto
 	/*!Debe sobrecargarse en las clases derivadas.*/
-	OperadorReproduccion(){}
+	OperadorReproduccion():m_ppPadres(NULL),m_pIndices(NULL),m_pObjetivos(NULL),m_capacidad(0){}
 
 	//!Destructor
 	/*!Es virtual para poder definirse en las clases derivadas.*/
-	virtual ~OperadorReproduccion(){}
+	virtual ~OperadorReproduccion()
+	{
+		delete [] m_ppPadres;
+		delete [] m_pIndices;
+		delete [] m_pObjetivos;
+	}
 
 	//!Ejecuta la estrategia general reproduccin para una poblacin
 	/*!Debe sobrecargarse en las clases derivadas.
 	\param Pob Referencia a la poblacin sobre la que opera.
 	\param Maximizar Su valor sirve como referencia para determinar qu individuo es mejor a otro dependiendo de su funcin de evaluacin.*/
 	virtual void reproducir(Poblacion& Pob, bool Maximizar)=0;
+
+protected:
+	//!Cruza todas las parejas de la poblacin por columnas, si los genes y los operadores de cruce lo permiten
+	int cruzarMatriz(Poblacion& Pob, bool Maximizar);
+
+	//!Rene en \a m_ppPadres el mejor y el peor individuo de cada pareja de la poblacin
+	int reunirParejas(Poblacion& Pob, bool Maximizar);
+
+	//!Cruza las parejas reunidas por \a reunirParejas(), un grupo de genes a la vez
+	void cruzarLotes(Poblacion& Pob, int numParejas, Individuo **ppHijos1, Individuo **ppHijos2);
+
+	//!Valores de los padres cruzados por \a cruzarMatriz(): primero el mejor de cada pareja y luego el peor
+	MatrizPoblacion m_Padres;
+	//!Valores de los hijos creados por \a cruzarMatriz(): primero el primer hijo de cada pareja y luego el segundo
+	MatrizPoblacion m_Hijos;
+	//!Padres reunidos por \a reunirParejas(), en el mismo orden de las filas de \a m_Padres
+	Individuo **m_ppPadres;
+	//!Posicin en la poblacin del individuo que aport cada pareja. Es el ndice que reciben los operadores de cruce
+	int *m_pIndices;
+	//!Funciones objetivo con que se compararon los padres de \a m_ppPadres, en el mismo orden
+	double *m_pObjetivos;
+	//!Capacidad de \a m_ppPadres, \a m_pIndices y \a m_pObjetivos
+	int m_capacidad;
 };
 
 
@@ -875,6 +1642,104 @@ public:
 };
 
 
+//!Clase derivada de la clase OperadorAdaptacion que efecta elitismo con un archivo de los \a k mejores individuos
+/*!El archivo conserva los \a k mejores individuos distintos encontrados durante la optimizacin.
+Dos individuos se consideran iguales si comparten el genoma o si sus genomas son idnticos
+(distancia nula), de modo que individuos distintos con el mismo valor de la funcin objetivo
+se archivan por separado. En cada generacin el archivo se actualiza con un montculo acotado cuya
+raz es el peor individuo archivado, y con otro montculo se ubican los \a k peores individuos de la
+generacin, sin contar los que estn en el archivo. Despus, los individuos archivados que no estn
+presentes en la poblacin sobrescriben en su lugar a los peores, siempre que sean mejores que ellos.
+
+Los candidatos son los mismos individuos que \a actualizarMedidas() tiene en cuenta (Ver
+AlgoritmoGenetico::medidasCompletas()): con evaluacin perezosa, en la mayora de las generaciones
+solo los ya evaluados, de modo que el elitismo no obliga a evaluar toda la poblacin.
+Los individuos del archivo y los montculos se crean una sola vez; las copias se hacen por asignacin,
+que solo comparte el genoma (ver Individuo::operator=).
+Se sobrescriben a lo sumo la mitad de los individuos de la poblacin.*/
+class OperadorAdaptacionElitismoArchivo:public OperadorAdaptacion
+{
+public:
+	//!Constructor
+	OperadorAdaptacionElitismoArchivo(int k=1);
+
+	//!Destructor
+	~OperadorAdaptacionElitismoArchivo();
+
+	//!Mtodo que efecta el proceso de elitismo
+	/*!\param pAG Apuntador al algoritmo gentico sobre el cual opera.*/
+	void adaptacion(AlgoritmoGenetico *pAG);
+
+	//!Retorna el nmero de individuos presentes en el archivo
+	int getTamArchivo() const
+	{
+		return m_numArchivo;
+	}
+
+	//!Retorna un individuo del archivo. El archivo no est ordenado
+	/*!\param pos Posicin en el archivo, en el rango [0, getTamArchivo()-1].*/
+	Individuo &getArchivado(int pos) const
+	{
+		return *m_pArchivo[pos].pInd;
+	}
+
+protected:
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+	struct Archivado
+	{
+		Individuo *pInd;
+		double valor;
+		bool presente;		//el individuo est en la generacin actual
+	};
+	struct Peor
+	{
+		int pos;
+		double valor;
+	};
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+	//!Restablece la propiedad de montculo desde la posicin \a i hacia la raz
+	template<class T> void subir(T *m, int i, bool haciaMejor) const;
+
+	//!Restablece la propiedad de montculo desde la posicin \a i hacia las hojas
+	template<class T> void hundir(T *m, int n, int i, bool haciaMejor) const;
+
+	//!Indica si el valor \a a debe quedar ms cerca de la raz que \a b
+	bool prioridad(double a, double b, bool haciaMejor) const
+	{
+		return (haciaMejor==m_maximizar) ? (a>b) : (a<b);
+	}
+
+	//!Intenta adicionar al archivo el individuo ubicado en la posicin \a pos de la poblacin
+	void archivar(Poblacion *pPob, int pos, double valor);
+
+	//!Adiciona la posicin \a pos al montculo de los peores individuos de la generacin
+	void registrarPeor(int pos, double valor);
+
+	//!Nmero mximo de individuos archivados
+	int m_k;
+	//!Nmero de individuos archivados
+	int m_numArchivo;
+	//!Individuos archivados, en forma de montculo con el peor en la raz
+	Archivado *m_pArchivo;
+
+	//!Nmero mximo y nmero actual de posiciones en el montculo de peores
+	int m_maxPeores, m_numPeores;
+	//!Peores individuos de la generacin, en forma de montculo con el mejor de ellos en la raz
+	Peor *m_pPeores;
+
+	//!Marca de las posiciones de la poblacin cuyos individuos se archivaron en esta generacin
+	/*!Un individuo que sale del archivo durante el recorrido conserva la marca, lo que solo
+	evita que sea sobrescrito.*/
+	bool *m_pArchivadas;
+	//!Nmero de posiciones reservadas en \a m_pArchivadas
+	int m_capacidadArchivadas;
+
+	//!Copia de AlgoritmoGenetico::m_IndicadorMaximizar durante la adaptacin
+	bool m_maximizar;
+};
+
+
 //!Clase derivada de la clase OperadorAdaptacion que define la estrategia de adaptacin para la probabilidad de mutacin de los genes de cada individuo de la poblacin
 /*!Existen dos mtodos de adaptacin que varan la probabilidad de mutacin: 
 <ul>
@@ -1047,20 +1912,56 @@ public:
 	void seleccionar(Poblacion& pPob);
 };
 
+//!Clase derivada de la clase OperadorSeleccion que define el proceso de seleccin por torneo
+/*!Cada individuo de la nueva poblacin es el mejor de \a m_Tamano individuos escogidos al azar,
+con reemplazo. No usa la probabilidad de los individuos, y solo evala la funcin objetivo de los
+que participan en algn torneo, por lo que es el operador de seleccin apropiado para la evaluacin
+perezosa (Ver AlgoritmoGenetico::m_IndicadorEvaluacionPerezosa).*/
+class OperadorSeleccionTorneo:public OperadorSeleccion
+{
+public:
+	//!Constructor
+	OperadorSeleccionTorneo(int Tamano=2){m_Tamano = Tamano<1 ? 1 : Tamano;}
+	//!Destructor 
+	~OperadorSeleccionTorneo(){}
+	//!Ejecuta el proceso de seleccin por torneo de los individuos de la poblacin
+	void seleccionar(Poblacion& pPob);
+	//!Nmero de individuos que participan en cada torneo
+	int m_Tamano;
+};
+
 //!Clase derivada de OperadorParejas que define la asignacin de parejas aleatorias para los individuos de la poblacin
 /*!A cada individuo de la poblacin se le asigna otro individuo que corresponder a su pareja en el proceso de reproduccin. 
 La asignacin se realiza aleatoriamente teniendo en cuenta que no deben asignarse individuos que ya tengan
 pareja establecida y que un individuo no puede ser asignado como su propia pareja. Cuando el numero de individuos 
-es impar, a un individuo de la poblacin no se le asigna pareja.*/
+es impar, a un individuo de la poblacin no se le asigna pareja.
+
+Los ndices de la poblacin se barajan una sola vez (algoritmo de Fisher-Yates) y se emparejan 
+las posiciones consecutivas, por lo que el costo es proporcional al tamao de la poblacin.
+Opcionalmente se evita emparejar individuos que comparten el mismo genoma, como las copias
+producidas por la seleccin.*/
 class OperadorParejasAleatorias:public OperadorParejas
 {
 public:
 	//!Constructor 
-	OperadorParejasAleatorias(){}
+	/*!\param evitarIguales Si su valor es \a true, se intenta no emparejar individuos con el mismo genoma. Por defecto es \a false.*/
+	OperadorParejasAleatorias(bool evitarIguales=false):m_evitarIguales(evitarIguales),m_pIndices(NULL),m_capacidad(0){}
 	//!Destructor
-	~OperadorParejasAleatorias(){}
+	~OperadorParejasAleatorias()
+	{
+		delete [] m_pIndices;
+	}
 	//!Asigna parejas aleatoriamente para los individuos de la poblacin
 	void asignarParejas(Poblacion& Pob);
+protected:
+	//!Indica si se evita emparejar individuos con el mismo genoma
+	bool m_evitarIguales;
+	//!Permutacin de los ndices de la poblacin. Se reutiliza entre generaciones
+	int *m_pIndices;
+	//!Capacidad de \a m_pIndices
+	int m_capacidad;
+	//!Nmero mximo de intentos para encontrar una pareja con genoma diferente
+	enum { MAX_INTENTOS = 8 };
 };
 
 
@@ -1288,6 +2189,200 @@ private:
 };
 
 
+/************************************************************************/
+/*						CLASE AlgoritmoGeneticoT						*/
+/************************************************************************/
+
+//!Clase derivada de AlgoritmoGenetico cuyos operadores generales se definen en tiempo de compilacin
+/*!Los operadores de probabilidad, seleccin, parejas y reproduccin son los parmetros 
+de la plantilla. En cada iteracin se invocan directamente, con su clase conocida en tiempo de
+compilacin y sin el mecanismo virtual, de modo que el compilador puede expandir en lnea las
+llamadas a estos operadores. El resto de la iteracin es la de AlgoritmoGenetico.
+Puede usarse cualquiera de las clases de operadores de la librera, por ejemplo:
+<pre>
+AlgoritmoGeneticoT<OperadorProbabilidadLineal, OperadorSeleccionTorneo,
+                   OperadorParejasAdyacentes, OperadorReproduccionMejorPadreMejorHijo>
+</pre>
+Los operadores se crean con su constructor por defecto. Para crearlos con otros parmetros se 
+usan en \a definirOperadores() las macros DEFINIR_OPERADOR_*, por ejemplo
+DEFINIR_OPERADOR_SELECCION( OperadorSeleccionTorneo(3) ); el operador debe ser de la clase de la
+plantilla, o la macro no compila.
+Los operadores de adaptacin, finalizacin, mutacin y cruce se definen igual que en
+AlgoritmoGenetico. Normalmente se declara con la macro DECLARAR_ALGORITMO_ESTATICO.*/
+template<class Probabilidad, class Seleccion, class Parejas, class Reproduccion>
+class AlgoritmoGeneticoT:public AlgoritmoGenetico
+{
+public:
+
+#if defined(USAR_VENTANA)
+
+	//!Constructor cuando se usa el entorno grfico (Debe estar definida la constante USAR_VENTANA)
+	AlgoritmoGeneticoT(AGFrame *pFrame):AlgoritmoGenetico(pFrame){}
+
+#else
+
+	//!Constructor por defecto.
+	AlgoritmoGeneticoT(){}
+
+#endif
+
+protected:
+
+	//!Crea con su constructor por defecto los operadores de la plantilla que no defini el usuario
+	void crearOperadoresGenerales()
+	{
+		if(!m_pOpProbabilidad) m_pOpProbabilidad = new Probabilidad;
+		if(!m_pOpSeleccion) m_pOpSeleccion = new Seleccion;
+		if(!m_pOpParejas) m_pOpParejas = new Parejas;
+		if(!m_pOpReproduccion) m_pOpReproduccion = new Reproduccion;
+	}
+
+	//!Aplica los operadores de la plantilla, invocndolos con su propia clase
+	void aplicarOperadoresGenerales()
+	{
+		static_cast<Probabilidad*>(m_pOpProbabilidad)->Probabilidad::asignarProbabilidad(*m_pPoblacionActual, m_IndicadorMaximizar);
+		static_cast<Seleccion*>(m_pOpSeleccion)->Seleccion::seleccionar(*m_pPoblacionActual);
+		static_cast<Parejas*>(m_pOpParejas)->Parejas::asignarParejas(*m_pPoblacionActual);
+		static_cast<Reproduccion*>(m_pOpReproduccion)->Reproduccion::reproducir(*m_pPoblacionActual, m_IndicadorMaximizar);
+	}
+
+	//!Solo acepta en DEFINIR_OPERADOR_PROBABILIDAD operadores de la clase de la plantilla
+	OperadorProbabilidad* definirOperadorProbabilidad(Probabilidad *pOp)
+	{
+		return pOp;
+	}
+
+	//!Solo acepta en DEFINIR_OPERADOR_SELECCION operadores de la clase de la plantilla
+	OperadorSeleccion* definirOperadorSeleccion(Seleccion *pOp)
+	{
+		return pOp;
+	}
+
+	//!Solo acepta en DEFINIR_OPERADOR_PAREJAS operadores de la clase de la plantilla
+	OperadorParejas* definirOperadorParejas(Parejas *pOp)
+	{
+		return pOp;
+	}
+
+	//!Solo acepta en DEFINIR_OPERADOR_REPRODUCCION operadores de la clase de la plantilla
+	OperadorReproduccion* definirOperadorReproduccion(Reproduccion *pOp)
+	{
+		return pOp;
+	}
+};
+
+
+//!Clase derivada de AlgoritmoGenetico que efecta un algoritmo de estado estacionario
+/*!En cada iteracin se crean \a m_NumHijos hijos (normalmente muchos menos que los individuos 
+de la poblacin). Cada hijo se obtiene cruzando dos padres elegidos por torneo binario y 
+mutando el resultado, y luego remplaza a un miembro de la poblacin, segn \a m_TipoRemplazo:
+- REMPLAZO_PEOR: al peor individuo de la poblacin.
+- REMPLAZO_AZAR: a un individuo elegido al azar.
+- REMPLAZO_SIMILAR: al ms parecido al hijo (ver Gen::distancia()) entre \a m_FactorAglomeracion 
+individuos elegidos al azar, o entre todos si \a m_FactorAglomeracion es 0.
+
+El remplazo solo se efecta si el hijo no es peor que el individuo remplazado, de modo que 
+el mejor individuo nunca se pierde.
+
+Las posiciones de la poblacin se mantienen en un MonticuloIndexado con el peor individuo en
+la raz, y la suma y la suma de cuadrados de las funciones objetivo se actualizan con cada 
+remplazo. As, encontrar el peor y remplazarlo cuesta O(log n), y \a m_Media y \a m_Desviacion 
+se obtienen sin recorrer la poblacin. Con funciones objetivo costosas el algoritmo avanza con
+cada evaluacin y no solo al final de cada generacin completa.
+
+Los operadores de probabilidad, seleccin, parejas y reproduccin no se utilizan. Los operadores
+de adaptacin se invocan cada vez que se han creado tantos hijos como individuos tiene la
+poblacin; en ese momento tambin se reconstruyen el montculo y las sumas.
+\a m_Generacion y \a m_GeneracionMaxima cuentan iteraciones, no generaciones completas.
+Normalmente se declara con la macro DECLARAR_ALGORITMO_ESTACIONARIO.*/
+class AlgoritmoGeneticoEstacionario:public AlgoritmoGenetico
+{
+public:
+
+#if defined(USAR_VENTANA)
+
+	//!Constructor cuando se usa el entorno grfico (Debe estar definida la constante USAR_VENTANA)
+	AlgoritmoGeneticoEstacionario(AGFrame *pFrame);
+
+#else
+
+	//!Constructor por defecto.
+	AlgoritmoGeneticoEstacionario();
+
+#endif
+
+	//!Destructor
+	~AlgoritmoGeneticoEstacionario();
+
+	//!Crea e inserta en la poblacin los hijos de la siguiente iteracin
+	void iterarOptimizacion();
+
+	//!Finaliza el algoritmo gentico, destruyendo tambin los hijos
+	void finalizarOptimizacion();
+
+//! @name Parmetros del algoritmo estacionario
+//@{
+
+	//!Nmero de hijos que se crean en cada iteracin
+	int m_NumHijos;
+	//!Individuo que remplaza cada hijo. Puede ser REMPLAZO_PEOR, REMPLAZO_AZAR o REMPLAZO_SIMILAR
+	int m_TipoRemplazo;
+	//!Nmero de individuos con los que se compara cada hijo en el REMPLAZO_SIMILAR. Con 0 se compara con toda la poblacin
+	int m_FactorAglomeracion;
+
+//@}
+
+protected:
+
+	//!Actualiza las medidas de desempeo a partir del montculo y de las sumas
+	void actualizarMedidas();
+
+	//!Reconstruye el montculo y las sumas a partir de la poblacin actual
+	void reconstruir();
+
+	//!Elige un padre por torneo binario
+	int seleccionarPadre() const;
+
+	//!Crea un hijo a partir de dos padres de la poblacin
+	void crearHijo(Individuo &hijo);
+
+	//!Elige la posicin de la poblacin que remplazar un hijo
+	int elegirRemplazo(const Individuo &hijo) const;
+
+	//!Crea los individuos que se reutilizan como hijos en cada iteracin
+	void crearHijos();
+
+	//!Inserta un hijo en la poblacin si no es peor que el individuo que remplazara
+	bool insertarHijo(Individuo &hijo);
+
+	//!Invoca la adaptacin y reconstruye el montculo cuando corresponde
+	void revisarReconstruccion();
+
+	//!Indica si el valor \a a es mejor que el valor \a b
+	bool esMejor(double a, double b) const
+	{
+		return m_IndicadorMaximizar ? (a>b) : (a<b);
+	}
+
+	//!Posiciones de la poblacin ordenadas con el peor individuo en la raz
+	MonticuloIndexado m_Monticulo;
+	//!Posicin del mejor individuo de la poblacin
+	int m_posMejor;
+	//!Suma de las funciones objetivo de la poblacin
+	double m_SumaObj;
+	//!Suma de los cuadrados de las funciones objetivo de la poblacin
+	double m_SumaCuadrados;
+	//!Suma de las funciones objetivo de los hijos de la iteracin actual
+	double m_SumaHijos;
+	//!Nmero de hijos insertados o descartados en la iteracin actual
+	int m_HijosEnIteracion;
+	//!Nmero de hijos creados desde la ltima reconstruccin del montculo
+	long m_HijosDesdeReconstruir;
+	//!Hijos de la iteracin. Se reutilizan de una iteracin a otra
+	Arreglo<Individuo> *m_pHijos;
+};
+
+
 #pragma warning(pop)
 
 /****************************************************************************/
@@ -1304,10 +2399,14 @@ private:
 #define _MAXIMO(a,b)  ((a)>(b)? (a):(b) )
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
 
+/*!Mayor probabilidad de mutacin con la que Poblacion::mutar() elige los genes que mutan con
+saltos geomtricos. Con probabilidades mayores es ms rpido decidir gen por gen*/
+#define __PROBABILIDAD_MAXIMA_SALTO 0.25
+
 
 
 //!Macro que crea una nueva clase derivada de AlgoritmoGenetico
-/*!Declara e implementa el constructor por defecto de esta clase,
+/*!Declara e implementa el constructor por defecto de esta clase y la funcin \a crearInstancia(),
 tambin declara implicitamente las funciones de caracter obligatorio, 
 las cuales deben ser implementadas en el proyecto de optiizacin, usando la forma:
 <pre>
@@ -1337,6 +2436,7 @@ a la clase base el apuntador al frame*/
 	{																\
 	public:															\
 		nombreAlgoritmo(AGFrame* pFrame):AlgoritmoGenetico(pFrame){}\
+		AlgoritmoGenetico* crearInstancia(){ return new nombreAlgoritmo(m_pFrame); }	\
 		void codificacion(Individuo * pInd ,int estado);			\
 		double objetivo();
 
@@ -1347,12 +2447,78 @@ a la clase base el apuntador al frame*/
 	{														\
 	public:													\
 		nombreAlgoritmo(){}									\
+		AlgoritmoGenetico* crearInstancia(){ return new nombreAlgoritmo; }	\
+		void codificacion(Individuo * pInd ,int estado);	\
+		double objetivo();
+
+#endif
+
+
+//!Macro que crea una nueva clase derivada de AlgoritmoGeneticoT
+/*!Es equivalente a DECLARAR_ALGORITMO, pero los operadores de probabilidad, seleccin, 
+parejas y reproduccin quedan fijos en tiempo de compilacin (Ver AlgoritmoGeneticoT).
+La declaracin se termina con FIN_DECLARAR_ALGORITMO.
+\param nombreAlgoritmo Nombre de la nueva clase.
+\param tipoProbabilidad Clase del operador de probabilidad.
+\param tipoSeleccion Clase del operador de seleccin.
+\param tipoParejas Clase del operador de parejas.
+\param tipoReproduccion Clase del operador de reproduccin.*/
+#if defined(USAR_VENTANA)
+
+#define DECLARAR_ALGORITMO_ESTATICO(nombreAlgoritmo, tipoProbabilidad, tipoSeleccion, tipoParejas, tipoReproduccion)	\
+	class nombreAlgoritmo : public AlgoritmoGeneticoT<tipoProbabilidad, tipoSeleccion, tipoParejas, tipoReproduccion>	\
+	{																\
+	public:															\
+		nombreAlgoritmo(AGFrame* pFrame):AlgoritmoGeneticoT<tipoProbabilidad, tipoSeleccion, tipoParejas, tipoReproduccion>(pFrame){}\
+		AlgoritmoGenetico* crearInstancia(){ return new nombreAlgoritmo(m_pFrame); }	\
+		void codificacion(Individuo * pInd ,int estado);			\
+		double objetivo();
+
+#else
+
+#define DECLARAR_ALGORITMO_ESTATICO(nombreAlgoritmo, tipoProbabilidad, tipoSeleccion, tipoParejas, tipoReproduccion)	\
+	class nombreAlgoritmo : public AlgoritmoGeneticoT<tipoProbabilidad, tipoSeleccion, tipoParejas, tipoReproduccion>	\
+	{														\
+	public:													\
+		nombreAlgoritmo(){}									\
+		AlgoritmoGenetico* crearInstancia(){ return new nombreAlgoritmo; }	\
 		void codificacion(Individuo * pInd ,int estado);	\
 		double objetivo();
 
 #endif
 
 
+//!Macro que crea una nueva clase derivada de AlgoritmoGeneticoEstacionario
+/*!Es equivalente a DECLARAR_ALGORITMO, pero el algoritmo es de estado estacionario 
+(Ver AlgoritmoGeneticoEstacionario). Los parmetros \a m_NumHijos, \a m_TipoRemplazo y 
+\a m_FactorAglomeracion pueden cambiarse en \a inicializarParametros().
+La declaracin se termina con FIN_DECLARAR_ALGORITMO.
+\param nombreAlgoritmo Nombre de la nueva clase.*/
+#if defined(USAR_VENTANA)
+
+#define DECLARAR_ALGORITMO_ESTACIONARIO(nombreAlgoritmo)						\
+	class nombreAlgoritmo : public AlgoritmoGeneticoEstacionario				\
+	{																			\
+	public:																		\
+		nombreAlgoritmo(AGFrame* pFrame):AlgoritmoGeneticoEstacionario(pFrame){}\
+		AlgoritmoGenetico* crearInstancia(){ return new nombreAlgoritmo(m_pFrame); }	\
+		void codificacion(Individuo * pInd ,int estado);						\
+		double objetivo();
+
+#else
+
+#define DECLARAR_ALGORITMO_ESTACIONARIO(nombreAlgoritmo)			\
+	class nombreAlgoritmo : public AlgoritmoGeneticoEstacionario	\
+	{																\
+	public:															\
+		nombreAlgoritmo(){}											\
+		AlgoritmoGenetico* crearInstancia(){ return new nombreAlgoritmo; }	\
+		void codificacion(Individuo * pInd ,int estado);			\
+		double objetivo();
+
+#endif
+
+
 //!Macro que termina la creacin de una clase derivada de AlgoritmoGenetico
 #define FIN_DECLARAR_ALGORITMO							\
 	};			
@@ -1369,7 +2535,7 @@ a la clase base el apuntador al frame*/
 		}															\
 		else if(estado==ESTADO_CODIFICAR)							\
 		{															\
-			TipoGen &_gen = (TipoGen&)(pIndividuo->getGen(pos));	\
+			TipoGen &_gen = (TipoGen&)(pIndividuo->getGenModificable(pos));	\
 			_gen = var;												\
 		}															\
 		else if(estado==ESTADO_DECODIFICAR)							\
@@ -1386,7 +2552,7 @@ a la clase base el apuntador al frame*/
 #define DEFINIR_OPERADOR_PROBABILIDAD(tipoOperador)		\
 	{													\
 		if(m_pOpProbabilidad) delete m_pOpProbabilidad;	\
-		m_pOpProbabilidad=new tipoOperador;				\
+		m_pOpProbabilidad=definirOperadorProbabilidad(new tipoOperador);	\
 	}
 
 //!Macro que define el operador de selecccin que se emplear en el algoritmo gentico
@@ -1394,7 +2560,7 @@ a la clase base el apuntador al frame*/
 #define DEFINIR_OPERADOR_SELECCION(tipoOperador)		\
 	{													\
 		if(m_pOpSeleccion) delete m_pOpSeleccion;		\
-		m_pOpSeleccion=new tipoOperador;				\
+		m_pOpSeleccion=definirOperadorSeleccion(new tipoOperador);	\
 	}
 
 //!Macro que define el operador de parejas que se emplear en el algoritmo gentico
@@ -1402,7 +2568,7 @@ a la clase base el apuntador al frame*/
 #define DEFINIR_OPERADOR_PAREJAS(tipoOperador)			\
 	{													\
 		if(m_pOpParejas) delete m_pOpParejas;			\
-		m_pOpParejas=new tipoOperador;					\
+		m_pOpParejas=definirOperadorParejas(new tipoOperador);	\
 	}
 
 //!Macro que define el operador de reproduccin que se emplear en el algoritmo gentico
@@ -1410,7 +2576,7 @@ a la clase base el apuntador al frame*/
 #define DEFINIR_OPERADOR_REPRODUCCION(tipoOperador)		\
 	{													\
 		if(m_pOpReproduccion) delete m_pOpReproduccion;	\
-		m_pOpReproduccion=new tipoOperador;				\
+		m_pOpReproduccion=definirOperadorReproduccion(new tipoOperador);	\
 	}
 
 //!Macro que define los operadores de adaptacin que se emplearn en el algoritmo gentico
@@ -1445,4 +2611,28 @@ a la clase base el apuntador al frame*/
 		m_pListaOperadorCruce->Adicionar(OC);			\
 	}
 
+//!Macro que define un mismo operador de mutacin para varios genes consecutivos
+/*!Los genes comparten un solo objeto operador, por lo que se mutan en toda la poblacin con una sola
+invocacin (Ver GruposOperadores). Deben ser del tipo de gen sobre el que opera el operador.
+\param tipoOperador Operador de mutacin, con los parmetros de su constructor.
+\param numGenes Nmero de genes que usan el operador. Como mnimo es 1.*/
+#define ADICIONAR_OPERADOR_MUTACION_GENES( tipoOperador, numGenes )	\
+	{																\
+		OperadorMutacion *OM=new tipoOperador;						\
+		m_GruposMutacion.asignarGenes(m_pListaOperadorMutacion->getSize(), (int)(numGenes));	\
+		m_pListaOperadorMutacion->Adicionar(OM);					\
+	}
+
+//!Macro que define un mismo operador de cruce para varios genes consecutivos
+/*!Los genes comparten un solo objeto operador, por lo que se cruzan en todas las parejas con una sola
+invocacin (Ver GruposOperadores). Deben ser del tipo de gen sobre el que opera el operador.
+\param tipoOperador Operador de cruce, con los parmetros de su constructor.
+\param numGenes Nmero de genes que usan el operador. Como mnimo es 1.*/
+#define ADICIONAR_OPERADOR_CRUCE_GENES( tipoOperador, numGenes )	\
+	{																\
+		OperadorCruce *OC=new tipoOperador;							\
+		m_GruposCruce.asignarGenes(m_pListaOperadorCruce->getSize(), (int)(numGenes));	\
+		m_pListaOperadorCruce->Adicionar(OC);						\
+	}
+
 #endif	//__GENETICO_H
@@ -0,0 +1,580 @@
+#ifndef __GENFIJO_H
+#define __GENFIJO_H
+
+#include <tuple>
+#include "genarreglo.h"
+#include "genvector.h"
+
+#pragma warning(push, 3)	//Evita  "warning(level 4) C4100" ocasionada por parmetros de funciones no referenciados
+
+
+/************************************************************
+                      GENOMA FIJO
+************************************************************/
+
+template<class Genoma, class... Ms> class OperadorMutacionFijo;
+template<class Genoma, class... Cs> class OperadorCruceFijo;
+
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+/*Funciones que adaptan cada tipo de gen al recorrido esttico del genoma.
+Las llamadas a los operadores se califican con el nombre de su clase,
+de modo que el compilador no usa el mecanismo virtual y puede expandirlas en lnea.*/
+
+//decisin de mutar un gen simple: un solo nmero aleatorio
+template<class Op, class G> inline bool __decidirMutacionFijo(Op& op, const G& gen)
+{
+	return op.Op::decidirMutacion();
+}
+
+//decisin de mutar un gen de tipo arreglo: muta el tamao o algn dato
+template<class G, class T> inline bool __decidirMutacionFijo(OperadorMutacionArreglo<G,T>& op, const GenArreglo<G,T>& gen)
+{
+	return op.OperadorMutacionArreglo<G,T>::decidirMutacionGen(&gen);
+}
+
+//decisin de mutar un vector real: muta alguna dimensin
+template<class Op> inline bool __decidirMutacionFijo(Op& op, const GenVectorReal& gen)
+{
+	return op.OperadorMutacionVectorReal::decidirMutacionGen(&gen);
+}
+
+//mutacin de un gen: el operador decide si debe mutar y luego se invoca directamente mutarGen()
+template<class Op, class G> inline void __mutarGenFijo(Op& op, G& gen)
+{
+	if(__decidirMutacionFijo(op, gen)) op.Op::mutarGen(&gen);
+}
+
+//cruce de un gen simple: el hijo, copia de la madre, recibe el valor cruzado
+template<class Op, class G> inline void __cruzarGenFijo(Op& op, const G& mejor, const G& peor, G& hijo, int numHijo, int indice)
+{
+	hijo = op.Op::cruzarValor(mejor, peor, numHijo, indice);
+}
+
+//cruce de un gen de tipo arreglo sobre el hijo existente
+template<class G, class T> inline void __cruzarGenFijo(OperadorCruceArreglo<G,T>& op, const GenArreglo<G,T>& mejor, const GenArreglo<G,T>& peor, GenArreglo<G,T>& hijo, int numHijo, int indice)
+{
+	op.OperadorCruceArreglo<G,T>::cruzarEn(mejor, peor, hijo, numHijo, indice);
+}
+
+//cruce de un vector real sobre el hijo existente
+template<class Op> inline void __cruzarGenFijo(Op& op, const GenVectorReal& mejor, const GenVectorReal& peor, GenVectorReal& hijo, int numHijo, int indice)
+{
+	op.Op::cruzarEn(mejor, peor, hijo, numHijo, indice);
+}
+
+//cruce de un gen en los dos hijos de una pareja: por defecto, cada hijo por separado
+template<class Op, class G> inline void __cruzarParejaFijo(Op& op, const G& mejor, const G& peor, G& hijo1, G& hijo2, int indice)
+{
+	__cruzarGenFijo(op, mejor, peor, hijo1, 0, indice);
+	__cruzarGenFijo(op, mejor, peor, hijo2, 1, indice);
+}
+
+//cruce de un vector real en los dos hijos de una pareja, que pueden compartir nmeros aleatorios
+template<class Op> inline void __cruzarParejaFijo(Op& op, const GenVectorReal& mejor, const GenVectorReal& peor, GenVectorReal& hijo1, GenVectorReal& hijo2, int)
+{
+	op.Op::cruzarParejaEn(mejor, peor, hijo1, hijo2);
+}
+
+//decodificacin de un gen simple
+template<class G, class V> inline void __decodificarGenFijo(const G& gen, V& var)
+{
+	var = static_cast<V>(gen.getVal());
+}
+
+//decodificacin de un gen de tipo arreglo, en un Arreglo<T> o en una VistaArreglo<T>
+template<class G, class T, class V> inline void __decodificarGenFijo(const GenArreglo<G,T>& gen, V& var)
+{
+	gen.decodificar(var);
+}
+
+//decodificacin de un vector real, en un ArregloReal o en una VistaArregloReal
+template<class V> inline void __decodificarGenFijo(const GenVectorReal& gen, V& var)
+{
+	gen.decodificar(var);
+}
+
+//Recorre en tiempo de compilacin las posiciones I..N-1 de las tuplas de genes y de operadores
+template<int I, int N>
+struct __PasoGenomaFijo
+{
+	template<class Genes> static void generarAleatorio(Genes& genes)
+	{
+		std::get<I>(genes).generarAleatorio();
+		__PasoGenomaFijo<I+1,N>::generarAleatorio(genes);
+	}
+
+	template<class Ops> static void asignarProbabilidad(Ops& ops, double Probabilidad)
+	{
+		std::get<I>(ops).AsignarProbabilidadMutacion(Probabilidad);
+		__PasoGenomaFijo<I+1,N>::asignarProbabilidad(ops, Probabilidad);
+	}
+
+	template<class Ops, class Genes> static void mutar(Ops& ops, Genes& genes)
+	{
+		__mutarGenFijo(std::get<I>(ops), std::get<I>(genes));
+		__PasoGenomaFijo<I+1,N>::mutar(ops, genes);
+	}
+
+	template<class Ops, class Genes> static bool decidirMutacion(Ops& ops, const Genes& genes, bool *pDecisiones)
+	{
+		pDecisiones[I] = __decidirMutacionFijo(std::get<I>(ops), std::get<I>(genes));
+		return __PasoGenomaFijo<I+1,N>::decidirMutacion(ops, genes, pDecisiones) || pDecisiones[I];
+	}
+
+	template<class Ops, class Genes> static void mutarDecididos(Ops& ops, Genes& genes, const bool *pDecisiones)
+	{
+		typedef typename std::tuple_element<I,Ops>::type Op;
+		if(pDecisiones[I]) std::get<I>(ops).Op::mutarGen(&std::get<I>(genes));
+		__PasoGenomaFijo<I+1,N>::mutarDecididos(ops, genes, pDecisiones);
+	}
+
+	template<class Ops> static void asignarObjetivos(Ops& ops, double mejor, double peor)
+	{
+		std::get<I>(ops).asignarObjetivos(mejor, peor);
+		__PasoGenomaFijo<I+1,N>::asignarObjetivos(ops, mejor, peor);
+	}
+
+	template<class Ops, class Genes> static void cruzar(Ops& ops, const Genes& mejor, const Genes& peor, Genes& hijo, int numHijo, int indice)
+	{
+		__cruzarGenFijo(std::get<I>(ops), std::get<I>(mejor), std::get<I>(peor), std::get<I>(hijo), numHijo, indice);
+		__PasoGenomaFijo<I+1,N>::cruzar(ops, mejor, peor, hijo, numHijo, indice);
+	}
+
+	template<class Ops, class Genes> static void cruzarPareja(Ops& ops, const Genes& mejor, const Genes& peor, Genes& hijo1, Genes& hijo2, int indice)
+	{
+		__cruzarParejaFijo(std::get<I>(ops), std::get<I>(mejor), std::get<I>(peor), std::get<I>(hijo1), std::get<I>(hijo2), indice);
+		__PasoGenomaFijo<I+1,N>::cruzarPareja(ops, mejor, peor, hijo1, hijo2, indice);
+	}
+
+	template<class Genes> static double distancia(const Genes& a, const Genes& b)
+	{
+		return std::get<I>(a).distancia(std::get<I>(b)) + __PasoGenomaFijo<I+1,N>::distancia(a, b);
+	}
+
+	template<class Genes> static int numValores(const Genes& genes)
+	{
+		return std::get<I>(genes).numValores() + __PasoGenomaFijo<I+1,N>::numValores(genes);
+	}
+
+	template<class Genes> static void getValores(const Genes& genes, double *pDestino)
+	{
+		std::get<I>(genes).getValores(pDestino);
+		__PasoGenomaFijo<I+1,N>::getValores(genes, pDestino + std::get<I>(genes).numValores());
+	}
+
+	template<class Genes> static void setValores(Genes& genes, const double *pOrigen)
+	{
+		int num = std::get<I>(genes).numValores();
+		std::get<I>(genes).setValores(pOrigen, num);
+		__PasoGenomaFijo<I+1,N>::setValores(genes, pOrigen + num);
+	}
+
+	template<class Genes, class V, class... Vs> static void codificar(Genes& genes, const V& var, const Vs&... resto)
+	{
+		std::get<I>(genes) = var;
+		__PasoGenomaFijo<I+1,N>::codificar(genes, resto...);
+	}
+
+	template<class Genes, class V, class... Vs> static void decodificar(const Genes& genes, V& var, Vs&... resto)
+	{
+		__decodificarGenFijo(std::get<I>(genes), var);
+		__PasoGenomaFijo<I+1,N>::decodificar(genes, resto...);
+	}
+};
+
+//Fin del recorrido
+template<int N>
+struct __PasoGenomaFijo<N,N>
+{
+	template<class Genes> static void generarAleatorio(Genes&){}
+	template<class Ops> static void asignarProbabilidad(Ops&, double){}
+	template<class Ops, class Genes> static void mutar(Ops&, Genes&){}
+	template<class Ops, class Genes> static bool decidirMutacion(Ops&, const Genes&, bool*){ return false; }
+	template<class Ops, class Genes> static void mutarDecididos(Ops&, Genes&, const bool*){}
+	template<class Ops> static void asignarObjetivos(Ops&, double, double){}
+	template<class Ops, class Genes> static void cruzar(Ops&, const Genes&, const Genes&, Genes&, int, int){}
+	template<class Ops, class Genes> static void cruzarPareja(Ops&, const Genes&, const Genes&, Genes&, Genes&, int){}
+	template<class Genes> static double distancia(const Genes&, const Genes&){ return 0.0; }
+	template<class Genes> static int numValores(const Genes&){ return 0; }
+	template<class Genes> static void getValores(const Genes&, double*){}
+	template<class Genes> static void setValores(Genes&, const double*){}
+	template<class Genes> static void codificar(Genes&){}
+	template<class Genes> static void decodificar(const Genes&){}
+};
+
+#endif  /* DOXYGEN_SHOULD_SKIP_THIS */
+
+
+//!Clase derivada de la clase Gen que agrupa un nmero fijo de genes cuyos tipos se conocen en tiempo de compilacin
+/*!Se utiliza cuando la estructura del genoma no cambia durante la optimizacin, por ejemplo
+GenomaFijo<GenReal, GenReal, GenEntero, GenArregloBool>. Los genes se almacenan por valor
+en una tupla, de modo que copiar, mutar, cruzar y decodificar el genoma no requiere
+crear genes con \a new, ni invocar \a crearCopia(), ni usar el mecanismo virtual para cada gen.
+
+Un objeto GenomaFijo se adiciona al Individuo como un nico gen, mediante la macro
+ADICIONAR_GENOMAFIJO, y puede convivir con otros genes del genoma dinmico.
+Sus operadores por defecto son OperadorMutacionFijo y OperadorCruceFijo con los
+operadores por defecto de cada uno de los genes que lo conforman.
+Solo est disponible al compilar con C++11 o posterior.*/
+template<class... Gs>
+class GenomaFijo:public Gen
+{
+	static_assert(sizeof...(Gs) > 0, "GenomaFijo debe contener al menos un gen");
+
+public:
+	//!Tipo de la tupla que almacena los genes
+	typedef std::tuple<Gs...> TipoGenes;
+
+	//!Tipo del operador de mutacin por defecto del genoma
+	typedef OperadorMutacionFijo<GenomaFijo, typename Gs::TipoOperadorMutacionDefecto...> TipoOperadorMutacionDefecto;
+
+	//!Tipo del operador de cruce por defecto del genoma
+	typedef OperadorCruceFijo<GenomaFijo, typename Gs::TipoOperadorCruceDefecto...> TipoOperadorCruceDefecto;
+
+	//!Nmero de genes que conforman el genoma
+	static const int numGenes = sizeof...(Gs);
+
+	//!Constructor por defecto. Cada gen se construye con su constructor por defecto
+	GenomaFijo(){}
+
+	//!Constructor a partir de los genes que conforman el genoma
+	/*!\param genes Genes que se copian en el genoma, en el mismo orden de los parmetros de la plantilla.*/
+	GenomaFijo(const Gs&... genes):m_Genes(genes...){}
+
+	//!Constructor por copia
+	GenomaFijo(const GenomaFijo& origen):Gen(),m_Genes(origen.m_Genes){}
+
+	//!Operador de asignacin a partir de otro GenomaFijo del mismo tipo
+	const GenomaFijo& operator = (const GenomaFijo& origen)
+	{
+		m_Genes = origen.m_Genes;
+		return *this;
+	}
+
+	//!Crea una copia exacta del genoma
+	/*!
+	\return Apuntador a un nuevo objeto GenomaFijo idntico al actual.*/
+	Gen *crearCopia() const
+	{
+		return (new GenomaFijo(*this));
+	}
+
+	//!Asigna nuevos valores al genoma copiando los de otro genoma del mismo tipo
+	/*!
+	\param origen Objeto del que se hace copia*/
+	void copiar(const Gen& origen)
+	{
+		m_Genes = static_cast<const GenomaFijo&>(origen).m_Genes;
+	}
+
+	//!Genera un valor aleatorio para cada uno de los genes
+	void generarAleatorio()
+	{
+		__PasoGenomaFijo<0,numGenes>::generarAleatorio(m_Genes);
+	}
+
+	//!Retorna un objeto correspondiente al operador de mutacin establecido por defecto para el genoma
+	OperadorMutacion *operadorMutacionDefecto() const
+	{
+		return (new TipoOperadorMutacionDefecto);
+	}
+
+	//!Retorna un objeto correspondiente al operador de cruce establecido por defecto para el genoma
+	OperadorCruce *operadorCruceDefecto() const
+	{
+		return (new TipoOperadorCruceDefecto);
+	}
+
+	//!Retorna la suma de las distancias entre los genes de dos genomas del mismo tipo
+	/*!
+	\param otro Genoma con el que se compara.*/
+	double distancia(const Gen& otro) const
+	{
+		return __PasoGenomaFijo<0,numGenes>::distancia(m_Genes, static_cast<const GenomaFijo&>(otro).m_Genes);
+	}
+
+	//!Retorna la suma del nmero de valores de los genes
+	int numValores() const
+	{
+		return __PasoGenomaFijo<0,numGenes>::numValores(m_Genes);
+	}
+
+	//!Escribe los valores de los genes, en el orden de la tupla
+	void getValores(double *pDestino) const
+	{
+		__PasoGenomaFijo<0,numGenes>::getValores(m_Genes, pDestino);
+	}
+
+	//!Asigna los valores de los genes, en el orden de la tupla
+	/*!Cada gen toma tantos valores como tenga actualmente, de modo que los arreglos
+	del genoma no cambian de tamao.*/
+	void setValores(const double *pOrigen, int)
+	{
+		__PasoGenomaFijo<0,numGenes>::setValores(m_Genes, pOrigen);
+	}
+
+	//!Retorna el gen ubicado en la posicin \a I del genoma
+	template<int I> typename std::tuple_element<I,TipoGenes>::type& getGen()
+	{
+		return std::get<I>(m_Genes);
+	}
+
+	//!Retorna el gen ubicado en la posicin \a I del genoma. Este no podr ser modificado.
+	template<int I> const typename std::tuple_element<I,TipoGenes>::type& getGen() const
+	{
+		return std::get<I>(m_Genes);
+	}
+
+	//!Retorna la tupla con todos los genes
+	TipoGenes& getGenes()
+	{
+		return m_Genes;
+	}
+
+	//!Retorna la tupla con todos los genes. Estos no podrn ser modificados.
+	const TipoGenes& getGenes() const
+	{
+		return m_Genes;
+	}
+
+	//!Asigna a cada gen el valor de la variable correspondiente
+	/*!\param vars Variables del problema, una por cada gen y en el mismo orden.*/
+	template<class... Vs> void codificar(const Vs&... vars)
+	{
+		static_assert(sizeof...(Vs) == sizeof...(Gs), "Debe haber una variable por cada gen");
+		__PasoGenomaFijo<0,numGenes>::codificar(m_Genes, vars...);
+	}
+
+	//!Asigna a cada variable el valor del gen correspondiente
+	/*!Los genes de tipo arreglo se decodifican en objetos Arreglo<T> o VistaArreglo<T>.
+	\param vars Variables del problema, una por cada gen y en el mismo orden.*/
+	template<class... Vs> void decodificar(Vs&... vars) const
+	{
+		static_assert(sizeof...(Vs) == sizeof...(Gs), "Debe haber una variable por cada gen");
+		__PasoGenomaFijo<0,numGenes>::decodificar(m_Genes, vars...);
+	}
+
+protected:
+	//!Genes que conforman el genoma
+	TipoGenes m_Genes;
+};
+
+
+/******************************************************************
+                     Operador de Mutacin
+******************************************************************/
+
+//!Clase derivada de la clase OperadorMutacion empleada en genes de tipo GenomaFijo
+/*!Contiene un operador de mutacin por cada gen del genoma, almacenados por valor.
+Cada gen se somete a su propio operador con la probabilidad de mutacin de ste;
+las llamadas se resuelven en tiempo de compilacin.
+Ms son los tipos de los operadores, en el mismo orden de los genes.
+Los operadores deben declarar \a mutarGen() como pblico.*/
+template<class Genoma, class... Ms>
+class OperadorMutacionFijo:public OperadorMutacion
+{
+	static_assert(sizeof...(Ms) == Genoma::numGenes, "Debe haber un operador de mutacin por cada gen");
+
+public:
+	//!Constructor por defecto. Cada operador usa su probabilidad de mutacin por defecto.
+	OperadorMutacionFijo():m_DecisionPendiente(false){}
+
+	//!Constructor a partir de los operadores de cada gen
+	/*!\param operadores Operadores de mutacin, en el mismo orden de los genes.*/
+	OperadorMutacionFijo(const Ms&... operadores):m_Operadores(operadores...), m_DecisionPendiente(false){}
+
+	//!Asigna un nuevo valor a la probabilidad de mutacin de todos los operadores
+	/*!
+	\param Probabilidad Nuevo valor de probabilidad de mutacin. Se restringe al rango [0,1]
+	\return Valor de probablidad de mutacion asignado.*/
+	virtual double AsignarProbabilidadMutacion(double Probabilidad)
+	{
+		Probabilidad = restringir(Probabilidad, 0.0, 1.0);
+		__PasoGenomaFijo<0,Genoma::numGenes>::asignarProbabilidad(m_Operadores, Probabilidad);
+		return (m_ProbabilidadMutacion = Probabilidad);
+	}
+
+	//!Sin conocer el genoma no puede decidirse si algo muta, por lo que siempre retorna \a true (Ver \a decidirMutacionGen())
+	bool decidirMutacion()
+	{
+		return true;
+	}
+
+	//!Decide con el operador de cada gen si ste muta y conserva las decisiones para \a mutarGen()
+	/*!\param pGen Apuntador al genoma sobre el que se toma la decisin.
+	\return \a true si muta alguno de los genes.*/
+	bool decidirMutacionGen(const Gen *pGen)
+	{
+		m_DecisionPendiente = __PasoGenomaFijo<0,Genoma::numGenes>::decidirMutacion(m_Operadores, static_cast<const Genoma*>(pGen)->getGenes(), m_Decisiones);
+		return m_DecisionPendiente;
+	}
+
+	//!La mutacin no se decide con un solo nmero aleatorio
+	bool decisionSimple() const
+	{
+		return false;
+	}
+
+	//!Somete cada gen del genoma a su operador de mutacin
+	/*!Si las decisiones ya se tomaron con \a decidirMutacionGen(), solo se mutan los genes elegidos.*/
+	void mutarGen(Gen *pGen)
+	{
+		if(m_DecisionPendiente)
+		{
+			m_DecisionPendiente = false;
+			__PasoGenomaFijo<0,Genoma::numGenes>::mutarDecididos(m_Operadores, static_cast<Genoma*>(pGen)->getGenes(), m_Decisiones);
+		}
+		else
+			__PasoGenomaFijo<0,Genoma::numGenes>::mutar(m_Operadores, static_cast<Genoma*>(pGen)->getGenes());
+	}
+
+	//!Retorna el operador de mutacin del gen ubicado en la posicin \a I
+	template<int I> typename std::tuple_element<I,std::tuple<Ms...> >::type& getOperador()
+	{
+		return std::get<I>(m_Operadores);
+	}
+
+protected:
+	//!Operadores de mutacin de cada gen
+	std::tuple<Ms...> m_Operadores;
+	//!Indica si \a m_Decisiones contiene las decisiones de la ltima invocacin de \a decidirMutacionGen()
+	bool m_DecisionPendiente;
+	//!Decisin de mutar cada gen, tomada en \a decidirMutacionGen()
+	bool m_Decisiones[Genoma::numGenes];
+};
+
+
+/*******************************************************************
+                        Operador de Cruce
+*******************************************************************/
+
+//!Clase derivada de la clase OperadorCruce empleada en genes de tipo GenomaFijo
+/*!Contiene un operador de cruce por cada gen del genoma, almacenados por valor.
+Cada hijo se crea como copia del padre con mejor funcin de evaluacin y
+sus genes se cruzan en su lugar, sin crear genes intermedios. Los dos hijos de una pareja se
+cruzan juntos, de modo que los vectores reales usan OperadorCruceVectorReal::cruzarParejaEn().
+Cs son los tipos de los operadores, en el mismo orden de los genes. Para los genes simples
+deben derivarse de OperadorCruceReal, OperadorCruceEntero u OperadorCruceBool.*/
+template<class Genoma, class... Cs>
+class OperadorCruceFijo:public OperadorCruce
+{
+	static_assert(sizeof...(Cs) == Genoma::numGenes, "Debe haber un operador de cruce por cada gen");
+
+public:
+	//!Constructor por defecto
+	OperadorCruceFijo(){}
+
+	//!Constructor a partir de los operadores de cada gen
+	/*!\param operadores Operadores de cruce, en el mismo orden de los genes.*/
+	OperadorCruceFijo(const Cs&... operadores):m_Operadores(operadores...){}
+
+	//!Entrega las funciones objetivo de los padres a los operadores de cada gen
+	void asignarObjetivos(double mejor, double peor)
+	{
+		OperadorCruce::asignarObjetivos(mejor, peor);
+		__PasoGenomaFijo<0,Genoma::numGenes>::asignarObjetivos(m_Operadores, mejor, peor);
+	}
+
+	//!Define el proceso de cruce de los genomas fijos
+	/*!
+	\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
+	\param pPeor Gen del individuo padre con peor funcin de evaluacin.
+	\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
+	\param numHijos Numero de genes hijos a crear en el cruce.
+	\param indice Valor que identifica al individuo de cuyos genes se realiza el cruce.*/
+	void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1)
+	{
+		const Genoma *pMadre = static_cast<const Genoma*>(pMejor);
+		const Genoma *pPadre = static_cast<const Genoma*>(pPeor);
+		for(int i=0;i<numHijos;i+=2)
+		{
+			//los hijos se crean de dos en dos, salvo el ltimo si numHijos es impar
+			Genoma *pHijo1 = new Genoma(*pMadre);
+			if(i+1 < numHijos)
+			{
+				Genoma *pHijo2 = new Genoma(*pMadre);
+				__PasoGenomaFijo<0,Genoma::numGenes>::cruzarPareja(m_Operadores, pMadre->getGenes(), pPadre->getGenes(), pHijo1->getGenes(), pHijo2->getGenes(), indice);
+				pHijos->Adicionar(pHijo1);
+				pHijos->Adicionar(pHijo2);
+			}
+			else
+			{
+				__PasoGenomaFijo<0,Genoma::numGenes>::cruzar(m_Operadores, pMadre->getGenes(), pPadre->getGenes(), pHijo1->getGenes(), i, indice);
+				pHijos->Adicionar(pHijo1);
+			}
+		}
+	}
+
+	//!Cruza el genoma en varias parejas copiando el resultado en los genomas que ya tienen los hijos
+	/*!Los hijos de cada pareja se cruzan en \a m_Temporal, pues los individuos hijos pueden ser 
+	los mismos padres, y se copian en sus genes sin crear genomas nuevos.
+	Los parmetros son los de OperadorCruce::cruzarLote().*/
+	void cruzarLote(Individuo **ppMejores, Individuo **ppPeores, Individuo **ppHijos1, Individuo **ppHijos2, const int *pIndices, const double *pObjetivos, int numParejas, const int *pPosiciones, int numPosiciones)
+	{
+		for(int k=0; k<numPosiciones; k++)
+		{
+			int j = pPosiciones[k];
+			for(int i=0; i<numParejas; i++)
+			{
+				const Genoma &Mejor = static_cast<const Genoma&>(ppMejores[i]->getGen(j));
+				const Genoma &Peor = static_cast<const Genoma&>(ppPeores[i]->getGen(j));
+				asignarObjetivos(pObjetivos[i], pObjetivos[numParejas+i]);
+				m_Temporal[0] = Mejor;
+				m_Temporal[1] = Mejor;
+				__PasoGenomaFijo<0,Genoma::numGenes>::cruzarPareja(m_Operadores, Mejor.getGenes(), Peor.getGenes(), m_Temporal[0].getGenes(), m_Temporal[1].getGenes(), pIndices[i]);
+				static_cast<Genoma&>(ppHijos1[i]->getGenModificable(j)) = m_Temporal[0];
+				static_cast<Genoma&>(ppHijos2[i]->getGenModificable(j)) = m_Temporal[1];
+			}
+		}
+	}
+
+	//!Retorna el operador de cruce del gen ubicado en la posicin \a I
+	template<int I> typename std::tuple_element<I,std::tuple<Cs...> >::type& getOperador()
+	{
+		return std::get<I>(m_Operadores);
+	}
+
+protected:
+	//!Operadores de cruce de cada gen
+	std::tuple<Cs...> m_Operadores;
+	//!Genomas en los que se cruza cada pareja en \a cruzarLote()
+	Genoma m_Temporal[2];
+};
+
+
+/****************************************************************************/
+/*				MACRO PARA USO DE GENOMAFIJO								*/
+/****************************************************************************/
+
+//!Macro que adiciona un gen de tipo GenomaFijo al genoma del individuo
+/*!Debe emplearse en la funcin \a codificacion() del algoritmo. Como el tipo del genoma
+contiene comas, debe definirse antes con \a typedef.
+\param pIndividuo Apuntador al individuo al que se le adicionar el gen.
+\param pos Posicin del gen en el genoma del individuo.
+\param tipoGenoma Tipo GenomaFijo<...> definido con \a typedef.
+\param constructor Parmetros del constructor, entre parntesis. Normalmente un gen por cada tipo, p. ej. (GenReal(0,1), GenEntero(0,9)).
+\param variables Variables del sistema a optimizar asociadas con los genes, entre parntesis y en el mismo orden, p. ej. (x, n).*/
+#define ADICIONAR_GENOMAFIJO(pIndividuo, pos, tipoGenoma, constructor, variables)	\
+	{																		\
+		if(estado==ESTADO_CREAR)											\
+		{																	\
+			Gen *pGen=new tipoGenoma constructor;							\
+			pIndividuo->adicionarGen(pGen);									\
+		}																	\
+		else if(estado==ESTADO_CODIFICAR)									\
+		{																	\
+			tipoGenoma &_gen = static_cast<tipoGenoma&>(pIndividuo->getGenModificable(pos));	\
+			_gen.codificar variables;										\
+		}																	\
+		else if(estado==ESTADO_DECODIFICAR)									\
+		{																	\
+			static_cast<const tipoGenoma&>(pIndividuo->getGen(pos)).decodificar variables;	\
+		}																	\
+	}
+
+
+#pragma warning(pop)
+
+#endif
@@ -39,7 +39,7 @@ correspondiente al operador de mutaci
 \return Apuntador al nuevo objeto de la clase OperadorMutacionRealUniforme*/
 inline OperadorMutacion *GenReal::operadorMutacionDefecto() const
 {
-	return (new OperadorMutacionRealUniforme);
+	return (new TipoOperadorMutacionDefecto);
 }
 
 
@@ -48,9 +48,31 @@ correspondiente al operador de cruce establecido por defecto para genes reales.
 \return Apuntador al nuevo objeto de la clase OperadorCruceRealBLX*/
 inline OperadorCruce *GenReal::operadorCruceDefecto() const
 {
-	return (new OperadorCruceRealBLX() );
+	return (new TipoOperadorCruceDefecto);
 }
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+//Llena un arreglo con nmeros aleatorios en el intervalo [0, 1]
+static void __llenarAzar(double *pValores, int num)
+{
+	for(int i=0; i<num; i++)
+		pValores[i] = (double)rand()/(double)RAND_MAX;
+}
+
+//Restringe los valores de un arreglo al rango [Min, Max]. El ciclo no tiene saltos,
+//por lo que el compilador lo convierte en mnimos y mximos vectoriales
+static void __restringirColumna(double *pValores, int num, double Min, double Max)
+{
+	for(int i=0; i<num; i++)
+	{
+		double valor = pValores[i] > Min ? pValores[i] : Min;
+		pValores[i] = valor < Max ? valor : Max;
+	}
+}
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
 /******************************************************************
              Operadores de Mutacin Real (Implementacin)
 ******************************************************************/
@@ -66,6 +88,19 @@ void OperadorMutacionRealUniforme::mutarGen(Gen *pGen)
 	*gr = ( gr->getMin() + azar*(gr->getMax()-gr->getMin()) );
 }
 
+/*!Cada valor se remplaza por un nmero real aleatorio en el rango del gen, como en \a mutarGen().
+\param modelo Gen de tipo GenReal del que se toman los lmites.
+\param pValores Valores del gen, que se remplazan por los mutados.
+\param num Nmero de valores.*/
+void OperadorMutacionRealUniforme::mutarColumna(const Gen &modelo, double *pValores, int num)
+{
+	const GenReal &gr = (const GenReal&)modelo;
+	double Min = gr.getMin(), rango = gr.getMax() - gr.getMin();
+	__llenarAzar(pValores, num);
+	for(int i=0; i<num; i++)
+		pValores[i] = Min + pValores[i]*rango;
+}
+
 /*!
 \param pGen Apuntador al objeto de la clase GenReal que ser sometido a mutacin.
 
@@ -100,6 +135,28 @@ void OperadorMutacionRealNoUniforme::mutarGen(Gen *g)
     }
 }
 
+/*!Cada valor se muta como en \a mutarGen(), y el resultado se restringe al rango del gen.
+\param modelo Gen de tipo GenReal del que se toman los lmites.
+\param pValores Valores del gen, que se remplazan por los mutados.
+\param num Nmero de valores.*/
+void OperadorMutacionRealNoUniforme::mutarColumna(const Gen &modelo, double *pValores, int num)
+{
+	const GenReal &gr = (const GenReal&)modelo;
+	double t = m_pAG->m_Generacion,  T = m_pAG->m_GeneracionMaxima;
+	double exponente = pow((1.0-t/T), m_b);
+	for(int i=0; i<num; i++)
+	{
+		double r = (double)rand()/(double)RAND_MAX;
+		double tau = (double)rand()/(double)RAND_MAX;
+		double factor = 1.0 - pow(r, exponente);
+		if(tau > 0.5)
+			pValores[i] += (gr.getMax() - pValores[i])*factor;
+		else
+			pValores[i] -= (pValores[i] - gr.getMin())*factor;
+	}
+	__restringirColumna(pValores, num, gr.getMin(), gr.getMax());
+}
+
 /*!
 \param pGen Apuntador al objeto de la clase GenReal que ser sometido a mutacin.
 
@@ -133,253 +190,283 @@ void OperadorMutacionRealMuhlenbein::mutarGen(Gen *pGen)
                Operadores de Cruce 
 ************************************************************/
 
-#pragma warning(push, 3)	//Para evitar  "warning(level 4) C4100" ocasionada por parmetros de funciones no referenciados
-
 /*!
 \param pMejor Gen del individuo padre con mejor funcin de evaluacin.
 \param pPeor Gen del individuo padre con peor funcin de evaluacin.
 \param pHijos Arreglo de genes al cual se adicionan los genes hijos.
 \param numHijos Numero de genes hijos a crear en el cruce.
-\param indice Es ignorado. Existe por compatibilidad.
-Crea \a numHijos genes cuyos valores corresponden a 
-nmeros reales aleatorios que pertenecen al intervalo \f$[pMejor,pPeor]\f$
-Los valores resultantes se agregan al arreglo de genes \a pHijos.*/
-void OperadorCruceRealPlano::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+\param indice Valor que identifica al individuo de cuyos genes se realiza el cruce.
+
+Crea \a numHijos genes copiando los lmites de \a pMejor y les asigna
+el valor calculado por \a cruzarValor() para cada hijo.
+Los genes resultantes se agregan al arreglo de genes \a pHijos*/
+void OperadorCruceReal::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
 {
-	GenReal *pMadre=(GenReal*)pMejor, *pPadre=(GenReal*)pPeor;
-	double azar, valor;
+	const GenReal *pMadre=(const GenReal*)pMejor, *pPadre=(const GenReal*)pPeor;
 	for(int i=0;i<numHijos;i++)
 	{
-		azar = (double)((double)rand()/(double)RAND_MAX);
-		valor = *pMadre + azar*( *pPadre - *pMadre );
 		GenReal *gr=new GenReal(*pMadre);
-		*gr = valor;
- 		pHijos->Adicionar(gr);
+		*gr = cruzarValor(*pMadre, *pPadre, i, indice);
+		pHijos->Adicionar(gr);
 	}
 }
 
+#pragma warning(push, 3)	//Para evitar  "warning(level 4) C4100" ocasionada por parmetros de funciones no referenciados
+
 /*!
-\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
-\param pPeor Gen del individuo padre con peor funcin de evaluacin.
-\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
-\param numHijos Numero de genes hijos a crear en el cruce.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
 \param indice Es ignorado. Existe por compatibilidad.
+\return Nmero real aleatorio que pertenece al intervalo \f$[Mejor,Peor]\f$*/
+double OperadorCruceRealPlano::cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice)
+{
+	double azar = (double)((double)rand()/(double)RAND_MAX);
+	return Mejor + azar*( Peor - Mejor );
+}
 
-Crea \a numHijos genes cuyos valores corresponden a 
-nmeros reales que se obtienen as:
-\f[h_1=\lambda pMejor+(1-\lambda)pPeor\f]
-\f[h_2=\lambda pPeor+(1-\lambda)pMejor\f]
-Los valores resultantes se agregan al arreglo de genes \a pHijos*/
-void OperadorCruceRealAritmetico::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+/*!Cada hijo es un nmero real aleatorio entre los valores de los padres, como en \a cruzarValor().
+\param modelo Gen de tipo GenReal del que se toman los lmites.
+\param pMejor Valores del padre con mejor funcin de evaluacin de cada pareja.
+\param pPeor Valores del padre con peor funcin de evaluacin de cada pareja.
+\param pHijo1 Arreglo en el que se escriben los primeros hijos.
+\param pHijo2 Arreglo en el que se escriben los segundos hijos.
+\param num Nmero de parejas.*/
+void OperadorCruceRealPlano::cruzarColumna(const Gen &modelo, const double *pMejor, const double *pPeor, double *pHijo1, double *pHijo2, int num)
 {
-	GenReal *pMadre=(GenReal*)pMejor, *pPadre=(GenReal*)pPeor;
-    double alfa, valor;
-    for(int i=0;i<numHijos;i++)
-    {
-        if(i%2 == 0){alfa=m_Lambda;}else{alfa=1.0-m_Lambda;}
-		valor = alfa * (*pMadre) + (1.0-alfa) * (*pPadre);
-		GenReal *gr=new GenReal(*pMadre);
-		*gr = valor;
-        pHijos->Adicionar(gr);
-    }
+	const GenReal &gr = (const GenReal&)modelo;
+	__llenarAzar(pHijo1, num);
+	__llenarAzar(pHijo2, num);
+	for(int i=0; i<num; i++)
+	{
+		double dif = pPeor[i] - pMejor[i];
+		pHijo1[i] = pMejor[i] + pHijo1[i]*dif;
+		pHijo2[i] = pMejor[i] + pHijo2[i]*dif;
+	}
+	__restringirColumna(pHijo1, num, gr.getMin(), gr.getMax());
+	__restringirColumna(pHijo2, num, gr.getMin(), gr.getMax());
 }
 
 /*!
-\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
-\param pPeor Gen del individuo padre con peor funcin de evaluacin.
-\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
-\param numHijos Numero de genes hijos a crear en el cruce.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
+\param indice Es ignorado. Existe por compatibilidad.
+
+Los hijos pares y los impares se obtienen as:
+\f[h_1=\lambda Mejor+(1-\lambda)Peor\f]
+\f[h_2=\lambda Peor+(1-\lambda)Mejor\f]
+\return Valor real del hijo.*/
+double OperadorCruceRealAritmetico::cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice)
+{
+	double alfa;
+	if(hijo%2 == 0){alfa=m_Lambda;}else{alfa=1.0-m_Lambda;}
+	return alfa * Mejor + (1.0-alfa) * Peor;
+}
+
+/*!Los hijos se obtienen como en \a cruzarValor(), sin nmeros aleatorios.
+\param modelo Gen de tipo GenReal del que se toman los lmites.
+\param pMejor Valores del padre con mejor funcin de evaluacin de cada pareja.
+\param pPeor Valores del padre con peor funcin de evaluacin de cada pareja.
+\param pHijo1 Arreglo en el que se escriben los hijos \f$h_1\f$.
+\param pHijo2 Arreglo en el que se escriben los hijos \f$h_2\f$.
+\param num Nmero de parejas.*/
+void OperadorCruceRealAritmetico::cruzarColumna(const Gen &modelo, const double *pMejor, const double *pPeor, double *pHijo1, double *pHijo2, int num)
+{
+	const GenReal &gr = (const GenReal&)modelo;
+	double lambda = m_Lambda;
+	for(int i=0; i<num; i++)
+	{
+		pHijo1[i] = lambda*pMejor[i] + (1.0-lambda)*pPeor[i];
+		pHijo2[i] = lambda*pPeor[i] + (1.0-lambda)*pMejor[i];
+	}
+	__restringirColumna(pHijo1, num, gr.getMin(), gr.getMax());
+	__restringirColumna(pHijo2, num, gr.getMin(), gr.getMax());
+}
+
+/*!
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
 \param indice Es ignorado. Existe por compatibilidad.
 
-Crea \a numHijos genes cuyos valores corresponden a 
-nmeros reales aleatorios del intervalo
+\return Nmero real aleatorio del intervalo
 \f$[c_{min} - I \alpha , c_{max} + I \alpha]\f$ donde
-\f$c_{min}=min[pMejor,pPeor]\f$, \f$c_{max}=max[pMejor,pPeor]\f$
-e \f$I=c_{max}-c_{min}\f$.
-Los valores resultantes se agregan al arreglo de genes \a pHijos*/
-void OperadorCruceRealBLX::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+\f$c_{min}=min[Mejor,Peor]\f$, \f$c_{max}=max[Mejor,Peor]\f$
+e \f$I=c_{max}-c_{min}\f$.*/
+double OperadorCruceRealBLX::cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice)
 {
-	GenReal *pMadre=(GenReal*)pMejor, *pPadre=(GenReal*)pPeor;    
-    double cMin = _MINIMO( *pMadre, *pPadre);
-	double cMax = _MAXIMO( *pMadre, *pPadre);
-    double I = cMax - cMin;
+	double cMin = _MINIMO( (double)Mejor, (double)Peor);
+	double cMax = _MAXIMO( (double)Mejor, (double)Peor);
+	double I = cMax - cMin;
 	double minimo = cMin - I*m_Alfa;
-    double maximo = cMax + I*m_Alfa;
-	for(int i=0;i<numHijos;i++)
+	double maximo = cMax + I*m_Alfa;
+	double azar = (double)rand()/(double)RAND_MAX;
+	return minimo + azar*(maximo-minimo);
+}
+
+/*!Cada hijo es un nmero real aleatorio del intervalo definido en \a cruzarValor().
+\param modelo Gen de tipo GenReal del que se toman los lmites.
+\param pMejor Valores del padre con mejor funcin de evaluacin de cada pareja.
+\param pPeor Valores del padre con peor funcin de evaluacin de cada pareja.
+\param pHijo1 Arreglo en el que se escriben los primeros hijos.
+\param pHijo2 Arreglo en el que se escriben los segundos hijos.
+\param num Nmero de parejas.*/
+void OperadorCruceRealBLX::cruzarColumna(const Gen &modelo, const double *pMejor, const double *pPeor, double *pHijo1, double *pHijo2, int num)
+{
+	const GenReal &gr = (const GenReal&)modelo;
+	double alfa = m_Alfa, ancho = 1.0 + 2.0*m_Alfa;
+	__llenarAzar(pHijo1, num);
+	__llenarAzar(pHijo2, num);
+	for(int i=0; i<num; i++)
 	{
-        double azar = (double)rand()/(double)RAND_MAX;
-		double valor = minimo + azar*(maximo-minimo);
-		GenReal *gr=new GenReal(*pMadre);
-		*gr = valor;
-        pHijos->Adicionar(gr);
-    }
+		double cMin = _MINIMO(pMejor[i], pPeor[i]);
+		double cMax = _MAXIMO(pMejor[i], pPeor[i]);
+		double I = cMax - cMin;
+		double minimo = cMin - I*alfa;
+		pHijo1[i] = minimo + pHijo1[i]*I*ancho;
+		pHijo2[i] = minimo + pHijo2[i]*I*ancho;
+	}
+	__restringirColumna(pHijo1, num, gr.getMin(), gr.getMax());
+	__restringirColumna(pHijo2, num, gr.getMin(), gr.getMax());
 }
 
 
 /*!
-\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
-\param pPeor Gen del individuo padre con peor funcin de evaluacin.
-\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
-\param numHijos Numero de genes hijos a crear en el cruce.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
 \param indice Es ignorado. Existe por compatibilidad.
 
-Crea \a numHijos valores que corresponden a 
-nmeros reales que se obtienen as:
-\f[ h_1= \frac{1}{2} pMejor + \frac{1}{2} pPeor \f]
-\f[ h_2= \frac{3}{2} pMejor - \frac{1}{2} pPeor \f]
-\f[ h_3= - \frac{1}{2} pMejor + \frac{3}{2} pPeor \f]
-La seleccin de los valores que se almacenan en los genes depende del 
-valor de la variable \a numHijos. 
-Los valores resultantes se agregan al arreglo de genes \a pHijos*/
-void OperadorCruceRealLineal::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+Los hijos se obtienen de forma cclica as:
+\f[ h_1= \frac{1}{2} Mejor + \frac{1}{2} Peor \f]
+\f[ h_2= \frac{3}{2} Mejor - \frac{1}{2} Peor \f]
+\f[ h_3= - \frac{1}{2} Mejor + \frac{3}{2} Peor \f]
+\return Valor real del hijo.*/
+double OperadorCruceRealLineal::cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice)
 {
-	GenReal *pMadre=(GenReal*)pMejor, *pPadre=(GenReal*)pPeor;
 	double valor=0;
-	for(int i=0; i<numHijos; i++)
-	{		
-		switch (i%3)
-		{
-		case 0:
-			valor =   (*pMadre)*0.5 + (*pPadre)*0.5;	break;
-		case 1:
-			valor = (*pMadre)*1.5 - (*pPadre)*0.5;	break;
-		case 2:
-			valor =  -(*pMadre)*0.5 + (*pPadre)*1.5;	break;
-		}
-		GenReal *gr=new GenReal(*pMadre);
-		*gr = valor;
-		pHijos->Adicionar(gr);
+	switch (hijo%3)
+	{
+	case 0:
+		valor =   Mejor*0.5 + Peor*0.5;	break;
+	case 1:
+		valor = Mejor*1.5 - Peor*0.5;	break;
+	case 2:
+		valor =  -Mejor*0.5 + Peor*1.5;	break;
 	}
+	return valor;
 }
 
 /*!
-\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
-\param pPeor Gen del individuo padre con peor funcin de evaluacin.
-\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
-\param numHijos Numero de genes hijos a crear en el cruce.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
 \param indice Es ignorado. Existe por compatibilidad.
-
-Crea \a numHijos genes cuyos valores son tomados aleatoriamente 
-del valor del gen padre o el del gen madre.
-Los genes resultantes se agregan al arreglo de genes \a pHijos*/
-void OperadorCruceRealDiscreto::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+\return Valor tomado aleatoriamente del gen padre o del gen madre.*/
+double OperadorCruceRealDiscreto::cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice)
 {
-	GenReal *pMadre=(GenReal*)pMejor, *pPadre=(GenReal*)pPeor;
-	double azar, valor;
-	for(int i=0;i<numHijos;i++)
-	{		
-		azar = (double)rand()/(double)RAND_MAX;
-		azar>0.5 ?  valor= *pMadre : valor= *pPadre;
-		GenReal *gr=new GenReal(*pMadre);
-		*gr = valor;
-		pHijos->Adicionar(gr);
-	}
+	double azar = (double)rand()/(double)RAND_MAX;
+	return azar>0.5 ? Mejor.getVal() : Peor.getVal();
 }
 
 /*!
-\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
-\param pPeor Gen del individuo padre con peor funcin de evaluacin.
-\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
-\param numHijos Numero de genes hijos a crear en el cruce.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
 \param indice Es ignorado. Existe por compatibilidad.
 
-Crea \a numHijos genes cuyos valores corresponden a 
-nmeros reales que se obtienen as:
-\f[ h_1= pMejor + \alpha _i(pPeor - pMejor)\f]
+El valor del hijo se obtiene as:
+\f[ h_1= Peor + \alpha _i(Mejor - Peor)\f]
 \f$\alpha _i\f$ se escoge aleatoriamente en el intervalo \f$[-0.25,1.25]\f$
-Los valores resultantes se agregan al arreglo de genes \a pHijos*/
-void OperadorCruceRealIntermedioExtendido::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+\return Valor real del hijo.*/
+double OperadorCruceRealIntermedioExtendido::cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice)
 {
-	GenReal *pMadre=(GenReal*)pMejor, *pPadre=(GenReal*)pPeor;        
-    for(int i=0; i<numHijos; i++)
-	{		
-		double azar=(double)((double)rand()/(double)RAND_MAX);
-		double Alfa = -0.25 + 1.5*azar;
-		double valor = *pPadre + Alfa*( *pMadre - *pPadre );
-		GenReal *gr=new GenReal(*pMadre);
-		*gr = valor;
-		pHijos->Adicionar(gr);
+	double azar=(double)((double)rand()/(double)RAND_MAX);
+	double Alfa = -0.25 + 1.5*azar;
+	return Peor + Alfa*( Mejor - Peor );
+}
+
+/*!Cada hijo se obtiene como en \a cruzarValor(), con su propio \f$\alpha _i\f$.
+\param modelo Gen de tipo GenReal del que se toman los lmites.
+\param pMejor Valores del padre con mejor funcin de evaluacin de cada pareja.
+\param pPeor Valores del padre con peor funcin de evaluacin de cada pareja.
+\param pHijo1 Arreglo en el que se escriben los primeros hijos.
+\param pHijo2 Arreglo en el que se escriben los segundos hijos.
+\param num Nmero de parejas.*/
+void OperadorCruceRealIntermedioExtendido::cruzarColumna(const Gen &modelo, const double *pMejor, const double *pPeor, double *pHijo1, double *pHijo2, int num)
+{
+	const GenReal &gr = (const GenReal&)modelo;
+	__llenarAzar(pHijo1, num);
+	__llenarAzar(pHijo2, num);
+	for(int i=0; i<num; i++)
+	{
+		double dif = pMejor[i] - pPeor[i];
+		pHijo1[i] = pPeor[i] + (-0.25 + 1.5*pHijo1[i])*dif;
+		pHijo2[i] = pPeor[i] + (-0.25 + 1.5*pHijo2[i])*dif;
 	}
+	__restringirColumna(pHijo1, num, gr.getMin(), gr.getMax());
+	__restringirColumna(pHijo2, num, gr.getMin(), gr.getMax());
 }
 
 
 /*!
-\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
-\param pPeor Gen del individuo padre con peor funcin de evaluacin.
-\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
-\param numHijos Numero de genes hijos a crear en el cruce.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
 \param indice Es ignorado. Existe por compatibilidad.
 
-Crea \a numHijos genes cuyos valores corresponden a 
-nmeros reales que se obtienen as:
-\f[ h = r (pMejor - pPeor) + pMejor \f]
-\a r es un nmero aleatorio perteneciente al intervalo [0, 1] y \a pMejor corresponde al
+El valor del hijo se obtiene as:
+\f[ h = r (Mejor - Peor) + Mejor \f]
+\a r es un nmero aleatorio perteneciente al intervalo [0, 1] y \a Mejor corresponde al
 gen padre que tiene la mejor funcin de evaluacin.
-Los valores resultantes se agregan al arreglo de genes \a pHijos*/
-void OperadorCruceRealHeuristico::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+\return Valor real del hijo.*/
+double OperadorCruceRealHeuristico::cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice)
 {
-	GenReal *pMadre=(GenReal*)pMejor, *pPadre=(GenReal*)pPeor;
-	for(int i=0;i<numHijos;i++)
-	{
-		double r = (double)rand()/(double)RAND_MAX;
-		double valor = *pMadre + r*( *pMadre - *pPadre );		
-		GenReal *gr=new GenReal(*pMadre);
-		*gr = valor;
-		pHijos->Adicionar(gr);
-	}
+	double r = (double)rand()/(double)RAND_MAX;
+	return Mejor + r*( Mejor - Peor );
 }
 
 #pragma warning(pop)
 
 
 /*!
-\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
-\param pPeor Gen del individuo padre con peor funcin de evaluacin.
-\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
-\param numHijos Numero de genes hijos a crear en el cruce.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin.
+\param hijo Nmero del hijo que se est creando.
 \param indice Valor que identifica al individuo de cuyos genes se realiza el cruce.
 
-Crea \a numHijos genes cuyos valores corresponden a 
-nmeros reales que se obtienen as:
+El valor del hijo se obtiene as:
 
-\f[ h_1= pMejor + rango_i \gamma \Delta \f]
+\f[ h_1= Mejor + rango_i \gamma \Delta \f]
 
 Donde: 
-\f[ \Delta= frac{pPeor - pMejor}{\left|Fevaluacion_{pMejor}-Fevaluacion_{pPeor}\right|} \f]
+\f[ \Delta= frac{Peor - Mejor}{\left|Fevaluacion_{Mejor}-Fevaluacion_{Peor}\right|} \f]
 
 \f[ \Gamma= \sum_{k=0}^{15} \alpha_k 2^{-k} \f]
 \f[rango_i = 0.5 (Mximo - Mnimo)\f]  
 
-\a pMejor corresponde al gen padre que tiene la mejor funcin de evaluacin,
+\a Mejor corresponde al gen padre que tiene la mejor funcin de evaluacin,
 \a Mximo y \a Mnimo corresponden a los lmites establecidos en el gen y
 \f$\alpha_k\f$ puede ser 0  1, con probabilidad de ser 1 de 0.0625,
-Los valores resultantes se agregan al arreglo de genes \a pHijos*/
-void OperadorCruceRealLinealBGA::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+\return Valor real del hijo.*/
+double OperadorCruceRealLinealBGA::cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice)
 {
-	GenReal *pMadre=(GenReal*)pMejor, *pPadre=(GenReal*)pPeor;
-	double dif, delta, gamma, azar, alfa, rango, valor;
-	for(int i=0; i<numHijos; i++)
+	double dif, delta, gamma, azar, alfa, rango;
+	dif=fabs( m_ObjetivoMejor - m_ObjetivoPeor );
+	if(dif!=0)
+		delta = (Peor - Mejor)/(dif);
+	else
+		delta = 1.0;
+	gamma=0.0;
+	for(int j=0;j<16;j++)
 	{
-		dif=fabs( m_pAG->m_pPoblacionActual->getIndividuo(indice).objetivo() - 
-			m_pAG->m_pPoblacionActual->getIndividuo(indice).getPareja()->objetivo());
-		if(dif!=0)
-			delta = (*pPadre - *pMadre)/(dif);
-		else
-			delta = 1.0;
-		gamma=0.0;
-		for(int j=0;j<16;j++)
-		{
-			azar=(double)rand()/(double)RAND_MAX;
-			azar<0.0625?  alfa=1.0  : alfa=0.0;
-			gamma+=alfa*pow(2.0,-(double)(j));
-		}
-		rango = 0.5*(pMadre->getMax() - pMadre->getMin());		
-		valor = *pMadre  +  rango * gamma * delta;
-		
-		GenReal *gr=new GenReal(*pMadre);
-		*gr = valor;
-		pHijos->Adicionar(gr);
+		azar=(double)rand()/(double)RAND_MAX;
+		azar<0.0625?  alfa=1.0  : alfa=0.0;
+		gamma+=alfa*pow(2.0,-(double)(j));
 	}
+	rango = 0.5*(Mejor.getMax() - Mejor.getMin());		
+	return Mejor  +  rango * gamma * delta;
 }
 
 #endif	//__GENREAL_CPP
@@ -3,6 +3,10 @@
 
 #include"genetico.h"
 
+class OperadorCruceReal;
+class OperadorMutacionRealUniforme;
+class OperadorCruceRealBLX;
+
 /************************************************************
                       GEN REAL (double)
 ************************************************************/
@@ -44,6 +48,35 @@ public:
 		operator=(*((const GenReal*)(&origen))); 
 	}
 
+	//!Retorna la diferencia entre los valores de dos genes, relativa al rango del gen
+	/*!
+	\param otro Gen de tipo GenReal con el que se compara.
+	\return Valor en el intervalo [0, 1].*/
+	double distancia(const Gen& otro) const
+	{
+		double rango = m_Maximo - m_Minimo;
+		double dif = fabs(m_Valor - ((const GenReal*)(&otro))->m_Valor);
+		return rango>0.0 ? dif/rango : 0.0;
+	}
+
+	//!El gen se representa con un valor
+	int numValores() const
+	{
+		return 1;
+	}
+
+	//!Escribe el valor actual del gen
+	void getValores(double *pDestino) const
+	{
+		*pDestino = m_Valor;
+	}
+
+	//!Asigna al gen el primer valor de \a pOrigen
+	void setValores(const double *pOrigen, int)
+	{
+		setVal(pOrigen[0]);
+	}
+
     //!Operador de asignacin a partir de un dato real.
 	/*!Asigna al gen el valor de un dato de tipo real. 
 	\param nuevoValor Nmero real que se asigna al gen
@@ -116,6 +149,15 @@ public:
     //!Retorna un objeto correspondiente al operador de cruce establecido por defecto para genes enteros
     inline OperadorCruce *operadorCruceDefecto() const;
 
+	//!Tipo base de los operadores de cruce de genes reales
+	typedef OperadorCruceReal TipoOperadorCruce;
+
+	//!Tipo del operador de mutacin por defecto para genes reales
+	typedef OperadorMutacionRealUniforme TipoOperadorMutacionDefecto;
+
+	//!Tipo del operador de cruce por defecto para genes reales
+	typedef OperadorCruceRealBLX TipoOperadorCruceDefecto;
+
 protected:
 	
 	//!Almacena la Informacin del gen
@@ -147,6 +189,14 @@ public:
     ~OperadorMutacionRealUniforme(){}
     //!Ejecuta una mutacin uniforme sobre un objeto de la clase GenReal
     void mutarGen(Gen *pGen);
+
+	//!Puede mutar a la vez los valores de un gen en varios individuos
+	bool mutacionMatricial() const
+	{
+		return true;
+	}
+	//!Ejecuta la mutacin uniforme sobre los valores de un gen en varios individuos
+	void mutarColumna(const Gen &modelo, double *pValores, int num);
 };
 
 //!Clase derivada de la clase OperadorMutacion empleada en genes reales
@@ -181,6 +231,14 @@ public:
 	//!Ejecuta una mutacin no uniforme sobre un objeto de la clase GenReal
 	void mutarGen(Gen *g);
 
+	//!Puede mutar a la vez los valores de un gen en varios individuos
+	bool mutacionMatricial() const
+	{
+		return true;
+	}
+	//!Ejecuta la mutacin no uniforme sobre los valores de un gen en varios individuos
+	void mutarColumna(const Gen &modelo, double *pValores, int num);
+
 private:
 	
 	//!Parmetro que determina el grado de dependencia con el numero de generaciones. 
@@ -230,9 +288,32 @@ private:
                         Operadores de Cruce
 *******************************************************************/
 
-//!Clase derivada de la clase OperadorCruce empleada en genes reales
+//!Clase abstracta derivada de la clase OperadorCruce empleada en genes reales
+/*!Es la base de todos los operadores de cruce de genes reales. Las clases derivadas
+solo definen el valor de cada hijo en \a cruzarValor(); la creacin de los genes hijos
+la realiza \a cruzarGenes(). Esto permite cruzar directamente valores reales sin crear
+objetos GenReal, como lo hace el operador de cruce de GenArregloReal.
+
+Los operadores de cruce plano, aritmtico, BLX - \f$\alpha\f$ e intermedio extendido tambin
+implementan OperadorCruce::cruzarColumna(), que cruza un gen en todas las parejas de la poblacin
+en un solo ciclo sobre valores contiguos (Ver MatrizPoblacion), y restringen los hijos a los
+lmites del gen con mnimos y mximos sobre todo el arreglo.*/
+class OperadorCruceReal:public OperadorCruce
+{
+public:
+	//!Constructor
+	OperadorCruceReal(){}
+	//!Destructor
+	virtual ~OperadorCruceReal(){}
+	//!Crea los genes hijos con los valores calculados por \a cruzarValor()
+	void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+	//!Calcula el valor real de un hijo a partir de los genes padres
+	virtual double cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice)=0;
+};
+
+//!Clase derivada de la clase OperadorCruceReal empleada en genes reales
 /*!Efecta un cruce plano entre dos genes de tipo real*/
-class OperadorCruceRealPlano : public OperadorCruce
+class OperadorCruceRealPlano:public OperadorCruceReal
 {
 public:
 	//!Constructor
@@ -240,12 +321,19 @@ public:
 	//!Destructor
     ~OperadorCruceRealPlano(){}
 	//!Ejecuta un cruce plano sobre genes reales
-    void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+    double cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice);
+	//!Puede cruzar a la vez los valores de un gen en varias parejas
+	bool cruceMatricial() const
+	{
+		return true;
+	}
+	//!Ejecuta el cruce plano sobre los valores de un gen en varias parejas
+	void cruzarColumna(const Gen &modelo, const double *pMejor, const double *pPeor, double *pHijo1, double *pHijo2, int num);
 };
 
-//!Clase derivada de la clase OperadorCruce empleada en genes reales
+//!Clase derivada de la clase OperadorCruceReal empleada en genes reales
 /*!Efecta un cruce aritmtico entre dos genes de tipo real*/
-class OperadorCruceRealAritmetico:public OperadorCruce
+class OperadorCruceRealAritmetico:public OperadorCruceReal
 {
 public:
 	/*!Inicializa el valor del parmetro \a Lambda.
@@ -268,15 +356,22 @@ public:
 	//!Destructor 
 	~OperadorCruceRealAritmetico(){}
 	//!Ejecuta un cruce aritmtico sobre genes reales.
-	void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+	double cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice);
+	//!Puede cruzar a la vez los valores de un gen en varias parejas
+	bool cruceMatricial() const
+	{
+		return true;
+	}
+	//!Ejecuta el cruce aritmtico sobre los valores de un gen en varias parejas
+	void cruzarColumna(const Gen &modelo, const double *pMejor, const double *pPeor, double *pHijo1, double *pHijo2, int num);
 private:
 	//!Parmetro que pondera cada uno de los genes padres.
 	double m_Lambda;
 };
 
-//!Clase derivada de la clase OperadorCruce empleada en genes reales
+//!Clase derivada de la clase OperadorCruceReal empleada en genes reales
 /*!Efecta un cruce BLX - \f$\alpha\f$ entre dos genes de tipo real*/
-class OperadorCruceRealBLX:public OperadorCruce
+class OperadorCruceRealBLX:public OperadorCruceReal
 {
 public:
 	//!Constructor
@@ -300,15 +395,22 @@ public:
 	//!Destructor 
 	~OperadorCruceRealBLX(){}  
 	//!Ejecuta el cruce BLX - \f$\alpha\f$ sobre genes reales.
-	void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+	double cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice);
+	//!Puede cruzar a la vez los valores de un gen en varias parejas
+	bool cruceMatricial() const
+	{
+		return true;
+	}
+	//!Ejecuta el cruce BLX - \f$\alpha\f$ sobre los valores de un gen en varias parejas
+	void cruzarColumna(const Gen &modelo, const double *pMejor, const double *pPeor, double *pHijo1, double *pHijo2, int num);
 private:
 	//!Establece la amplitud del intervalo de definicin.
 	double m_Alfa;
 };
 
-//!Clase derivada de la clase OperadorCruce empleada en genes reales
+//!Clase derivada de la clase OperadorCruceReal empleada en genes reales
 /*!Efecta un cruce lineal entre dos genes de tipo real*/
-class OperadorCruceRealLineal:public OperadorCruce
+class OperadorCruceRealLineal:public OperadorCruceReal
 {
 public:
 	//!Constructor 
@@ -316,12 +418,12 @@ public:
 	//!Destructor 
 	~OperadorCruceRealLineal(){}
 	//!Ejecuta un cruce lineal sobre genes reales
-	void cruzarGenes(const Gen *madre, const Gen *padre, Arreglo<Gen> *hijos, int numHijos, int indice=-1);
+	double cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice);
 };
 
-//!Clase derivada de la clase OperadorCruce empleada en genes reales
+//!Clase derivada de la clase OperadorCruceReal empleada en genes reales
 /*!Efecta un cruce discreto entre dos genes de tipo real*/
-class OperadorCruceRealDiscreto:public OperadorCruce
+class OperadorCruceRealDiscreto:public OperadorCruceReal
 {
 public:
   //!Constructor 
@@ -329,12 +431,12 @@ public:
   //!Destructor 
   ~OperadorCruceRealDiscreto(){}
   //!Ejecuta un cruce discreto sobre genes reales
-  void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+  double cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice);
 };
 
-//!Clase derivada de la clase OperadorCruce empleada en genes reales
+//!Clase derivada de la clase OperadorCruceReal empleada en genes reales
 /*!Efecta el cruce extendido intermedio entre dos genes de tipo real*/
-class OperadorCruceRealIntermedioExtendido:public OperadorCruce
+class OperadorCruceRealIntermedioExtendido:public OperadorCruceReal
 {
 public:
 	//!Constructor
@@ -342,12 +444,19 @@ public:
 	//!Destructor
 	~OperadorCruceRealIntermedioExtendido(){}
 	//!Ejecuta un cruce intermedio extendido sobre genes reales
-	void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+	double cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice);
+	//!Puede cruzar a la vez los valores de un gen en varias parejas
+	bool cruceMatricial() const
+	{
+		return true;
+	}
+	//!Ejecuta el cruce intermedio extendido sobre los valores de un gen en varias parejas
+	void cruzarColumna(const Gen &modelo, const double *pMejor, const double *pPeor, double *pHijo1, double *pHijo2, int num);
 };
 
-//!Clase derivada de la clase OperadorCruce empleada en genes reales
+//!Clase derivada de la clase OperadorCruceReal empleada en genes reales
 /*!Efecta un cruce heurstico entre dos genes de tipo real*/
-class OperadorCruceRealHeuristico:public OperadorCruce
+class OperadorCruceRealHeuristico:public OperadorCruceReal
 {
 public:
 	//!Constructor
@@ -355,13 +464,14 @@ public:
 	//!Destructor
 	~OperadorCruceRealHeuristico(){}
 	//!Ejecuta un cruce heurstico sobre genes reales
-	void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+	double cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice);
 };
 
 
-//!Clase derivada de la clase OperadorCruce empleada en genes reales
-/*!Efecta un cruce BGA linealentre genes de tipo real*/
-class OperadorCruceRealLinealBGA:public OperadorCruce
+//!Clase derivada de la clase OperadorCruceReal empleada en genes reales
+/*!Efecta un cruce BGA linealentre genes de tipo real
+Las funciones objetivo de los padres las recibe en OperadorCruce::asignarObjetivos().*/
+class OperadorCruceRealLinealBGA:public OperadorCruceReal
 {
 public:
 	//!Constructor
@@ -369,9 +479,9 @@ public:
 	//!Destructor
 	~OperadorCruceRealLinealBGA(){}
 	//!Ejecuta el cruce BGA lineal sobre genes reales
-	void cruzarGenes(const Gen *madre, const Gen *padre, Arreglo<Gen> *hijos, int numHijos, int indice);
+	double cruzarValor(const GenReal& Mejor, const GenReal& Peor, int hijo, int indice);
 private:
-	//!Apuntador al objeto AlgoritmoGenetico en el que opera
+	//!Apuntador al objeto AlgoritmoGenetico en el que opera. Se conserva por compatibilidad
 	AlgoritmoGenetico *m_pAG;
 };
 
@@ -0,0 +1,521 @@
+#ifndef __GENVECTOR_CPP
+#define __GENVECTOR_CPP
+
+#include "genvector.h"
+
+/************************************************************
+                  GENVECTORREAL (Implementacin)
+************************************************************/
+
+/*!Da a cada dimensin el promedio de los valores \a Min y \a Max.
+\param Dimension Nmero de dimensiones del vector. Como mnimo es 1.
+\param Min Valor mnimo que puede tomar cada dimensin. Por defecto es 0.0.
+\param Max Valor mximo que puede tomar cada dimensin. Si es menor que \a Min, se hace igual a \a Min. Por defecto es 1.0.*/
+GenVectorReal::GenVectorReal(int Dimension, double Min, double Max)
+{
+	crear(Dimension);
+	if(Max < Min) Max = Min;
+	for(int i=0; i<m_Dimension; i++)
+	{
+		m_pLimites->m_pMinimos[i] = Min;
+		m_pLimites->m_pMaximos[i] = Max;
+		m_pValores[i] = (Min+Max)/2.0;
+	}
+}
+
+
+/*!\param Dimension Nmero de dimensiones del vector. Como mnimo es 1.
+\param Min Valor mnimo que puede tomar cada dimensin.
+\param Max Valor mximo que puede tomar cada dimensin. Si es menor que \a Min, se hace igual a \a Min.
+\param ValorInicial Valor inicial de cada dimensin. Se restringe al rango <i>[Min, Max]</i>*/
+GenVectorReal::GenVectorReal(int Dimension, double Min, double Max, double ValorInicial)
+{
+	crear(Dimension);
+	if(Max < Min) Max = Min;
+	ValorInicial = restringir(ValorInicial, Min, Max);
+	for(int i=0; i<m_Dimension; i++)
+	{
+		m_pLimites->m_pMinimos[i] = Min;
+		m_pLimites->m_pMaximos[i] = Max;
+		m_pValores[i] = ValorInicial;
+	}
+}
+
+
+/*!Da a cada dimensin el promedio de sus lmites.
+\param Dimension Nmero de dimensiones del vector. Como mnimo es 1.
+\param pMinimos Arreglo de \a Dimension valores mnimos.
+\param pMaximos Arreglo de \a Dimension valores mximos. Si alguno es menor que su mnimo, se hace igual al mnimo.*/
+GenVectorReal::GenVectorReal(int Dimension, const double *pMinimos, const double *pMaximos)
+{
+	crear(Dimension);
+	for(int i=0; i<m_Dimension; i++)
+	{
+		double Min = pMinimos[i], Max = pMaximos[i];
+		if(Max < Min) Max = Min;
+		m_pLimites->m_pMinimos[i] = Min;
+		m_pLimites->m_pMaximos[i] = Max;
+		m_pValores[i] = (Min+Max)/2.0;
+	}
+}
+
+
+/*!Copia los valores de \a origen y usa sus mismos lmites.
+\param origen Objeto del que se hace copia.*/
+GenVectorReal::GenVectorReal(const GenVectorReal& origen)
+{
+	m_Dimension = origen.m_Dimension;
+	m_pValores = new double[m_Dimension];
+	m_pLimites = origen.m_pLimites;
+	m_pLimites->m_referencias++;
+	for(int i=0; i<m_Dimension; i++)
+		m_pValores[i] = origen.m_pValores[i];
+}
+
+
+GenVectorReal::~GenVectorReal()
+{
+	delete [] m_pValores;
+	soltarLimites();
+}
+
+
+/*!\param Dimension Nmero de dimensiones del vector. Como mnimo es 1.*/
+void GenVectorReal::crear(int Dimension)
+{
+	if(Dimension < 1) Dimension = 1;
+	m_Dimension = Dimension;
+	m_pValores = new double[Dimension];
+	m_pLimites = new LimitesVectorReal(Dimension);
+}
+
+
+void GenVectorReal::soltarLimites()
+{
+	if(--m_pLimites->m_referencias == 0)
+		delete m_pLimites;
+	m_pLimites = NULL;
+}
+
+
+/*!Si las dimensiones coinciden, solo se copian los valores; si no, se crea un nuevo bloque.
+En ambos casos se pasan a usar los lmites de \a origen.
+\param origen Objeto del que se hace copia.
+\return Referencia al objeto actual.*/
+const GenVectorReal& GenVectorReal::operator = (const GenVectorReal& origen)
+{
+	if(this == &origen)
+		return *this;
+	if(m_pLimites != origen.m_pLimites)
+	{
+		origen.m_pLimites->m_referencias++;
+		soltarLimites();
+		m_pLimites = origen.m_pLimites;
+	}
+	if(m_Dimension != origen.m_Dimension)
+	{
+		delete [] m_pValores;
+		m_Dimension = origen.m_Dimension;
+		m_pValores = new double[m_Dimension];
+	}
+	for(int i=0; i<m_Dimension; i++)
+		m_pValores[i] = origen.m_pValores[i];
+	return *this;
+}
+
+
+/*!Se toman los primeros datos de \a origen, hasta la dimensin del vector, y se restringen a sus lmites.
+\param origen Arreglo del que se toman los valores.
+\return Referencia al objeto actual.*/
+const GenVectorReal& GenVectorReal::operator = (const ArregloReal& origen)
+{
+	int tam = _MINIMO(origen.getSize(), m_Dimension);
+	for(int i=0; i<tam; i++)
+		m_pValores[i] = origen.getObjDirecto(i);
+	restringirValores();
+	return *this;
+}
+
+
+/*!Se toman los primeros datos de \a origen, hasta la dimensin del vector, y se restringen a sus lmites.
+\param origen Vista de la que se toman los valores.
+\return Referencia al objeto actual.*/
+const GenVectorReal& GenVectorReal::operator = (const VistaArregloReal& origen)
+{
+	//si la vista apunta a los valores de este mismo gen no hay nada que copiar
+	if(origen.begin() != m_pValores)
+		setValores(origen.begin(), origen.getSize());
+	return *this;
+}
+
+
+/*!El arreglo toma el tamao del vector.
+\param destino Arreglo en el que se copian los valores.*/
+void GenVectorReal::decodificar(ArregloReal &destino) const
+{
+	destino.asignarMemoria(m_Dimension);
+	int i, tam = destino.getSize();
+	for(i=0; i<tam && i<m_Dimension; i++)
+		destino[i] = m_pValores[i];
+	for(i=tam; i<m_Dimension; i++)
+		destino.Adicionar( new double(m_pValores[i]) );
+	destino.Truncar(m_Dimension);
+}
+
+
+/*!La diferencia de cada dimensin se divide por su rango; las dimensiones de rango nulo no se tienen en cuenta.
+\param otro Gen de tipo GenVectorReal con la misma dimensin.
+\return Distancia en el intervalo [0, 1].*/
+double GenVectorReal::distancia(const Gen& otro) const
+{
+	const GenVectorReal &vec = *((const GenVectorReal*)(&otro));
+	int tam = _MINIMO(m_Dimension, vec.m_Dimension);
+	const double *pMin = getMinimos(), *pMax = getMaximos();
+	double suma = 0.0;
+	for(int i=0; i<tam; i++)
+	{
+		double rango = pMax[i] - pMin[i];
+		if(rango > 0.0)
+			suma += fabs(m_pValores[i] - vec.m_pValores[i]) / rango;
+	}
+	return suma/m_Dimension;
+}
+
+
+/*!\param pOrigen Valores a asignar. Se restringen a los lmites de cada dimensin.
+\param numValores Nmero de valores de \a pOrigen. Si es menor que la dimensin, las ltimas dimensiones no cambian.*/
+void GenVectorReal::setValores(const double *pOrigen, int numValores)
+{
+	int tam = _MINIMO(numValores, m_Dimension);
+	for(int i=0; i<tam; i++)
+		m_pValores[i] = pOrigen[i];
+	restringirValores();
+}
+
+
+/*!Los nmeros aleatorios se generan en el bloque de valores, y luego se llevan al rango de cada dimensin.*/
+void GenVectorReal::generarAleatorio()
+{
+	const double *pMin = getMinimos(), *pMax = getMaximos();
+	__llenarAzar(m_pValores, m_Dimension);
+	for(int i=0; i<m_Dimension; i++)
+		m_pValores[i] = pMin[i] + m_pValores[i]*(pMax[i] - pMin[i]);
+}
+
+
+/*!\param pos Posicin dentro del vector.
+\param valor Nuevo valor. Se restringe a los lmites de la dimensin.
+\return false si \a pos no es una posicin vlida.*/
+bool GenVectorReal::setVal(int pos, double valor)
+{
+	if(pos < 0 || pos >= m_Dimension)
+		return false;
+	m_pValores[pos] = restringir(valor, getMin(pos), getMax(pos));
+	return true;
+}
+
+
+/*!El ciclo no tiene saltos, por lo que el compilador lo convierte en mnimos y mximos vectoriales.*/
+void GenVectorReal::restringirValores()
+{
+	const double *pMin = getMinimos(), *pMax = getMaximos();
+	for(int i=0; i<m_Dimension; i++)
+	{
+		double valor = m_pValores[i] > pMin[i] ? m_pValores[i] : pMin[i];
+		m_pValores[i] = valor < pMax[i] ? valor : pMax[i];
+	}
+}
+
+
+/*!Crea un nuevo objeto de la clase OperadorMutacionVectorRealPolinomial,
+correspondiente al operador de mutacin establecido por defecto para vectores reales.
+\return Apuntador al nuevo objeto de la clase OperadorMutacionVectorRealPolinomial*/
+inline OperadorMutacion *GenVectorReal::operadorMutacionDefecto() const
+{
+	return (new TipoOperadorMutacionDefecto);
+}
+
+
+/*!Crea un nuevo objeto de la clase OperadorCruceVectorRealSBX,
+correspondiente al operador de cruce establecido por defecto para vectores reales.
+\return Apuntador al nuevo objeto de la clase OperadorCruceVectorRealSBX*/
+inline OperadorCruce *GenVectorReal::operadorCruceDefecto() const
+{
+	return (new TipoOperadorCruceDefecto);
+}
+
+
+/******************************************************************
+          Operadores de Mutacin Vector Real (Implementacin)
+******************************************************************/
+
+/*!Las dimensiones que mutan se eligen con saltos geomtricos, como en \a Poblacion::mutar(), de
+modo que con probabilidades bajas solo se generan nmeros aleatorios para las dimensiones que mutan.
+El recorrido comienza en la dimensin elegida por \a decidirMutacionGen() si la hay.
+\param pGen Apuntador al objeto de la clase GenVectorReal que ser sometido a mutacin.*/
+void OperadorMutacionVectorReal::mutarGen(Gen *pGen)
+{
+	GenVectorReal *gv = (GenVectorReal*)pGen;
+	double *pValores = gv->getDatosModificables();
+	const double *pMin = gv->getMinimos(), *pMax = gv->getMaximos();
+	int dimension = gv->getDimension();
+
+	double pos = m_PrimeraMutacion;
+	m_PrimeraMutacion = -1.0;
+	if(pos < 0.0)
+		pos = __saltoMutacion(m_ProbabilidadMutacion) - 1.0;
+	if(pos >= dimension)
+		return;
+	for(; pos < dimension; pos += __saltoMutacion(m_ProbabilidadMutacion))
+	{
+		int i = (int)pos;
+		pValores[i] = mutarValor(pValores[i], pMin[i], pMax[i]);
+	}
+	gv->restringirValores();
+}
+
+
+/*!Elige la primera dimensin que muta con un salto geomtrico y la conserva para \a mutarGen().
+\param pGen Apuntador al objeto de la clase GenVectorReal sobre el que se toma la decisin.
+\return \a true si muta alguna dimensin.*/
+bool OperadorMutacionVectorReal::decidirMutacionGen(const Gen *pGen)
+{
+	m_PrimeraMutacion = __saltoMutacion(m_ProbabilidadMutacion) - 1.0;
+	if(m_PrimeraMutacion < ((const GenVectorReal*)pGen)->getDimension())
+		return true;
+	m_PrimeraMutacion = -1.0;
+	return false;
+}
+
+
+/*!Para una dimensin con valor \a x en el intervalo \f$[a, b]\f$ y un nmero aleatorio \a u:
+\f[\delta = \left\{ \begin{array}{ll}
+\left[2u + (1-2u)(1-\delta_1)^{\eta+1}\right]^{\frac{1}{\eta+1}} - 1 & \textrm{si $u < 0.5$}\\
+1 - \left[2(1-u) + 2(u-0.5)(1-\delta_2)^{\eta+1}\right]^{\frac{1}{\eta+1}} & \textrm{si $u \ge 0.5$}
+\end{array} \right. \f]
+donde \f$\delta_1 = \frac{x-a}{b-a}\f$, \f$\delta_2 = \frac{b-x}{b-a}\f$, y el nuevo valor es \f$x + \delta(b-a)\f$.
+\param valor Valor actual de la dimensin.
+\param Min Valor mnimo de la dimensin.
+\param Max Valor mximo de la dimensin.
+\return Nuevo valor de la dimensin.*/
+double OperadorMutacionVectorRealPolinomial::mutarValor(double valor, double Min, double Max)
+{
+	double rango = Max - Min;
+	if(rango <= 0.0)
+		return valor;
+	double u = (double)rand()/(double)RAND_MAX;
+	double exponente = 1.0/(m_Eta + 1.0);
+	double delta;
+	if(u < 0.5)
+	{
+		double delta1 = (valor - Min)/rango;
+		delta = pow(2.0*u + (1.0 - 2.0*u)*pow(1.0 - delta1, m_Eta + 1.0), exponente) - 1.0;
+	}else
+	{
+		double delta2 = (Max - valor)/rango;
+		delta = 1.0 - pow(2.0*(1.0 - u) + 2.0*(u - 0.5)*pow(1.0 - delta2, m_Eta + 1.0), exponente);
+	}
+	return valor + delta*rango;
+}
+
+
+/*!El desplazamiento se obtiene con la transformacin de Box-Muller.
+\param valor Valor actual de la dimensin.
+\param Min Valor mnimo de la dimensin.
+\param Max Valor mximo de la dimensin.
+\return Nuevo valor de la dimensin.*/
+double OperadorMutacionVectorRealGaussiana::mutarValor(double valor, double Min, double Max)
+{
+	//el primer nmero est en (0,1], para que su logaritmo sea finito
+	double u1 = ((double)rand() + 1.0)/((double)RAND_MAX + 1.0);
+	double u2 = (double)rand()/(double)RAND_MAX;
+	double normal = sqrt(-2.0*log(u1))*cos(6.283185307179586*u2);
+	return valor + normal*m_Sigma*(Max - Min);
+}
+
+
+/*******************************************************************
+          Operadores de Cruce Vector Real (Implementacin)
+*******************************************************************/
+
+/*!Los hijos se crean de dos en dos con \a cruzarParejaEn(); si \a numHijos es impar, el ltimo
+se crea solo con \a cruzarEn().
+\param pMejor Gen del individuo padre con mejor funcin de evaluacin.
+\param pPeor Gen del individuo padre con peor funcin de evaluacin.
+\param pHijos Arreglo de genes al cual se adicionan los genes hijos.
+\param numHijos Numero de genes hijos a crear en el cruce.
+\param indice Valor que identifica al individuo de cuyos genes se realiza el cruce.
+*/
+void OperadorCruceVectorReal::cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice)
+{
+	const GenVectorReal *pMadre = (const GenVectorReal*)pMejor;
+	const GenVectorReal *pPadre = (const GenVectorReal*)pPeor;
+
+	for(int i=0; i<numHijos; i+=2)
+	{
+		//los hijos tienen los mismos lmites de la madre
+		GenVectorReal *gv1 = new GenVectorReal( *pMadre );
+		if(i+1 < numHijos)
+		{
+			GenVectorReal *gv2 = new GenVectorReal( *pMadre );
+			cruzarParejaEn(*pMadre, *pPadre, *gv1, *gv2);
+			pHijos->Adicionar(gv1);
+			pHijos->Adicionar(gv2);
+		}
+		else
+		{
+			cruzarEn(*pMadre, *pPadre, *gv1, i, indice);
+			pHijos->Adicionar(gv1);
+		}
+	}
+}
+
+
+/*!Realiza el cruce sobre un gen hijo ya existente, sin crear objetos en el montn.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin. Debe tener la dimensin de \a Mejor.
+\param Hijo Gen en el que se almacena el resultado. Debe tener los mismos lmites de \a Mejor.
+\param hijo Nmero del hijo que se est creando.
+\param indice Valor que identifica al individuo de cuyos genes se realiza el cruce.
+*/
+void OperadorCruceVectorReal::cruzarEn(const GenVectorReal& Mejor, const GenVectorReal& Peor, GenVectorReal& Hijo, int hijo, int indice)
+{
+	int dimension = _MINIMO(Mejor.getDimension(), Peor.getDimension());
+	cruzarVector(Mejor.getDatos(), Peor.getDatos(), Hijo.getDatosModificables(), dimension, hijo);
+	Hijo.restringirValores();
+}
+
+
+/*!Realiza el cruce sobre dos genes hijos ya existentes, sin crear objetos en el montn.
+\param Mejor Gen del individuo padre con mejor funcin de evaluacin.
+\param Peor Gen del individuo padre con peor funcin de evaluacin. Debe tener la dimensin de \a Mejor.
+\param Hijo1 Gen en el que se almacena el primer hijo. Debe tener los mismos lmites de \a Mejor.
+\param Hijo2 Gen en el que se almacena el segundo hijo. Debe tener los mismos lmites de \a Mejor.
+*/
+void OperadorCruceVectorReal::cruzarParejaEn(const GenVectorReal& Mejor, const GenVectorReal& Peor, GenVectorReal& Hijo1, GenVectorReal& Hijo2)
+{
+	int dimension = _MINIMO(Mejor.getDimension(), Peor.getDimension());
+	cruzarPareja(Mejor.getDatos(), Peor.getDatos(), Hijo1.getDatosModificables(), Hijo2.getDatosModificables(), dimension);
+	Hijo1.restringirValores();
+	Hijo2.restringirValores();
+}
+
+
+/*!Los hijos de cada pareja se cruzan en \a m_Temporal, que conserva sus bloques de datos entre
+parejas, y se copian en los genes de los individuos hijos, de modo que no se crean genes por
+cada hijo. Los parmetros son los de OperadorCruce::cruzarLote().*/
+void OperadorCruceVectorReal::cruzarLote(Individuo **ppMejores, Individuo **ppPeores, Individuo **ppHijos1, Individuo **ppHijos2, const int *pIndices, const double *pObjetivos, int numParejas, const int *pPosiciones, int numPosiciones)
+{
+	for(int k=0; k<numPosiciones; k++)
+	{
+		int j = pPosiciones[k];
+		for(int i=0; i<numParejas; i++)
+		{
+			const GenVectorReal &Mejor = (const GenVectorReal &)ppMejores[i]->getGen(j);
+			const GenVectorReal &Peor = (const GenVectorReal &)ppPeores[i]->getGen(j);
+			asignarObjetivos(pObjetivos[i], pObjetivos[numParejas+i]);
+			m_Temporal[0] = Mejor;
+			m_Temporal[1] = Mejor;
+			cruzarParejaEn(Mejor, Peor, m_Temporal[0], m_Temporal[1]);
+			(GenVectorReal &)ppHijos1[i]->getGenModificable(j) = m_Temporal[0];
+			(GenVectorReal &)ppHijos2[i]->getGenModificable(j) = m_Temporal[1];
+		}
+	}
+}
+
+
+/*!Por defecto calcula cada hijo por separado con \a cruzarVector(), como los hijos 0 y 1.
+Los operadores cuyos dos hijos deben compartir los nmeros aleatorios la sobrecargan.
+No es necesario restringir el resultado.
+\param pMejor Valores del padre con mejor funcin de evaluacin.
+\param pPeor Valores del padre con peor funcin de evaluacin.
+\param pHijo1 Arreglo en el que se escriben los valores del primer hijo.
+\param pHijo2 Arreglo en el que se escriben los valores del segundo hijo.
+\param dimension Nmero de valores.*/
+void OperadorCruceVectorReal::cruzarPareja(const double *pMejor, const double *pPeor, double *pHijo1, double *pHijo2, int dimension)
+{
+	cruzarVector(pMejor, pPeor, pHijo1, dimension, 0);
+	cruzarVector(pMejor, pPeor, pHijo2, dimension, 1);
+}
+
+
+/*!Los nmeros aleatorios se generan primero en \a pHijo, y el ciclo que calcula los valores
+no tiene dependencias entre dimensiones.
+\param pMejor Valores del padre con mejor funcin de evaluacin.
+\param pPeor Valores del padre con peor funcin de evaluacin.
+\param pHijo Arreglo en el que se escriben los valores del hijo.
+\param dimension Nmero de valores.
+\param hijo Nmero del hijo. Los pares usan \f$+\beta\f$ y los impares \f$-\beta\f$, pero con nmeros
+aleatorios propios; para obtener dos hijos simtricos se usa \a cruzarPareja().*/
+void OperadorCruceVectorRealSBX::cruzarVector(const double *pMejor, const double *pPeor, double *pHijo, int dimension, int hijo)
+{
+	double exponente = 1.0/(m_Eta + 1.0);
+	double signo = (hijo%2 == 0) ? 1.0 : -1.0;
+	__llenarAzar(pHijo, dimension);
+	for(int i=0; i<dimension; i++)
+	{
+		double u = pHijo[i];
+		double beta = (u <= 0.5) ? pow(2.0*u, exponente) : pow(1.0/(2.0*(1.0 - u) + 1e-14), exponente);
+		double suma = pMejor[i] + pPeor[i], diferencia = pMejor[i] - pPeor[i];
+		pHijo[i] = 0.5*(suma + signo*beta*diferencia);
+	}
+}
+
+
+/*!Se obtiene un solo \f$\beta\f$ por dimensin para los dos hijos, que quedan simtricos
+respecto a la media de los padres. Los nmeros aleatorios se generan primero en \a pHijo1.
+\param pMejor Valores del padre con mejor funcin de evaluacin.
+\param pPeor Valores del padre con peor funcin de evaluacin.
+\param pHijo1 Arreglo en el que se escriben los valores del primer hijo.
+\param pHijo2 Arreglo en el que se escriben los valores del segundo hijo.
+\param dimension Nmero de valores.*/
+void OperadorCruceVectorRealSBX::cruzarPareja(const double *pMejor, const double *pPeor, double *pHijo1, double *pHijo2, int dimension)
+{
+	double exponente = 1.0/(m_Eta + 1.0);
+	__llenarAzar(pHijo1, dimension);
+	for(int i=0; i<dimension; i++)
+	{
+		double u = pHijo1[i];
+		double beta = (u <= 0.5) ? pow(2.0*u, exponente) : pow(1.0/(2.0*(1.0 - u) + 1e-14), exponente);
+		double suma = pMejor[i] + pPeor[i], diferencia = pMejor[i] - pPeor[i];
+		pHijo1[i] = 0.5*(suma + beta*diferencia);
+		pHijo2[i] = 0.5*(suma - beta*diferencia);
+	}
+}
+
+
+/*!Cada dimensin del hijo es un nmero aleatorio en el intervalo de los padres ampliado
+en \a Alfa veces su ancho, como en OperadorCruceRealBLX.
+\param pMejor Valores del padre con mejor funcin de evaluacin.
+\param pPeor Valores del padre con peor funcin de evaluacin.
+\param pHijo Arreglo en el que se escriben los valores del hijo.
+\param dimension Nmero de valores.
+\param hijo Nmero del hijo que se est creando.*/
+void OperadorCruceVectorRealBLX::cruzarVector(const double *pMejor, const double *pPeor, double *pHijo, int dimension, int hijo)
+{
+	__llenarAzar(pHijo, dimension);
+	for(int i=0; i<dimension; i++)
+	{
+		double menor = pMejor[i] < pPeor[i] ? pMejor[i] : pPeor[i];
+		double mayor = pMejor[i] < pPeor[i] ? pPeor[i] : pMejor[i];
+		double I = mayor - menor;
+		pHijo[i] = (menor - I*m_Alfa) + pHijo[i]*I*(1.0 + 2.0*m_Alfa);
+	}
+}
+
+
+/*!Los hijos pares son \f$\lambda Mejor + (1-\lambda)Peor\f$ y los impares \f$\lambda Peor + (1-\lambda)Mejor\f$.
+\param pMejor Valores del padre con mejor funcin de evaluacin.
+\param pPeor Valores del padre con peor funcin de evaluacin.
+\param pHijo Arreglo en el que se escriben los valores del hijo.
+\param dimension Nmero de valores.
+\param hijo Nmero del hijo que se est creando.*/
+void OperadorCruceVectorRealAritmetico::cruzarVector(const double *pMejor, const double *pPeor, double *pHijo, int dimension, int hijo)
+{
+	double lambda = (hijo%2 == 0) ? m_Lambda : 1.0 - m_Lambda;
+	for(int i=0; i<dimension; i++)
+		pHijo[i] = lambda*pMejor[i] + (1.0 - lambda)*pPeor[i];
+}
+
+
+#endif
@@ -0,0 +1,523 @@
+#ifndef __GENVECTOR_H
+#define __GENVECTOR_H
+
+#include "genarreglo.h"
+
+#pragma warning(push, 3)	//Evita  "warning(level 4) C4100" ocasionada por parmetros de funciones no referenciados
+
+class OperadorMutacionVectorRealPolinomial;
+class OperadorCruceVectorRealSBX;
+
+
+/************************************************************
+                   LMITES DE UN VECTOR REAL
+************************************************************/
+
+//!Lmites de cada dimensin de un GenVectorReal, compartidos por todas sus copias
+/*!Los lmites no cambian durante la optimizacin, por lo que las copias de un gen
+no los copian sino que cuentan cuntas lo usan. El ltimo gen que lo deja de usar lo destruye.*/
+class LimitesVectorReal
+{
+public:
+	//!Crea lmites para \a dimension dimensiones, con una sola referencia
+	LimitesVectorReal(int dimension):m_referencias(1)
+	{
+		m_pMinimos = new double[2*dimension];
+		m_pMaximos = m_pMinimos + dimension;
+	}
+
+	//!Destructor
+	~LimitesVectorReal()
+	{
+		delete [] m_pMinimos;
+	}
+
+	//!Valor mnimo de cada dimensin
+	double *m_pMinimos;
+	//!Valor mximo de cada dimensin. Est en el mismo bloque de \a m_pMinimos
+	double *m_pMaximos;
+
+	//!Nmero de genes que usan los lmites
+#if defined(UN_CPP11)
+	std::atomic<int> m_referencias;
+#else
+	int m_referencias;
+#endif
+};
+
+
+/************************************************************
+                      GEN VECTOR REAL
+************************************************************/
+
+//!Clase derivada de la clase Gen especializada en un vector de reales de dimensin fija
+/*!Se utiliza para representar variables que son vectores de nmeros reales, como los
+parmetros de una funcin de muchas variables. A diferencia de GenArregloReal, su tamao
+no cambia durante la optimizacin y cada dimensin puede tener sus propios lmites.
+
+Los valores se almacenan en un solo bloque contiguo de memoria, y los lmites se comparten
+entre todas las copias del gen (Ver LimitesVectorReal), de modo que copiar el gen solo copia
+los valores. Sus operadores procesan el vector completo en ciclos sobre datos contiguos,
+que el compilador puede vectorizar, y el gen se decodifica sin copias en una VistaArregloReal.*/
+class GenVectorReal:public Gen
+{
+public:
+	//!Constructor con los mismos lmites para todas las dimensiones
+	GenVectorReal(int Dimension=1, double Min=0.0, double Max=1.0);
+
+	//!Constructor con los mismos lmites y el mismo valor inicial para todas las dimensiones
+	GenVectorReal(int Dimension, double Min, double Max, double ValorInicial);
+
+	//!Constructor con lmites propios para cada dimensin
+	GenVectorReal(int Dimension, const double *pMinimos, const double *pMaximos);
+
+	//!Constructor por copia. Comparte los lmites de \a origen
+	GenVectorReal(const GenVectorReal& origen);
+
+	//!Destructor
+	~GenVectorReal();
+
+	//!Crea una copia exacta del gen
+	/*!
+	\return Apuntador a un nuevo objeto GenVectorReal idntico al actual.*/
+	Gen *crearCopia() const
+	{
+		return (new GenVectorReal(*this));
+	}
+
+	//!Asigna nuevos valores al gen copiando las propiedades de otro gen
+	/*!
+	\param origen Objeto del que se hace copia*/
+	void copiar(const Gen& origen)
+	{
+		operator=(*((const GenVectorReal*)(&origen)));
+	}
+
+	//!Operador de asignacin a partir de otro objeto GenVectorReal
+	const GenVectorReal& operator = (const GenVectorReal& origen);
+
+	//!Operador de asignacin a partir de un objeto ArregloReal
+	const GenVectorReal& operator = (const ArregloReal& origen);
+
+	//!Operador de asignacin a partir de un objeto VistaArregloReal
+	const GenVectorReal& operator = (const VistaArregloReal& origen);
+
+	//!Decodifica el gen copiando sus valores en un objeto ArregloReal
+	void decodificar(ArregloReal &destino) const;
+
+	//!Decodifica el gen haciendo que \a destino apunte a sus valores, sin copiarlos
+	/*!La vista es vlida mientras el gen no sea destruido.
+	\param destino Referencia a la vista destino*/
+	void decodificar(VistaArregloReal &destino) const
+	{
+		destino.asignar(m_pValores, m_Dimension);
+	}
+
+	//!Retorna la distancia promedio entre los valores de dos vectores, relativa al rango de cada dimensin
+	double distancia(const Gen& otro) const;
+
+	//!El gen se representa con un valor por cada dimensin
+	int numValores() const
+	{
+		return m_Dimension;
+	}
+
+	//!Escribe los valores del vector
+	void getValores(double *pDestino) const
+	{
+		for(int i=0; i<m_Dimension; i++)
+			pDestino[i] = m_pValores[i];
+	}
+
+	//!Asigna al vector los primeros valores de \a pOrigen. Su dimensin no cambia
+	void setValores(const double *pOrigen, int numValores);
+
+	//!Genera un valor aleatorio para cada dimensin, dentro de sus lmites
+	void generarAleatorio();
+
+	//!Retorna un objeto correspondiente al operador de mutacin establecido por defecto para vectores reales
+	OperadorMutacion *operadorMutacionDefecto() const;
+
+	//!Retorna un objeto correspondiente al operador de cruce establecido por defecto para vectores reales
+	OperadorCruce *operadorCruceDefecto() const;
+
+	//!Tipo del operador de mutacin por defecto para vectores reales
+	typedef OperadorMutacionVectorRealPolinomial TipoOperadorMutacionDefecto;
+
+	//!Tipo del operador de cruce por defecto para vectores reales
+	typedef OperadorCruceVectorRealSBX TipoOperadorCruceDefecto;
+
+	//!Retorna el nmero de dimensiones del vector
+	int getDimension() const
+	{
+		return m_Dimension;
+	}
+
+	//!Retorna el valor de la dimensin \a pos
+	/*!\param pos Posicin dentro del vector. Se restringe al rango de posiciones vlidas.*/
+	double getVal(int pos) const
+	{
+		return m_pValores[ restringir(pos, 0, m_Dimension-1) ];
+	}
+
+	//!Asigna un nuevo valor a la dimensin \a pos
+	bool setVal(int pos, double valor);
+
+	//!Retorna un apuntador al bloque contiguo de valores del vector
+	const double* getDatos() const
+	{
+		return m_pValores;
+	}
+
+	//!Retorna un apuntador a los valores del vector para modificarlos directamente
+	/*!Lo usan los operadores, que deben invocar \a restringirValores() si los valores asignados
+	pueden salir de los lmites.*/
+	double* getDatosModificables()
+	{
+		return m_pValores;
+	}
+
+	//!Restringe todos los valores a los lmites de su dimensin
+	void restringirValores();
+
+	//!Retorna el valor mnimo de la dimensin \a pos
+	double getMin(int pos) const
+	{
+		return m_pLimites->m_pMinimos[pos];
+	}
+
+	//!Retorna el valor mximo de la dimensin \a pos
+	double getMax(int pos) const
+	{
+		return m_pLimites->m_pMaximos[pos];
+	}
+
+	//!Retorna los valores mnimos de todas las dimensiones
+	const double* getMinimos() const
+	{
+		return m_pLimites->m_pMinimos;
+	}
+
+	//!Retorna los valores mximos de todas las dimensiones
+	const double* getMaximos() const
+	{
+		return m_pLimites->m_pMaximos;
+	}
+
+protected:
+	//!Crea el bloque de valores y los lmites para \a Dimension dimensiones
+	void crear(int Dimension);
+
+	//!Deja de usar los lmites, destruyndolos si ningn otro gen los usa
+	void soltarLimites();
+
+	//!Nmero de dimensiones del vector. Solo puede modificarse en el constructor
+	int m_Dimension;
+
+	//!Bloque contiguo con los valores del vector
+	double *m_pValores;
+
+	//!Lmites de cada dimensin, compartidos con las copias del gen
+	LimitesVectorReal *m_pLimites;
+};
+
+
+/******************************************************************
+                     Operadores de Mutacin
+******************************************************************/
+
+//!Clase abstracta derivada de la clase OperadorMutacion empleada en genes de tipo GenVectorReal
+/*!La probabilidad de mutacin se aplica a cada dimensin del vector por separado: \a mutarGen()
+elige las dimensiones que mutan y las clases derivadas solo definen el nuevo valor de cada una
+en \a mutarValor(). Al final, los valores del vector se restringen a sus lmites en un solo ciclo.*/
+class OperadorMutacionVectorReal:public OperadorMutacion
+{
+public:
+	//!Constructor
+	/*!\param ProbabilidadMutacion Probabilidad de mutacin de cada dimensin. Por defecto es 0.1.*/
+	OperadorMutacionVectorReal(double ProbabilidadMutacion=0.1):OperadorMutacion(ProbabilidadMutacion)
+	{
+		m_PrimeraMutacion = -1.0;
+	}
+
+	//!Destructor
+	virtual ~OperadorMutacionVectorReal(){}
+
+	//!Sin conocer el gen no puede decidirse si algo muta, por lo que siempre retorna \a true (Ver \a decidirMutacionGen())
+	bool decidirMutacion()
+	{
+		return true;
+	}
+
+	//!Decide si muta alguna dimensin del vector
+	bool decidirMutacionGen(const Gen *pGen);
+
+	//!La mutacin no se decide con un solo nmero aleatorio
+	bool decisionSimple() const
+	{
+		return false;
+	}
+
+	//!Somete cada dimensin del vector a la mutacin, con la probabilidad de mutacin del operador
+	void mutarGen(Gen *pGen);
+
+	//!Calcula el nuevo valor de una dimensin que muta
+	/*!Debe sobrecargarse en las clases derivadas. No es necesario restringir el resultado.
+	\param valor Valor actual de la dimensin.
+	\param Min Valor mnimo de la dimensin.
+	\param Max Valor mximo de la dimensin.
+	\return Nuevo valor de la dimensin.*/
+	virtual double mutarValor(double valor, double Min, double Max)=0;
+
+protected:
+	//!Primera dimensin que muta, elegida en \a decidirMutacionGen(), o -1 si no hay una pendiente
+	double m_PrimeraMutacion;
+};
+
+
+//!Clase derivada de la clase OperadorMutacionVectorReal que efecta la mutacin polinomial
+/*!Es el operador de mutacin por defecto de GenVectorReal.*/
+class OperadorMutacionVectorRealPolinomial:public OperadorMutacionVectorReal
+{
+public:
+	//!Constructor
+	/*!\param ProbabilidadMutacion Probabilidad de mutacin de cada dimensin. Por defecto es 0.1.
+	\param Eta ndice de distribucin. Los valores grandes producen mutaciones pequeas. Por defecto es 20.*/
+	OperadorMutacionVectorRealPolinomial(double ProbabilidadMutacion=0.1, double Eta=20.0):OperadorMutacionVectorReal(ProbabilidadMutacion)
+	{
+		setEta(Eta);
+	}
+	//!Cambia el valor del parmetro \a Eta. No puede ser negativo
+	void setEta(double Eta)
+	{
+		m_Eta = _MAXIMO(Eta, 0.0);
+	}
+	//!Retorna el valor del parmetro \a Eta
+	double getEta() const
+	{
+		return m_Eta;
+	}
+	//!Destructor
+	~OperadorMutacionVectorRealPolinomial(){}
+	//!Calcula el valor mutado de una dimensin
+	double mutarValor(double valor, double Min, double Max);
+private:
+	//!ndice de distribucin de la mutacin
+	double m_Eta;
+};
+
+
+//!Clase derivada de la clase OperadorMutacionVectorReal que efecta la mutacin gaussiana
+/*!Cada dimensin que muta se desplaza con una distribucin normal de media cero, cuya
+desviacin es \a Sigma veces el rango de la dimensin, de modo que las dimensiones con
+rangos diferentes mutan en la misma proporcin.*/
+class OperadorMutacionVectorRealGaussiana:public OperadorMutacionVectorReal
+{
+public:
+	//!Constructor
+	/*!\param ProbabilidadMutacion Probabilidad de mutacin de cada dimensin. Por defecto es 0.1.
+	\param Sigma Desviacin relativa al rango de cada dimensin. Por defecto es 0.1.*/
+	OperadorMutacionVectorRealGaussiana(double ProbabilidadMutacion=0.1, double Sigma=0.1):OperadorMutacionVectorReal(ProbabilidadMutacion)
+	{
+		setSigma(Sigma);
+	}
+	//!Cambia el valor del parmetro \a Sigma. No puede ser negativo
+	void setSigma(double Sigma)
+	{
+		m_Sigma = _MAXIMO(Sigma, 0.0);
+	}
+	//!Retorna el valor del parmetro \a Sigma
+	double getSigma() const
+	{
+		return m_Sigma;
+	}
+	//!Destructor
+	~OperadorMutacionVectorRealGaussiana(){}
+	//!Calcula el valor mutado de una dimensin
+	double mutarValor(double valor, double Min, double Max);
+private:
+	//!Desviacin relativa al rango de cada dimensin
+	double m_Sigma;
+};
+
+
+/*******************************************************************
+                        Operadores de Cruce
+*******************************************************************/
+
+//!Clase abstracta derivada de la clase OperadorCruce empleada en genes de tipo GenVectorReal
+/*!Las clases derivadas calculan el vector completo de un hijo en \a cruzarVector(), o los de los
+dos hijos de una pareja en \a cruzarPareja(); la creacin de los genes hijos la realiza
+\a cruzarGenes(), y \a cruzarLote() cruza toda la poblacin en dos genes temporales que se
+reutilizan. Los hijos se restringen a los lmites de cada dimensin en un solo ciclo.*/
+class OperadorCruceVectorReal:public OperadorCruce
+{
+public:
+	//!Constructor
+	OperadorCruceVectorReal(){}
+	//!Destructor
+	virtual ~OperadorCruceVectorReal(){}
+	//!Crea los genes hijos, por parejas, con los valores calculados por \a cruzarPareja()
+	void cruzarGenes(const Gen *pMejor, const Gen *pPeor, Arreglo<Gen> *pHijos, int numHijos, int indice=-1);
+	//!Cruza dos genes guardando el resultado en un gen hijo existente
+	void cruzarEn(const GenVectorReal& Mejor, const GenVectorReal& Peor, GenVectorReal& Hijo, int hijo, int indice=-1);
+	//!Cruza dos genes guardando los dos hijos de la pareja en genes existentes
+	void cruzarParejaEn(const GenVectorReal& Mejor, const GenVectorReal& Peor, GenVectorReal& Hijo1, GenVectorReal& Hijo2);
+	//!Cruza el gen en varias parejas copiando el resultado en los genes que ya tienen los hijos
+	void cruzarLote(Individuo **ppMejores, Individuo **ppPeores, Individuo **ppHijos1, Individuo **ppHijos2, const int *pIndices, const double *pObjetivos, int numParejas, const int *pPosiciones, int numPosiciones);
+	//!Calcula los valores de un hijo a partir de los valores de los padres
+	/*!Debe sobrecargarse en las clases derivadas. No es necesario restringir el resultado.
+	\param pMejor Valores del padre con mejor funcin de evaluacin.
+	\param pPeor Valores del padre con peor funcin de evaluacin.
+	\param pHijo Arreglo en el que se escriben los valores del hijo.
+	\param dimension Nmero de valores.
+	\param hijo Nmero del hijo que se est creando.*/
+	virtual void cruzarVector(const double *pMejor, const double *pPeor, double *pHijo, int dimension, int hijo)=0;
+	//!Calcula los valores de los dos hijos de una pareja a partir de los valores de los padres
+	virtual void cruzarPareja(const double *pMejor, const double *pPeor, double *pHijo1, double *pHijo2, int dimension);
+protected:
+	//!Genes en los que se cruza cada pareja en \a cruzarLote(), pues los hijos pueden ser los mismos padres
+	GenVectorReal m_Temporal[2];
+};
+
+
+//!Clase derivada de la clase OperadorCruceVectorReal que efecta el cruce binario simulado (SBX)
+/*!Es el operador de cruce por defecto de GenVectorReal. Para cada dimensin se obtiene
+\f$\beta\f$ a partir de un nmero aleatorio \a u:
+\f[\beta = \left\{ \begin{array}{ll}
+(2u)^{\frac{1}{\eta+1}} & \textrm{si $u \le 0.5$}\\
+\left(\frac{1}{2(1-u)}\right)^{\frac{1}{\eta+1}} & \textrm{si $u > 0.5$}
+\end{array} \right. \f]
+y los dos hijos de la pareja, que comparten \f$\beta\f$ y son simtricos respecto a la media
+de los padres, son
+\f[h_1 = \frac{1}{2}\left[(1+\beta)Mejor + (1-\beta)Peor\right]\f]
+\f[h_2 = \frac{1}{2}\left[(1-\beta)Mejor + (1+\beta)Peor\right]\f]*/
+class OperadorCruceVectorRealSBX:public OperadorCruceVectorReal
+{
+public:
+	//!Constructor
+	/*!\param Eta ndice de distribucin. Los valores grandes producen hijos cercanos a los padres. Por defecto es 15.*/
+	OperadorCruceVectorRealSBX(double Eta=15.0)
+	{
+		setEta(Eta);
+	}
+	//!Cambia el valor del parmetro \a Eta. No puede ser negativo
+	void setEta(double Eta)
+	{
+		m_Eta = _MAXIMO(Eta, 0.0);
+	}
+	//!Retorna el valor del parmetro \a Eta
+	double getEta() const
+	{
+		return m_Eta;
+	}
+	//!Destructor
+	~OperadorCruceVectorRealSBX(){}
+	//!Ejecuta el cruce SBX sobre vectores reales, creando un solo hijo
+	void cruzarVector(const double *pMejor, const double *pPeor, double *pHijo, int dimension, int hijo);
+	//!Ejecuta el cruce SBX sobre vectores reales, creando los dos hijos con los mismos \f$\beta\f$
+	void cruzarPareja(const double *pMejor, const double *pPeor, double *pHijo1, double *pHijo2, int dimension);
+private:
+	//!ndice de distribucin del cruce
+	double m_Eta;
+};
+
+
+//!Clase derivada de la clase OperadorCruceVectorReal que efecta el cruce BLX - \f$\alpha\f$ en cada dimensin
+class OperadorCruceVectorRealBLX:public OperadorCruceVectorReal
+{
+public:
+	//!Constructor
+	/*!\param Alfa Establece la amplitud del intervalo de definicin. Por defecto es igual a 0.3.*/
+	OperadorCruceVectorRealBLX(double Alfa=0.3)
+	{
+		setAlfa(Alfa);
+	}
+	//!Cambia el valor del parmetro \a Alfa comprobando los lmites
+	void setAlfa(double Alfa)
+	{
+		m_Alfa = restringir(Alfa, 0.0, 1.0);
+	}
+	//!Retorna el valor del parmetro \a Alfa
+	double getAlfa() const
+	{
+		return m_Alfa;
+	}
+	//!Destructor
+	~OperadorCruceVectorRealBLX(){}
+	//!Ejecuta el cruce BLX - \f$\alpha\f$ sobre vectores reales
+	void cruzarVector(const double *pMejor, const double *pPeor, double *pHijo, int dimension, int hijo);
+private:
+	//!Establece la amplitud del intervalo de definicin
+	double m_Alfa;
+};
+
+
+//!Clase derivada de la clase OperadorCruceVectorReal que efecta el cruce aritmtico en cada dimensin
+class OperadorCruceVectorRealAritmetico:public OperadorCruceVectorReal
+{
+public:
+	//!Constructor
+	/*!\param Lambda Valor que pondera cada uno de los padres. Por defecto es igual a 0.7.*/
+	OperadorCruceVectorRealAritmetico(double Lambda=0.7)
+	{
+		setLambda(Lambda);
+	}
+	//!Cambia el valor del parmetro \a Lambda comprobando los lmites
+	void setLambda(double Lambda)
+	{
+		m_Lambda = restringir(Lambda, 0.0, 1.0);
+	}
+	//!Retorna el valor del parmetro \a Lambda
+	double getLambda() const
+	{
+		return m_Lambda;
+	}
+	//!Destructor
+	~OperadorCruceVectorRealAritmetico(){}
+	//!Ejecuta el cruce aritmtico sobre vectores reales
+	void cruzarVector(const double *pMejor, const double *pPeor, double *pHijo, int dimension, int hijo);
+private:
+	//!Parmetro que pondera cada uno de los padres
+	double m_Lambda;
+};
+
+
+/****************************************************************************/
+/*				DEFINICION DE MACROS PARA USO DE GENVECTORREAL				*/
+/****************************************************************************/
+
+//!Macro que adiciona un objeto GenVectorReal a un individuo
+/*!
+Se debe utilizar solamente en la funcin \a codificacion() de la clase derivada de
+AlgoritmoGenetico. Todas las dimensiones tienen los mismos lmites.
+
+\param pIndividuo Apuntador al individuo donde se adiciona el gen.
+\param pos Posicin en la que se adiciona el gen.
+\param var Nombre de la variable del sistema a optimizar asociada con el gen adicionado. Debe ser de tipo ArregloReal o VistaArregloReal para decodificar sin copiar los datos.
+\param dimension Nmero de dimensiones del vector.
+\param valMin Valor mnimo que puede tomar cada dimensin.
+\param valMax Valor mximo que puede tomar cada dimensin.
+\param valInicial Valor inicial que toma cada dimensin.*/
+#define ADICIONAR_GENVECTORREAL(pIndividuo, pos, var, dimension, valMin, valMax, valInicial)	\
+	__ADICIONAR_GENARREGLO(pIndividuo, pos, var, GenVectorReal, (dimension, valMin, valMax, valInicial) )
+
+
+//!Macro que adiciona un objeto GenVectorReal con lmites propios para cada dimensin a un individuo
+/*!
+Se debe utilizar solamente en la funcin \a codificacion() de la clase derivada de
+AlgoritmoGenetico. El valor inicial de cada dimensin es el punto medio de sus lmites.
+
+\param pIndividuo Apuntador al individuo donde se adiciona el gen.
+\param pos Posicin en la que se adiciona el gen.
+\param var Nombre de la variable del sistema a optimizar asociada con el gen adicionado. Debe ser de tipo ArregloReal o VistaArregloReal para decodificar sin copiar los datos.
+\param dimension Nmero de dimensiones del vector.
+\param pMinimos Arreglo de \a dimension valores mnimos.
+\param pMaximos Arreglo de \a dimension valores mximos.*/
+#define ADICIONAR_GENVECTORREAL_LIMITES(pIndividuo, pos, var, dimension, pMinimos, pMaximos)	\
+	__ADICIONAR_GENARREGLO(pIndividuo, pos, var, GenVectorReal, (dimension, pMinimos, pMaximos) )
+
+
+#pragma warning(pop)
+
+#endif	//__GENVECTOR_H
@@ -0,0 +1,347 @@
+#include "islas.h"
+
+
+#if defined(UN_CPP11) && defined(UN_PROCESOS)
+
+/************************************************************
+           MEMORIA COMPARTIDA DE LAS ISLAS (Implementacin)
+************************************************************/
+
+//los contadores del segmento se usan desde varios procesos, lo que solo es vlido si no usan candados
+static_assert(ATOMIC_LONG_LOCK_FREE == 2, "MemoriaIslas requiere operaciones atomicas sin candados");
+
+MemoriaIslas::MemoriaIslas()
+{
+	m_pSegmento = NULL;
+	m_tamSegmento = 0;
+	m_pCabecera = NULL;
+	m_pNombre = NULL;
+	m_pConteos = NULL;
+	m_pProcesos = NULL;
+	m_numProcesos = 0;
+}
+
+
+MemoriaIslas::~MemoriaIslas()
+{
+	cerrar();
+	delete[] m_pProcesos;
+}
+
+
+/*!Si ya exista un segmento con el mismo nombre, se remplaza.
+\param nombre Nombre del segmento, de la forma \c "/nombre".
+\param numIslas Nmero de islas.
+\param numRanuras Nmero de ranuras del anillo de cada isla. Debe ser al menos el nmero de migrantes de cada migracin.
+\param maxGenes Mximo nmero de genes de un individuo.
+\param maxValores Mximo nmero de valores de un individuo (Ver Individuo::numValores()).
+\return true si el segmento se pudo crear.*/
+bool MemoriaIslas::crear(const char *nombre, int numIslas, int numRanuras, int maxGenes, int maxValores)
+{
+	cerrar();
+	if(numIslas < 1 || numRanuras < 1 || maxGenes < 0 || maxValores < 0)
+		return false;
+
+	int tamRanura = sizeof(Ranura) + maxGenes*sizeof(int);
+	tamRanura = (tamRanura + sizeof(double)-1) / sizeof(double) * sizeof(double);
+	tamRanura += maxValores*sizeof(double);
+	tamRanura = (tamRanura + TAM_LINEA-1) / TAM_LINEA * TAM_LINEA;
+	size_t tam = (size_t)TAM_LINEA*(1+numIslas) + (size_t)tamRanura*numIslas*numRanuras;
+
+	shm_unlink(nombre);
+	int fd = shm_open(nombre, O_CREAT | O_EXCL | O_RDWR, 0600);
+	if(fd < 0)
+		return false;
+	if(ftruncate(fd, tam) != 0 || !proyectar(fd, tam))
+	{
+		close(fd);
+		shm_unlink(nombre);
+		return false;
+	}
+	close(fd);
+
+	m_pCabecera->numIslas = numIslas;
+	m_pCabecera->numRanuras = numRanuras;
+	m_pCabecera->maxGenes = maxGenes;
+	m_pCabecera->maxValores = maxValores;
+	m_pCabecera->tamRanura = tamRanura;
+	for(int i=0; i<numIslas; i++)
+	{
+		new(anillo(i)) std::atomic<unsigned long>(0);
+		for(int j=0; j<numRanuras; j++)
+			new(&ranura(i, j)->secuencia) std::atomic<unsigned long>(0);
+	}
+
+	m_pNombre = new char[strlen(nombre)+1];
+	strcpy(m_pNombre, nombre);
+	m_pConteos = new int[maxGenes>0 ? maxGenes : 1];
+	return true;
+}
+
+
+/*!\param nombre Nombre con el que se cre el segmento.
+\return true si el segmento se pudo abrir.*/
+bool MemoriaIslas::abrir(const char *nombre)
+{
+	cerrar();
+	int fd = shm_open(nombre, O_RDWR, 0);
+	if(fd < 0)
+		return false;
+	struct stat estado;
+	if(fstat(fd, &estado) != 0 || (size_t)estado.st_size < sizeof(Cabecera) || !proyectar(fd, estado.st_size))
+	{
+		close(fd);
+		return false;
+	}
+	close(fd);
+
+	m_pNombre = new char[strlen(nombre)+1];
+	strcpy(m_pNombre, nombre);
+	m_pConteos = new int[m_pCabecera->maxGenes>0 ? m_pCabecera->maxGenes : 1];
+	return true;
+}
+
+
+/*!El segmento sigue existiendo para los dems procesos hasta que se invoque \a eliminar().*/
+void MemoriaIslas::cerrar()
+{
+	if(m_pSegmento)
+		munmap(m_pSegmento, m_tamSegmento);
+	m_pSegmento = NULL;
+	m_tamSegmento = 0;
+	m_pCabecera = NULL;
+	delete[] m_pNombre;
+	m_pNombre = NULL;
+	delete[] m_pConteos;
+	m_pConteos = NULL;
+}
+
+
+/*!Los procesos que ya lo tienen abierto pueden seguir usndolo.*/
+void MemoriaIslas::eliminar()
+{
+	if(m_pNombre)
+		shm_unlink(m_pNombre);
+}
+
+
+/*!\param fd Descriptor del segmento.
+\param tam Tamao del segmento.
+\return true si se pudo proyectar.*/
+bool MemoriaIslas::proyectar(int fd, size_t tam)
+{
+	void *p = mmap(NULL, tam, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if(p == MAP_FAILED)
+		return false;
+	m_pSegmento = (char*)p;
+	m_tamSegmento = tam;
+	m_pCabecera = (Cabecera*)m_pSegmento;
+	return true;
+}
+
+
+/*!\param isla Nmero de la isla.
+\param pos Posicin en el anillo, contada desde la creacin del segmento.*/
+MemoriaIslas::Ranura* MemoriaIslas::ranura(int isla, unsigned long pos) const
+{
+	const Cabecera &c = *m_pCabecera;
+	size_t indice = (size_t)isla*c.numRanuras + (size_t)(pos % c.numRanuras);
+	return (Ranura*)(m_pSegmento + TAM_LINEA*(1+c.numIslas) + indice*c.tamRanura);
+}
+
+
+/*!Cada proceso hijo hereda el segmento y recibe un nmero de isla distinto. Debe usarse antes de
+crear los algoritmos, para que cada isla tenga los suyos.
+Si no se puede crear alguno de los procesos, se terminan los que ya se haban lanzado, de modo
+que no quedan islas sin vecinos esperando migrantes.
+\param pPrioridades Arreglo opcional con el incremento de \c nice de cada isla.
+\return Nmero de la isla que corresponde al proceso que retorna: 0 en el proceso original,
+o -1 si no se pudieron lanzar todas las islas.*/
+int MemoriaIslas::lanzarProcesos(const int *pPrioridades)
+{
+	int numIslas = getNumIslas();
+	delete[] m_pProcesos;
+	m_pProcesos = new pid_t[numIslas];
+	m_numProcesos = 0;
+
+	int isla = 0;
+	for(int i=1; i<numIslas; i++)
+	{
+		pid_t pid = fork();
+		if(pid == 0)
+		{
+			delete[] m_pProcesos;
+			m_pProcesos = NULL;
+			m_numProcesos = 0;
+			isla = i;
+			break;
+		}
+		if(pid < 0)
+		{
+			for(int j=0; j<m_numProcesos; j++)
+				kill(m_pProcesos[j], SIGKILL);
+			esperarProcesos();
+			return -1;
+		}
+		m_pProcesos[m_numProcesos++] = pid;
+	}
+	if(pPrioridades && pPrioridades[isla] != 0)
+		setpriority(PRIO_PROCESS, 0, getpriority(PRIO_PROCESS, 0) + pPrioridades[isla]);
+	return isla;
+}
+
+
+/*!\return Nmero de islas que no terminaron normalmente, por ejemplo por una falla en la funcin objetivo.*/
+int MemoriaIslas::esperarProcesos()
+{
+	int fallas = 0;
+	for(int i=0; i<m_numProcesos; i++)
+	{
+		int estado;
+		while(waitpid(m_pProcesos[i], &estado, 0) < 0)
+		{
+			if(errno != EINTR)
+			{
+				estado = -1;
+				break;
+			}
+		}
+		if(!WIFEXITED(estado) || WEXITSTATUS(estado) != 0)
+			fallas++;
+	}
+	m_numProcesos = 0;
+	return fallas;
+}
+
+
+/*!Solo la isla duea del anillo debe escribir en l.
+\param isla Nmero de la isla que publica.
+\param ind Individuo a publicar.
+\return false si el individuo excede el tamao de las ranuras.*/
+bool MemoriaIslas::publicar(int isla, Individuo &ind)
+{
+	const Cabecera &c = *m_pCabecera;
+	int numGenes = ind.getTamGenoma();
+	int numValores = ind.numValores();
+	if(numGenes > c.maxGenes || numValores > c.maxValores)
+		return false;
+
+	std::atomic<unsigned long> &publicados = *anillo(isla);
+	unsigned long pos = publicados.load(std::memory_order_relaxed);
+	Ranura *pRanura = ranura(isla, pos);
+	int *pConteos = (int*)(pRanura+1);
+	double *pValores = (double*)((char*)pRanura + c.tamRanura) - c.maxValores;
+
+	unsigned long secuencia = pRanura->secuencia.load(std::memory_order_relaxed);
+	pRanura->secuencia.store(secuencia+1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	pRanura->objetivo = ind.objetivo();
+	pRanura->numGenes = numGenes;
+	pRanura->numValores = numValores;
+	for(int i=0; i<numGenes; i++)
+		pConteos[i] = ind.getGen(i).numValores();
+	ind.getValores(pValores);
+
+	pRanura->secuencia.store(secuencia+2, std::memory_order_release);
+	publicados.store(pos+1, std::memory_order_release);
+	return true;
+}
+
+
+/*!Los genes se leen directamente de la ranura. Si la ranura se estaba escribiendo, o ya fue
+sobrescrita por un individuo ms reciente, \a destino no cambia.
+\param isla Nmero de la isla que public el individuo.
+\param pos Posicin en el anillo, entre \a getPublicados()-getNumRanuras() y \a getPublicados()-1.
+\param destino Individuo que recibe los genes y la funcin objetivo. Debe tener la misma estructura de genoma.
+\return true si la lectura fue vlida.*/
+bool MemoriaIslas::leer(int isla, unsigned long pos, Individuo &destino)
+{
+	const Cabecera &c = *m_pCabecera;
+	unsigned long publicados = getPublicados(isla);
+	if(pos >= publicados || publicados - pos > (unsigned long)c.numRanuras)
+		return false;
+
+	Ranura *pRanura = ranura(isla, pos);
+	const int *pConteos = (const int*)(pRanura+1);
+	const double *pValores = (const double*)((const char*)pRanura + c.tamRanura) - c.maxValores;
+
+	unsigned long secuencia = pRanura->secuencia.load(std::memory_order_acquire);
+	if(secuencia & 1)
+		return false;
+
+	//los conteos se copian y se validan, pues la ranura podra estar cambiando
+	int numGenes = pRanura->numGenes;
+	if(numGenes != destino.getTamGenoma() || numGenes > c.maxGenes)
+		return false;
+	int total = 0;
+	for(int i=0; i<numGenes; i++)
+	{
+		m_pConteos[i] = pConteos[i];
+		if(m_pConteos[i] < 0)
+			return false;
+		total += m_pConteos[i];
+	}
+	if(total > c.maxValores)
+		return false;
+
+	Individuo respaldo(destino);
+	destino.setValores(pValores, m_pConteos);
+	double objetivo = pRanura->objetivo;
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if(pRanura->secuencia.load(std::memory_order_relaxed) != secuencia ||
+	   getPublicados(isla) - pos > (unsigned long)c.numRanuras)
+	{
+		destino = respaldo;
+		return false;
+	}
+	destino.asignarObjetivo(objetivo);
+	return true;
+}
+
+
+/************************************************************
+            OPERADOR DE MIGRACIN (Implementacin)
+************************************************************/
+
+/*!\param pMemoria Segmento compartido por las islas, ya creado o abierto.
+\param isla Nmero de esta isla.
+\param intervalo Nmero de generaciones entre migraciones.
+\param numMigrantes Mximo nmero de individuos recibidos en cada migracin.*/
+OperadorAdaptacionMigracion::OperadorAdaptacionMigracion(MemoriaIslas *pMemoria, int isla, int intervalo, int numMigrantes)
+{
+	m_pMemoria = pMemoria;
+	m_Isla = isla;
+	m_Intervalo = intervalo>0 ? intervalo : 1;
+	m_NumMigrantes = numMigrantes>0 ? numMigrantes : 1;
+	m_Leidos = 0;
+}
+
+
+/*!Cada migrante remplaza al peor individuo de la poblacin en ese momento.
+\param pAG Apuntador al algoritmo gentico de la isla.*/
+void OperadorAdaptacionMigracion::adaptacion(AlgoritmoGenetico *pAG)
+{
+	if(pAG->m_Generacion % m_Intervalo != 0)
+		return;
+
+	m_pMemoria->publicar(m_Isla, *pAG->m_pMejorEnLaHistoria);
+
+	int numIslas = m_pMemoria->getNumIslas();
+	if(numIslas < 2)
+		return;
+	int origen = (m_Isla + numIslas - 1) % numIslas;
+	unsigned long publicados = m_pMemoria->getPublicados(origen);
+	if(publicados - m_Leidos > (unsigned long)m_NumMigrantes)
+		m_Leidos = publicados - m_NumMigrantes;
+
+	Poblacion &Pob = *pAG->m_pPoblacionActual;
+	for(; m_Leidos < publicados; m_Leidos++)
+	{
+		int posPeor = Pob.getPosPeor(pAG->m_IndicadorMaximizar);
+		m_pMemoria->leer(origen, m_Leidos, Pob.getIndividuoDirecto(posPeor));
+	}
+}
+
+#endif
@@ -0,0 +1,175 @@
+#ifndef __ISLAS_H
+#define __ISLAS_H
+
+#include "evaluador.h"
+
+#if defined(UN_CPP11) && defined(UN_PROCESOS)
+
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/resource.h>
+
+
+/************************************************************
+             MODELO DE ISLAS EN VARIOS PROCESOS
+************************************************************/
+
+//!Segmento de memoria compartida por donde se intercambian migrantes las islas de un modelo de islas
+/*!Cada isla es un proceso distinto con su propio algoritmo gentico, de modo que una falla en
+la funcin objetivo de una isla no afecta a las dems, y cada una tiene su propia memoria.
+El segmento se crea con \c shm_open() y contiene, por cada isla, un anillo de \a numRanuras ranuras
+de tamao fijo donde la isla publica sus mejores individuos, serializados como los valores de sus
+genes (Ver Gen::getValores()).
+
+Cada anillo tiene un solo escritor, la isla duea, y se lee sin bloqueos: cada ranura tiene un
+contador de secuencia que es impar mientras se escribe, y el lector descarta las lecturas en las
+que el contador cambi. Los valores se escriben y se leen directamente en el segmento, sin copias
+intermedias.
+
+Las islas pueden lanzarse con \a lanzarProcesos() desde el proceso que crea el segmento, o ser
+programas independientes que lo abren con \a abrir(), por ejemplo para ejecutarlas con distinta
+prioridad o en distintos grupos de control (cgroups).
+En equipos con varios nodos NUMA, cada isla puede fijarse a un nodo con AlgoritmoGenetico::m_NodoNUMA
+(por ejemplo, el nmero de la isla), de modo que su poblacin queda en la memoria de ese nodo.
+La migracin la realiza OperadorAdaptacionMigracion.
+Solo est disponible en sistemas POSIX y al compilar con C++11 o posterior.*/
+class MemoriaIslas
+{
+public:
+	//!Constructor. No crea el segmento
+	MemoriaIslas();
+
+	//!Destructor. Libera el segmento en este proceso, sin eliminarlo
+	~MemoriaIslas();
+
+	//!Crea el segmento de memoria compartida
+	bool crear(const char *nombre, int numIslas, int numRanuras, int maxGenes, int maxValores);
+
+	//!Abre un segmento creado por otro proceso con \a crear()
+	bool abrir(const char *nombre);
+
+	//!Libera el segmento en este proceso
+	void cerrar();
+
+	//!Elimina el nombre del segmento del sistema
+	void eliminar();
+
+	//!Lanza un proceso por cada isla, excepto la 0 que es el proceso actual. Retorna -1 si falla
+	int lanzarProcesos(const int *pPrioridades=NULL);
+
+	//!Espera a que terminen los procesos lanzados con \a lanzarProcesos()
+	int esperarProcesos();
+
+	//!Escribe un individuo en la siguiente ranura del anillo de la isla \a isla
+	bool publicar(int isla, Individuo &ind);
+
+	//!Asigna a \a destino el individuo publicado en la posicin \a pos del anillo de la isla \a isla
+	bool leer(int isla, unsigned long pos, Individuo &destino);
+
+	//!Retorna el nmero de individuos publicados por la isla \a isla desde que se cre el segmento
+	unsigned long getPublicados(int isla) const
+	{
+		return anillo(isla)->load(std::memory_order_acquire);
+	}
+
+	//!Retorna el nmero de islas
+	int getNumIslas() const
+	{
+		return m_pCabecera ? m_pCabecera->numIslas : 0;
+	}
+
+	//!Retorna el nmero de ranuras del anillo de cada isla
+	int getNumRanuras() const
+	{
+		return m_pCabecera ? m_pCabecera->numRanuras : 0;
+	}
+
+protected:
+	//!Datos al inicio del segmento
+	struct Cabecera
+	{
+		int numIslas;
+		int numRanuras;
+		int maxGenes;
+		int maxValores;
+		int tamRanura;
+	};
+
+	//!Parte fija de cada ranura. Le siguen \a maxGenes enteros y \a maxValores datos double
+	struct Ranura
+	{
+		//!Es impar mientras se escribe la ranura
+		std::atomic<unsigned long> secuencia;
+		//!Valor de la funcin objetivo del individuo
+		double objetivo;
+		//!Nmero de genes del individuo
+		int numGenes;
+		//!Nmero de valores de todos los genes
+		int numValores;
+	};
+
+	enum { TAM_LINEA = 64 };
+
+	//!Retorna el contador de individuos publicados por la isla \a isla
+	std::atomic<unsigned long>* anillo(int isla) const
+	{
+		return (std::atomic<unsigned long>*)(m_pSegmento + TAM_LINEA*(1+isla));
+	}
+
+	//!Retorna la ranura \a pos del anillo de la isla \a isla
+	Ranura* ranura(int isla, unsigned long pos) const;
+
+	//!Proyecta el segmento en la memoria del proceso
+	bool proyectar(int fd, size_t tam);
+
+	//!Segmento proyectado
+	char *m_pSegmento;
+	//!Tamao del segmento
+	size_t m_tamSegmento;
+	//!Cabecera del segmento
+	Cabecera *m_pCabecera;
+	//!Nombre del segmento
+	char *m_pNombre;
+	//!Copia local del nmero de valores de cada gen de la ranura que se lee
+	int *m_pConteos;
+	//!Procesos lanzados con \a lanzarProcesos()
+	pid_t *m_pProcesos;
+	//!Nmero de procesos lanzados
+	int m_numProcesos;
+};
+
+
+//!Clase derivada de OperadorAdaptacion que intercambia individuos con otras islas a travs de MemoriaIslas
+/*!Cada \a intervalo generaciones, publica el mejor individuo de la historia de la isla en su anillo,
+y remplaza a los peores individuos de la poblacin con los ms recientes publicados por la isla
+anterior (las islas forman un anillo: la isla \a i recibe de la isla \a i-1).
+Un individuo recibido conserva la funcin objetivo calculada en la isla de origen.*/
+class OperadorAdaptacionMigracion:public OperadorAdaptacion
+{
+public:
+	//!Constructor
+	OperadorAdaptacionMigracion(MemoriaIslas *pMemoria, int isla, int intervalo=10, int numMigrantes=1);
+
+	//!Destructor
+	~OperadorAdaptacionMigracion(){}
+
+	//!Publica el mejor individuo y recibe los migrantes de la isla anterior
+	void adaptacion(AlgoritmoGenetico *pAG);
+
+protected:
+	//!Segmento compartido por las islas. No pertenece al operador
+	MemoriaIslas *m_pMemoria;
+	//!Nmero de esta isla
+	int m_Isla;
+	//!Nmero de generaciones entre migraciones
+	int m_Intervalo;
+	//!Mximo nmero de individuos recibidos en cada migracin
+	int m_NumMigrantes;
+	//!Nmero de individuos de la isla anterior que ya se leyeron
+	unsigned long m_Leidos;
+};
+
+#endif
+
+#endif
@@ -0,0 +1,249 @@
+#include "memoria.h"
+
+
+/************************************************************
+                MEMORIA DEL ALGORITMO (Implementacin)
+************************************************************/
+
+UN_HILO_LOCAL MemoriaAG* MemoriaAG::s_pActiva = NULL;
+#if defined(UN_CPP11)
+std::atomic<unsigned long> MemoriaAG::s_ultimoId(0);
+#else
+unsigned long MemoriaAG::s_ultimoId = 0;
+#endif
+UN_HILO_LOCAL MemoriaAG::Cache MemoriaAG::s_cache;
+
+
+/*!Crea una memoria vaca. Las pginas se piden al sistema a medida que se necesitan.*/
+MemoriaAG::MemoriaAG()
+{
+	m_id = ++s_ultimoId;
+	m_pPaginas = NULL;
+	m_pSiguiente = m_pFin = NULL;
+	for(int i=0; i<NUM_CLASES; i++)
+		m_compartidos[i] = NULL;
+	m_liberarPendiente = false;
+	m_huerfana = false;
+	m_vivos = 0;
+}
+
+
+/*!Devuelve al sistema todas las pginas.*/
+MemoriaAG::~MemoriaAG()
+{
+	if(s_pActiva == this)
+		s_pActiva = NULL;
+	liberarPaginas();
+}
+
+
+/*!Si hay una memoria activa y el tamao cabe en alguna clase de tamao, el bloque
+se toma de ella; de lo contrario se crea con \a malloc.
+\param tam Tamao del objeto en bytes.
+\return Apuntador a la zona donde se construir el objeto, o NULL si no hay memoria suficiente.*/
+void* MemoriaAG::reservar(size_t tam)
+{
+	int clase = tam==0 ? 0 : (int)((tam-1)/GRANULO);
+	if(s_pActiva && clase<NUM_CLASES)
+		return s_pActiva->tomar(clase);
+
+	Cabecera *pCab = (Cabecera*)malloc(sizeof(Cabecera) + tam);
+	if(!pCab)
+		return NULL;
+	pCab->info.pMemoria = NULL;
+	pCab->info.clase = -1;
+	return pCab+1;
+}
+
+
+/*!El bloque vuelve a la memoria que lo cre, aunque sta ya no sea la memoria activa.
+\param p Apuntador obtenido con \a reservar(). Puede ser NULL.*/
+void MemoriaAG::liberar(void* p)
+{
+	if(!p)
+		return;
+	Cabecera *pCab = ((Cabecera*)p) - 1;
+	if(pCab->info.pMemoria)
+		pCab->info.pMemoria->devolver(pCab);
+	else
+		free(pCab);
+}
+
+
+/*!Las listas de bloques libres de cada hilo se asocian al identificador de la memoria.
+Si el hilo trabajaba con otra memoria, o si las pginas de sta fueron liberadas,
+sus listas se descartan.
+\return Cach del hilo actual*/
+inline MemoriaAG::Cache& MemoriaAG::getCache()
+{
+	if(s_cache.id != m_id)
+	{
+		s_cache.id = m_id;
+		for(int i=0; i<NUM_CLASES; i++)
+			s_cache.listas[i] = NULL;
+	}
+	return s_cache;
+}
+
+
+/*!Busca primero en la cach del hilo y luego en la memoria compartida.
+\param clase Clase de tamao del bloque.
+\return Apuntador a la zona del objeto, a continuacin de la cabecera, o NULL si no se pudo pedir una pgina al sistema.*/
+void* MemoriaAG::tomar(int clase)
+{
+	Cache &cache = getCache();
+	Cabecera *pCab;
+	if(cache.listas[clase])
+	{
+		Libre *pLibre = cache.listas[clase];
+		cache.listas[clase] = pLibre->pSiguiente;
+		pCab = (Cabecera*)pLibre;
+	}
+	else
+	{
+#if defined(UN_CPP11)
+		std::lock_guard<std::mutex> candado(m_candado);
+#endif
+		pCab = tomarCompartido(clase);
+		if(!pCab)
+			return NULL;
+	}
+	m_vivos++;
+	pCab->info.pMemoria = this;
+	pCab->info.clase = clase;
+	return pCab+1;
+}
+
+
+/*!Toma un bloque de los devueltos por otros hilos, o lo corta de la pgina actual.
+Si la pgina actual no tiene espacio, se pide una nueva al sistema.
+\param clase Clase de tamao del bloque.
+\return Cabecera del bloque, o NULL si no se pudo pedir la pgina.*/
+MemoriaAG::Cabecera* MemoriaAG::tomarCompartido(int clase)
+{
+	if(m_compartidos[clase])
+	{
+		Libre *pLibre = m_compartidos[clase];
+		m_compartidos[clase] = pLibre->pSiguiente;
+		return (Cabecera*)pLibre;
+	}
+
+	size_t tam = sizeof(Cabecera) + (clase+1)*GRANULO;
+	if(m_pSiguiente + tam > m_pFin)
+	{
+		//la pgina comienza con el enlace a la pgina anterior, ocupando una cabecera
+		Libre *pPagina = (Libre*)malloc(TAM_PAGINA);
+		if(!pPagina)
+			return (Cabecera*)NULL;
+		pPagina->pSiguiente = m_pPaginas;
+		m_pPaginas = pPagina;
+		m_pSiguiente = ((char*)pPagina) + sizeof(Cabecera);
+		m_pFin = ((char*)pPagina) + TAM_PAGINA;
+	}
+	Cabecera *pCab = (Cabecera*)m_pSiguiente;
+	m_pSiguiente += tam;
+	return pCab;
+}
+
+
+/*!Si la cach del hilo pertenece a esta memoria, el bloque se adiciona a ella sin bloquear;
+de lo contrario se adiciona a la lista compartida.
+Cuando se destruye el ltimo bloque vivo, se completa una liberacin aplazada.
+El ltimo bloque se descuenta con el candado, de modo que esa decisin no compite con
+\a liberarTodo() ni con \a soltar(), que la toman con el mismo candado.
+\param pCab Cabecera del bloque.*/
+void MemoriaAG::devolver(Cabecera* pCab)
+{
+	int clase = pCab->info.clase;
+	Libre *pLibre = (Libre*)pCab;
+	bool enCache = s_cache.id == m_id;
+	if(enCache)
+	{
+		pLibre->pSiguiente = s_cache.listas[clase];
+		s_cache.listas[clase] = pLibre;
+#if defined(UN_CPP11)
+		long vivos = m_vivos.load(std::memory_order_relaxed);
+		while(vivos > 1)
+			if(m_vivos.compare_exchange_weak(vivos, vivos-1))
+				return;
+#endif
+	}
+
+	bool destruir = false;
+	{
+#if defined(UN_CPP11)
+		std::lock_guard<std::mutex> candado(m_candado);
+#endif
+		if(!enCache)
+		{
+			pLibre->pSiguiente = m_compartidos[clase];
+			m_compartidos[clase] = pLibre;
+		}
+		if(--m_vivos == 0)
+		{
+			if(m_huerfana)
+				destruir = true;
+			else if(m_liberarPendiente)
+			{
+				m_liberarPendiente = false;
+				liberarPaginas();
+			}
+		}
+	}
+	//despus de liberar el candado, el objeto ya no se usa
+	if(destruir)
+		delete this;
+}
+
+
+/*!Es invocada por AlgoritmoGenetico::finalizarOptimizacion(). No debe invocarse
+mientras otros hilos estn creando objetos con esta memoria.*/
+void MemoriaAG::liberarTodo()
+{
+#if defined(UN_CPP11)
+	std::lock_guard<std::mutex> candado(m_candado);
+#endif
+	if(m_vivos > 0)
+	{
+		m_liberarPendiente = true;
+		return;
+	}
+	m_liberarPendiente = false;
+	liberarPaginas();
+}
+
+
+/*!Es invocada por el destructor de AlgoritmoGenetico. La memoria se destruye de inmediato
+si no quedan bloques vivos, o cuando se destruya el ltimo de ellos.*/
+void MemoriaAG::soltar()
+{
+	if(s_pActiva == this)
+		s_pActiva = NULL;
+	bool destruir;
+	{
+#if defined(UN_CPP11)
+		std::lock_guard<std::mutex> candado(m_candado);
+#endif
+		destruir = m_vivos == 0;
+		m_huerfana = !destruir;
+	}
+	if(destruir)
+		delete this;
+}
+
+
+/*!Cambia el identificador de la memoria para que las cachs de todos los hilos
+queden invalidadas.*/
+void MemoriaAG::liberarPaginas()
+{
+	while(m_pPaginas)
+	{
+		Libre *pPagina = m_pPaginas;
+		m_pPaginas = pPagina->pSiguiente;
+		free(pPagina);
+	}
+	m_pSiguiente = m_pFin = NULL;
+	for(int i=0; i<NUM_CLASES; i++)
+		m_compartidos[i] = NULL;
+	m_id = ++s_ultimoId;
+}
@@ -0,0 +1,193 @@
+#ifndef __MEMORIA_H
+#define __MEMORIA_H
+
+#include <stdlib.h>
+#include <stddef.h>
+
+//!Se define si el compilador soporta C++11. Habilita, entre otros, los constructores de movimiento
+#if !defined(UN_CPP11) && (__cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1900))
+#define UN_CPP11
+#endif
+
+//!Se define si el sistema operativo ofrece procesos, tuberas y sockets POSIX. Habilita EvaluadorProcesos, EvaluadorRed y MemoriaIslas
+#if !defined(UN_PROCESOS) && (defined(__unix__) || defined(__APPLE__))
+#define UN_PROCESOS
+#endif
+
+#if defined(UN_CPP11)
+#	include <atomic>
+#	include <mutex>
+#	define UN_HILO_LOCAL thread_local
+#else
+#	define UN_HILO_LOCAL
+#endif
+
+
+/************************************************************
+                      MEMORIA DEL ALGORITMO
+************************************************************/
+
+//!Administra la memoria de los objetos que se crean y destruyen continuamente durante la optimizacin
+/*!Cada AlgoritmoGenetico es dueo de un objeto MemoriaAG. Mientras el algoritmo est activo
+(ver \a activar()), los objetos de las clases Gen, Individuo y Arreglo se crean en bloques
+de tamao fijo tomados de pginas grandes (slabs), una por cada clase de tamao.
+Al destruirse un objeto, su bloque no vuelve al sistema sino a una lista de bloques libres
+del hilo que lo destruye, de donde se reutiliza en la siguiente creacin de un objeto
+de tamao similar. As se evitan la contencin en el \a malloc del sistema y la
+fragmentacin en ejecuciones largas.
+
+Todas las pginas se devuelven al sistema de una sola vez en \a liberarTodo(), invocada por
+AlgoritmoGenetico::finalizarOptimizacion(). Si an existen objetos vivos creados con la
+memoria del algoritmo (por ejemplo copias de individuos conservadas por el usuario), la
+liberacin se aplaza hasta que el ltimo de ellos sea destruido.
+
+Los objetos mayores que la clase de tamao ms grande, o creados cuando no hay ningn
+algoritmo activo en el hilo, se crean con \a malloc. Cada bloque lleva una cabecera que indica a qu
+memoria pertenece, de modo que puede destruirse en cualquier momento y desde cualquier hilo.*/
+class MemoriaAG
+{
+public:
+	//!Constructor
+	MemoriaAG();
+
+	//!Crea un bloque de \a tam bytes con la memoria activa, o con \a malloc si no hay ninguna
+	static void* reservar(size_t tam);
+
+	//!Devuelve un bloque creado con \a reservar() a la memoria a la que pertenece
+	static void liberar(void* p);
+
+	//!Establece la memoria en la que se crean los objetos a partir de este momento
+	/*!La memoria activa es propia de cada hilo, de modo que dos algoritmos que se ejecutan en 
+	hilos distintos no crean sus objetos en la memoria del otro. Los hilos que no activan ninguna
+	memoria crean los objetos con \a malloc.
+	\param pMemoria Memoria a activar. Con NULL los objetos se crean con \a malloc.*/
+	static void activar(MemoriaAG* pMemoria)
+	{
+		s_pActiva = pMemoria;
+	}
+
+	//!Retorna la memoria activa
+	static MemoriaAG* getActiva()
+	{
+		return s_pActiva;
+	}
+
+	//!Devuelve todas las pginas al sistema, o aplaza la operacin si hay objetos vivos
+	void liberarTodo();
+
+	//!Indica que el dueo de la memoria ya no existe
+	void soltar();
+
+	//!Retorna el nmero de bloques actualmente en uso
+	long getVivos() const
+	{
+		return m_vivos;
+	}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+	enum
+	{
+		GRANULO		= 16,			//diferencia de tamao entre clases consecutivas
+		NUM_CLASES	= 16,			//el bloque ms grande es de GRANULO*NUM_CLASES bytes
+		TAM_PAGINA	= 64*1024		//tamao de cada pgina pedida al sistema
+	};
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+private:
+	//!Destructor. Solo se invoca internamente, cuando ya no quedan bloques vivos y el dueo solt la memoria
+	~MemoriaAG();
+
+	//No se puede copiar
+	MemoriaAG(const MemoriaAG&);
+	const MemoriaAG& operator = (const MemoriaAG&);
+
+	//!Cabecera que precede a cada bloque. Su tamao conserva la alineacin del objeto
+	union Cabecera
+	{
+		struct
+		{
+			MemoriaAG *pMemoria;	//NULL si el bloque se cre con malloc
+			int clase;
+		} info;
+		double alinear[2];
+	};
+
+	//!Bloque libre, enlazado en una lista
+	struct Libre
+	{
+		Libre *pSiguiente;
+	};
+
+	//!Listas de bloques libres de un hilo, vlidas solo para la memoria con identificador \a id
+	struct Cache
+	{
+		unsigned long id;
+		Libre *listas[NUM_CLASES];
+	};
+
+	//!Toma un bloque de la clase \a clase
+	void* tomar(int clase);
+
+	//!Devuelve un bloque de la clase \a clase
+	void devolver(Cabecera* pCab);
+
+	//!Toma un bloque de la lista compartida o de la pgina actual. Requiere el candado
+	Cabecera* tomarCompartido(int clase);
+
+	//!Devuelve las pginas al sistema. Solo puede invocarse sin bloques vivos. Requiere el candado
+	void liberarPaginas();
+
+	//!Prepara la cach del hilo actual para esta memoria
+	Cache& getCache();
+
+	//!Memoria activa en el hilo actual
+	static UN_HILO_LOCAL MemoriaAG* s_pActiva;
+
+	//!Contador para generar identificadores nicos de memoria
+#if defined(UN_CPP11)
+	static std::atomic<unsigned long> s_ultimoId;
+#else
+	static unsigned long s_ultimoId;
+#endif
+
+	//!Listas de bloques libres del hilo actual
+	static UN_HILO_LOCAL Cache s_cache;
+
+	//!Identificador de las pginas actuales. Cambia cada vez que se liberan
+	unsigned long m_id;
+
+	//!Lista de pginas pedidas al sistema
+	Libre *m_pPaginas;
+
+	//!Siguiente posicin libre en la pgina actual y final de la pgina
+	char *m_pSiguiente, *m_pFin;
+
+	//!Bloques devueltos por hilos cuya cach pertenece a otra memoria
+	Libre *m_compartidos[NUM_CLASES];
+
+	//!Indica que debe liberarse todo en cuanto no queden bloques vivos. Se usa con el candado
+	bool m_liberarPendiente;
+
+	//!Indica que el dueo solt la memoria y debe destruirse en cuanto no queden bloques vivos. Se usa con el candado
+	bool m_huerfana;
+
+#if defined(UN_CPP11)
+	//!Nmero de bloques en uso
+	std::atomic<long> m_vivos;
+
+	//!Protege las pginas y las listas compartidas
+	std::mutex m_candado;
+#else
+	//!Nmero de bloques en uso
+	long m_vivos;
+#endif
+};
+
+
+//!Declara los operadores \a new y \a delete de una clase para que use la memoria del algoritmo activo
+#define USAR_MEMORIA_AG													\
+	static void* operator new(size_t tam)	{ return MemoriaAG::reservar(tam); }	\
+	static void operator delete(void* p)	{ MemoriaAG::liberar(p); }
+
+
+#endif
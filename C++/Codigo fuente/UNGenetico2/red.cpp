@@ -0,0 +1,1258 @@
+#include "red.h"
+
+
+#if defined(UN_PROCESOS)
+
+/************************************************************
+                FUNCIONES DE APOYO PARA SOCKETS
+************************************************************/
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+//Mximo nmero de genes o de valores que se acepta en un mensaje
+#define __MAXIMO_DATOS_RED (1<<24)
+
+#if defined(MSG_NOSIGNAL)
+#	define __BANDERAS_ENVIO_RED MSG_NOSIGNAL
+#else
+#	define __BANDERAS_ENVIO_RED 0
+#endif
+
+//Prepara un socket conectado: escrituras sin SIGPIPE, sin retraso de Nagle, y cerrado al lanzar otros programas
+static void __prepararSocketRed(int fd)
+{
+	int si = 1;
+	fcntl(fd, F_SETFD, FD_CLOEXEC);
+	setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &si, sizeof(si));
+#if defined(SO_NOSIGPIPE)
+	setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &si, sizeof(si));
+#endif
+}
+
+//Abre un socket en la direccin "unix:/ruta" o "equipo:puerto". Si escuchar es true espera conexiones, si no se conecta.
+//Con sinEspera el socket queda sin bloqueo y la conexin puede quedar en curso
+static int __abrirDireccionRed(const char *direccion, bool escuchar, bool sinEspera=false)
+{
+	int fd;
+	if(strncmp(direccion, "unix:", 5) == 0)
+	{
+		struct sockaddr_un dir;
+		memset(&dir, 0, sizeof(dir));
+		dir.sun_family = AF_UNIX;
+		strncpy(dir.sun_path, direccion+5, sizeof(dir.sun_path)-1);
+		fd = socket(AF_UNIX, SOCK_STREAM, 0);
+		if(fd < 0)
+			return -1;
+		if(sinEspera)
+			fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+		if(escuchar)
+		{
+			unlink(dir.sun_path);
+			if(bind(fd, (struct sockaddr*)&dir, sizeof(dir)) == 0 && listen(fd, SOMAXCONN) == 0)
+				return fd;
+		}
+		else if(connect(fd, (struct sockaddr*)&dir, sizeof(dir)) == 0 || (sinEspera && (errno == EINPROGRESS || errno == EAGAIN)))
+			return fd;
+		close(fd);
+		return -1;
+	}
+
+	const char *pDosPuntos = strrchr(direccion, ':');
+	if(!pDosPuntos || pDosPuntos-direccion >= 256)
+		return -1;
+	char equipo[256];
+	int tamEquipo = (int)(pDosPuntos-direccion);
+	memcpy(equipo, direccion, tamEquipo);
+	equipo[tamEquipo] = '\0';
+	const char *pEquipo = equipo;
+	if(tamEquipo == 0 || strcmp(equipo, "*") == 0)
+		pEquipo = escuchar ? NULL : "localhost";
+
+	struct addrinfo pistas, *pLista, *pDir;
+	memset(&pistas, 0, sizeof(pistas));
+	pistas.ai_family = AF_UNSPEC;
+	pistas.ai_socktype = SOCK_STREAM;
+	if(escuchar)
+		pistas.ai_flags = AI_PASSIVE;
+	if(getaddrinfo(pEquipo, pDosPuntos+1, &pistas, &pLista) != 0)
+		return -1;
+
+	fd = -1;
+	for(pDir=pLista; pDir; pDir=pDir->ai_next)
+	{
+		fd = socket(pDir->ai_family, pDir->ai_socktype, pDir->ai_protocol);
+		if(fd < 0)
+			continue;
+		if(sinEspera)
+			fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+		if(escuchar)
+		{
+			int si = 1;
+			setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &si, sizeof(si));
+			if(bind(fd, pDir->ai_addr, pDir->ai_addrlen) == 0 && listen(fd, SOMAXCONN) == 0)
+				break;
+		}
+		else if(connect(fd, pDir->ai_addr, pDir->ai_addrlen) == 0 || (sinEspera && errno == EINPROGRESS))
+			break;
+		close(fd);
+		fd = -1;
+	}
+	freeaddrinfo(pLista);
+	return fd;
+}
+
+//Escribe n bytes en el socket. Retorna false si la conexin se perdi
+static bool __escribirTodoRed(int fd, const void *pDatos, int n)
+{
+	const char *p = (const char*)pDatos;
+	while(n > 0)
+	{
+		ssize_t escritos = send(fd, p, n, __BANDERAS_ENVIO_RED);
+		if(escritos < 0 && errno == EINTR)
+			continue;
+		if(escritos <= 0)
+			return false;
+		p += escritos;
+		n -= (int)escritos;
+	}
+	return true;
+}
+
+//Lee n bytes del socket. Retorna false si la conexin se cerr antes
+static bool __leerTodoRed(int fd, void *pDatos, int n)
+{
+	char *p = (char*)pDatos;
+	while(n > 0)
+	{
+		ssize_t leidos = read(fd, p, n);
+		if(leidos < 0 && errno == EINTR)
+			continue;
+		if(leidos <= 0)
+			return false;
+		p += leidos;
+		n -= (int)leidos;
+	}
+	return true;
+}
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/************************************************************
+                EVALUADOR EN RED (Implementacin)
+************************************************************/
+
+/*!\param direccion Direccin en la que se esperan los trabajadores: \c "equipo:puerto" o \c "unix:/ruta".
+\param numTrabajadores Nmero de trabajadores que se esperan al iniciar.
+\param lote Mximo nmero de individuos que se envan a un trabajador antes de recibir sus respuestas.*/
+EvaluadorRed::EvaluadorRed(const char *direccion, int numTrabajadores, int lote)
+{
+	m_pDireccion = new char[strlen(direccion)+1];
+	strcpy(m_pDireccion, direccion);
+	m_numTrabajadores = numTrabajadores>0 ? numTrabajadores : 1;
+	m_Lote = lote>0 ? lote : 1;
+	m_fdEscucha = -1;
+	m_pEsperas = NULL;
+	m_capEsperas = 0;
+	m_enviados = 0;
+	m_pDatos = NULL;
+	m_numDatos = 0;
+	m_pTexto = NULL;
+	m_capTexto = 0;
+	m_tamTexto = 0;
+	m_pValores = NULL;
+	m_capValores = 0;
+}
+
+
+EvaluadorRed::~EvaluadorRed()
+{
+	finalizar();
+	delete[] m_pDireccion;
+	delete[] m_pEsperas;
+	delete[] m_pDatos;
+	delete[] m_pTexto;
+	delete[] m_pValores;
+}
+
+
+/*!Se usa para los datos de entrada del modelo que no cambian durante la optimizacin, como
+series de caudales o de precipitacin, de modo que no viajen con cada individuo.
+Debe invocarse antes de iniciar la optimizacin.
+\param pDatos Apuntador a los datos. Se copian.
+\param numDatos Nmero de datos.*/
+void EvaluadorRed::setDatosEstaticos(const double *pDatos, int numDatos)
+{
+	delete[] m_pDatos;
+	m_pDatos = NULL;
+	m_numDatos = numDatos>0 ? numDatos : 0;
+	if(m_numDatos > 0)
+	{
+		m_pDatos = new double[m_numDatos];
+		memcpy(m_pDatos, pDatos, m_numDatos*sizeof(double));
+	}
+}
+
+
+/*!Espera, sin lmite de tiempo, a que se conecten \a m_numTrabajadores trabajadores.*/
+void EvaluadorRed::iniciar(AlgoritmoGenetico *)
+{
+	finalizar();
+
+	m_fdEscucha = __abrirDireccionRed(m_pDireccion, true);
+	if(m_fdEscucha < 0)
+		return;
+	fcntl(m_fdEscucha, F_SETFD, FD_CLOEXEC);
+	fcntl(m_fdEscucha, F_SETFL, fcntl(m_fdEscucha, F_GETFL) | O_NONBLOCK);
+
+	while(m_Trabajadores.getSize() < m_numTrabajadores)
+	{
+		struct pollfd espera;
+		espera.fd = m_fdEscucha;
+		espera.events = POLLIN;
+		espera.revents = 0;
+		if(poll(&espera, 1, -1) > 0)
+			aceptar();
+	}
+}
+
+
+/*!\param pInd Apuntador al individuo a evaluar.*/
+void EvaluadorRed::enviar(Individuo *pInd)
+{
+	m_Pendientes.push_back(pInd);
+	m_enviados++;
+}
+
+
+/*!Los individuos pendientes se envan a los trabajadores al invocar esta funcin, de modo que
+los enviados uno tras otro con \a enviar() forman lotes.
+\param esperar Si es true y an no ha terminado ninguna evaluacin, espera hasta que termine alguna.
+\return Apuntador al individuo evaluado, o NULL si no hay ninguno disponible o si no hay individuos en evaluacin.*/
+Individuo* EvaluadorRed::recibir(bool esperar)
+{
+	aceptar();
+	despachar();
+	if(m_Listos.empty() && m_enviados > 0)
+	{
+		atender(false);
+		while(esperar && m_Listos.empty())
+		{
+			despachar();
+			atender(true);
+		}
+	}
+	if(m_Listos.empty())
+		return NULL;
+	Individuo *pInd = m_Listos.front();
+	m_Listos.pop_front();
+	m_enviados--;
+	return pInd;
+}
+
+
+/*!Los individuos que no se hayan recibido se descartan.*/
+void EvaluadorRed::finalizar()
+{
+	CabeceraRed fin = { MENSAJE_FIN, 0, 0, 0 };
+	for(int i=0; i<m_Trabajadores.getSize(); i++)
+	{
+		__escribirTodoRed(m_Trabajadores[i].fd, &fin, sizeof(fin));
+		close(m_Trabajadores[i].fd);
+	}
+	m_Trabajadores.FlushDestroy();
+	if(m_fdEscucha >= 0)
+	{
+		close(m_fdEscucha);
+		m_fdEscucha = -1;
+		if(strncmp(m_pDireccion, "unix:", 5) == 0)
+			unlink(m_pDireccion+5);
+	}
+	m_Pendientes.clear();
+	m_Listos.clear();
+	m_enviados = 0;
+}
+
+
+/*!A cada trabajador nuevo se le envan los datos estticos.*/
+void EvaluadorRed::aceptar()
+{
+	if(m_fdEscucha < 0)
+		return;
+	for(;;)
+	{
+		int fd = accept(m_fdEscucha, NULL, NULL);
+		if(fd < 0 && errno == EINTR)
+			continue;
+		if(fd < 0)
+			return;
+		fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+		__prepararSocketRed(fd);
+
+		if(m_numDatos > 0)
+		{
+			CabeceraRed datos = { MENSAJE_DATOS, 0, 0, m_numDatos };
+			if(!__escribirTodoRed(fd, &datos, sizeof(datos)) || !__escribirTodoRed(fd, m_pDatos, m_numDatos*sizeof(double)))
+			{
+				close(fd);
+				continue;
+			}
+		}
+
+		Trabajador *pTrabajador = new Trabajador;
+		pTrabajador->fd = fd;
+		pTrabajador->idPrimero = 0;
+		pTrabajador->idSiguiente = 0;
+		pTrabajador->tamBuffer = 0;
+		m_Trabajadores.Adicionar(pTrabajador);
+	}
+}
+
+
+/*!Los individuos vuelven al inicio de la cola en el mismo orden, para enviarse antes que los dems.
+\param pos Posicin del trabajador en \a m_Trabajadores.*/
+void EvaluadorRed::desconectar(int pos)
+{
+	Trabajador &t = m_Trabajadores[pos];
+	close(t.fd);
+	while(!t.EnCurso.empty())
+	{
+		m_Pendientes.push_front(t.EnCurso.back());
+		t.EnCurso.pop_back();
+	}
+	m_Trabajadores.Destroy(pos);
+}
+
+
+/*!Los individuos cuya funcin objetivo ya est actualizada pasan directamente a la cola de
+evaluados. Si la direccin no se pudo abrir, los pendientes se evalan en este proceso.*/
+void EvaluadorRed::despachar()
+{
+	if(m_fdEscucha < 0)
+	{
+		while(!m_Pendientes.empty())
+		{
+			m_Pendientes.front()->objetivo();
+			m_Listos.push_back(m_Pendientes.front());
+			m_Pendientes.pop_front();
+		}
+		return;
+	}
+
+	//se recorre de atrs hacia adelante porque desconectar() retira al trabajador del arreglo
+	for(int i=m_Trabajadores.getSize()-1; i>=0 && !m_Pendientes.empty(); i--)
+	{
+		Trabajador &t = m_Trabajadores[i];
+		m_tamTexto = 0;
+		while((int)t.EnCurso.size() < m_Lote && !m_Pendientes.empty())
+		{
+			Individuo *pInd = m_Pendientes.front();
+			m_Pendientes.pop_front();
+			if(pInd->objetivoActualizado())
+			{
+				m_Listos.push_back(pInd);
+				continue;
+			}
+			escribirMensaje(*pInd, t.idSiguiente++);
+			t.EnCurso.push_back(pInd);
+		}
+		if(m_tamTexto > 0 && !__escribirTodoRed(t.fd, m_pTexto, m_tamTexto))
+			desconectar(i);
+	}
+}
+
+
+/*!\param esperar Si es true, espera hasta que algn trabajador responda, se desconecte o se conecte
+uno nuevo. Si es false, solo revisa lo que ya est disponible.*/
+void EvaluadorRed::atender(bool esperar)
+{
+	if(m_fdEscucha < 0)
+		return;
+	int numTrabajadores = m_Trabajadores.getSize();
+	if(numTrabajadores+1 > m_capEsperas)
+	{
+		delete[] m_pEsperas;
+		m_capEsperas = 2*(numTrabajadores+1);
+		m_pEsperas = new struct pollfd[m_capEsperas];
+	}
+
+	//tambin se revisan los trabajadores sin individuos en curso, para detectar si se desconectan
+	m_pEsperas[0].fd = m_fdEscucha;
+	m_pEsperas[0].events = POLLIN;
+	m_pEsperas[0].revents = 0;
+	for(int i=0; i<numTrabajadores; i++)
+	{
+		m_pEsperas[i+1].fd = m_Trabajadores[i].fd;
+		m_pEsperas[i+1].events = POLLIN;
+		m_pEsperas[i+1].revents = 0;
+	}
+	if(poll(m_pEsperas, numTrabajadores+1, esperar ? -1 : 0) <= 0)
+		return;
+
+	for(int i=numTrabajadores-1; i>=0; i--)
+		if(m_pEsperas[i+1].revents)
+			leer(i);
+	if(m_pEsperas[0].revents)
+		aceptar();
+}
+
+
+/*!Cada respuesta debe corresponder al primer individuo en curso. Si la conexin se cerr o la
+respuesta no es vlida, el trabajador se desconecta.
+\param pos Posicin del trabajador en \a m_Trabajadores.*/
+void EvaluadorRed::leer(int pos)
+{
+	Trabajador &t = m_Trabajadores[pos];
+	ssize_t n = read(t.fd, t.buffer+t.tamBuffer, TAM_BUFFER-t.tamBuffer);
+	if(n < 0 && errno == EINTR)
+		return;
+	if(n <= 0)
+	{
+		desconectar(pos);
+		return;
+	}
+	t.tamBuffer += (int)n;
+
+	int inicio = 0;
+	while(t.tamBuffer-inicio >= TAM_RESULTADO)
+	{
+		CabeceraRed cabecera;
+		double valor;
+		memcpy(&cabecera, t.buffer+inicio, sizeof(cabecera));
+		memcpy(&valor, t.buffer+inicio+sizeof(cabecera), sizeof(valor));
+		inicio += TAM_RESULTADO;
+		if(cabecera.tipo != MENSAJE_RESULTADO || t.EnCurso.empty() || cabecera.id != t.idPrimero)
+		{
+			desconectar(pos);
+			return;
+		}
+		Individuo *pInd = t.EnCurso.front();
+		t.EnCurso.pop_front();
+		t.idPrimero++;
+		pInd->asignarObjetivo(valor);
+		m_Listos.push_back(pInd);
+	}
+	t.tamBuffer -= inicio;
+	memmove(t.buffer, t.buffer+inicio, t.tamBuffer);
+}
+
+
+/*!El mensaje contiene el nmero de valores de cada gen, de modo que el trabajador puede
+reconstruir genes de tamao variable.
+\param ind Individuo que se enva.
+\param id Nmero del individuo en el trabajador.*/
+void EvaluadorRed::escribirMensaje(const Individuo &ind, int id)
+{
+	int numGenes = ind.getTamGenoma();
+	int numValores = ind.numValores();
+	if(numValores > m_capValores)
+	{
+		delete[] m_pValores;
+		m_capValores = numValores;
+		m_pValores = new double[m_capValores];
+	}
+	ind.getValores(m_pValores);
+
+	int requerido = m_tamTexto + sizeof(CabeceraRed) + numGenes*sizeof(int) + numValores*sizeof(double);
+	if(requerido > m_capTexto)
+	{
+		m_capTexto = 2*requerido;
+		char *pNuevo = new char[m_capTexto];
+		if(m_tamTexto > 0)
+			memcpy(pNuevo, m_pTexto, m_tamTexto);
+		delete[] m_pTexto;
+		m_pTexto = pNuevo;
+	}
+
+	CabeceraRed cabecera = { MENSAJE_EVALUAR, id, numGenes, numValores };
+	memcpy(m_pTexto+m_tamTexto, &cabecera, sizeof(cabecera));
+	m_tamTexto += sizeof(cabecera);
+	for(int i=0; i<numGenes; i++)
+	{
+		int num = ind.getGen(i).numValores();
+		memcpy(m_pTexto+m_tamTexto, &num, sizeof(num));
+		m_tamTexto += sizeof(num);
+	}
+	if(numValores > 0)
+		memcpy(m_pTexto+m_tamTexto, m_pValores, numValores*sizeof(double));
+	m_tamTexto += numValores*sizeof(double);
+}
+
+
+/************************************************************
+                  TRABAJADOR EN RED (Implementacin)
+************************************************************/
+
+/*!Crea un individuo con la codificacin del algoritmo y, por cada mensaje del evaluador, le asigna
+los valores recibidos, calcula su funcin objetivo y enva la respuesta. Retorna cuando el
+evaluador termina, se pierde la conexin o llega un mensaje con ms genes o valores de los
+aceptables.
+
+El algoritmo no se inicia: los datos que necesite \a objetivo() deben prepararse antes de invocar
+esta funcin, o recibirse en AlgoritmoGenetico::asignarDatosEstaticos().
+\param pAG Apuntador al algoritmo gentico, de la misma clase del que optimiza.
+\param direccion Direccin del evaluador: \c "equipo:puerto" o \c "unix:/ruta".
+\param intentos Nmero de intentos de conexin, separados por un segundo.
+\return Nmero de individuos evaluados, o -1 si no se pudo conectar.*/
+int trabajarRed(AlgoritmoGenetico *pAG, const char *direccion, int intentos)
+{
+	int fd = __abrirDireccionRed(direccion, false);
+	for(int i=1; fd<0 && i<intentos; i++)
+	{
+		sleep(1);
+		fd = __abrirDireccionRed(direccion, false);
+	}
+	if(fd < 0)
+		return -1;
+	__prepararSocketRed(fd);
+
+	MemoriaAG *pActiva = MemoriaAG::getActiva();
+	MemoriaAG::activar(NULL);
+	Individuo *pInd = new Individuo(pAG);
+	pAG->codificacion(pInd, ESTADO_CREAR);
+
+	int capGenes = 0, capValores = 0;
+	int *pNumValores = NULL;
+	double *pValores = NULL;
+	int evaluados = 0;
+	CabeceraRed cabecera;
+	while(__leerTodoRed(fd, &cabecera, sizeof(cabecera)))
+	{
+		if(cabecera.tipo == MENSAJE_FIN || cabecera.numGenes < 0 || cabecera.numValores < 0 ||
+		   cabecera.numGenes > __MAXIMO_DATOS_RED || cabecera.numValores > __MAXIMO_DATOS_RED)
+			break;
+		if(cabecera.numGenes > capGenes)
+		{
+			delete[] pNumValores;
+			capGenes = cabecera.numGenes;
+			pNumValores = new int[capGenes];
+		}
+		if(cabecera.numValores > capValores)
+		{
+			delete[] pValores;
+			capValores = cabecera.numValores;
+			pValores = new double[capValores];
+		}
+		if(!__leerTodoRed(fd, pNumValores, cabecera.numGenes*sizeof(int)) ||
+		   !__leerTodoRed(fd, pValores, cabecera.numValores*sizeof(double)))
+			break;
+
+		if(cabecera.tipo == MENSAJE_DATOS)
+			pAG->asignarDatosEstaticos(pValores, cabecera.numValores);
+		else if(cabecera.tipo == MENSAJE_EVALUAR)
+		{
+			if(cabecera.numGenes != pInd->getTamGenoma())
+				break;
+			pInd->setValores(pValores, pNumValores);
+
+			char respuesta[sizeof(CabeceraRed)+sizeof(double)];
+			CabeceraRed resultado = { MENSAJE_RESULTADO, cabecera.id, 0, 1 };
+			double valor = pInd->objetivo();
+			memcpy(respuesta, &resultado, sizeof(resultado));
+			memcpy(respuesta+sizeof(resultado), &valor, sizeof(valor));
+			if(!__escribirTodoRed(fd, respuesta, sizeof(respuesta)))
+				break;
+			evaluados++;
+		}
+	}
+
+	close(fd);
+	delete[] pNumValores;
+	delete[] pValores;
+	delete pInd;
+	MemoriaAG::activar(pActiva);
+	return evaluados;
+}
+
+
+/************************************************************
+              MODELO DE ISLAS EN RED (Implementacin)
+************************************************************/
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+//Retorna el tiempo de un reloj montono, en segundos
+static double __ahoraRed()
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (double)t.tv_sec + 1e-9*(double)t.tv_nsec;
+}
+
+//Construye en pMensaje un mensaje del tipo indicado con los genes y la funcin objetivo del individuo. Retorna su tamao.
+//pValores es un espacio de trabajo para los valores de los genes; como pMensaje, crece cuando no alcanza
+static int __mensajeIndividuoRed(int tipo, int id, Individuo *pInd, char *&pMensaje, int &capMensaje, double *&pValores, int &capValores)
+{
+	int numGenes = pInd ? pInd->getTamGenoma() : 0;
+	int numValores = pInd ? pInd->numValores() : 0;
+	int tam = sizeof(CabeceraRed) + numGenes*sizeof(int) + (numValores+1)*sizeof(double);
+	if(tam > capMensaje)
+	{
+		delete[] pMensaje;
+		capMensaje = 2*tam;
+		pMensaje = new char[capMensaje];
+	}
+
+	CabeceraRed cabecera = { tipo, id, numGenes, numValores };
+	char *p = pMensaje;
+	memcpy(p, &cabecera, sizeof(cabecera));
+	p += sizeof(cabecera);
+	for(int i=0; i<numGenes; i++)
+	{
+		int num = pInd->getGen(i).numValores();
+		memcpy(p, &num, sizeof(num));
+		p += sizeof(num);
+	}
+	if(numValores > 0)
+	{
+		if(numValores > capValores)
+		{
+			delete[] pValores;
+			capValores = numValores;
+			pValores = new double[capValores];
+		}
+		pInd->getValores(pValores);
+		memcpy(p, pValores, numValores*sizeof(double));
+		p += numValores*sizeof(double);
+	}
+	double objetivo = pInd ? pInd->objetivo() : 0.0;
+	memcpy(p, &objetivo, sizeof(objetivo));
+	return tam;
+}
+
+//Asigna a destino los genes y la funcin objetivo de un mensaje construido con __mensajeIndividuoRed
+static bool __leerIndividuoRed(const CabeceraRed &cabecera, const char *pCuerpo, Individuo &destino)
+{
+	if(cabecera.numGenes == 0 || cabecera.numGenes != destino.getTamGenoma())
+		return false;
+	int *pNumValores = new int[cabecera.numGenes];
+	double *pValores = new double[cabecera.numValores+1];
+	memcpy(pNumValores, pCuerpo, cabecera.numGenes*sizeof(int));
+	memcpy(pValores, pCuerpo + cabecera.numGenes*sizeof(int), (cabecera.numValores+1)*sizeof(double));
+
+	int total = 0;
+	for(int i=0; i<cabecera.numGenes; i++)
+		total += pNumValores[i]>0 ? pNumValores[i] : 0;
+	bool valido = total == cabecera.numValores;
+	if(valido)
+	{
+		destino.setValores(pValores, pNumValores);
+		destino.asignarObjetivo(pValores[cabecera.numValores]);
+	}
+	delete[] pNumValores;
+	delete[] pValores;
+	return valido;
+}
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/*!\param fd Socket de la conexin. Queda sin bloqueo y pertenece al objeto.
+\param conectando true si la conexin an se est estableciendo.*/
+ConexionRed::ConexionRed(int fd, bool conectando)
+{
+	m_fd = fd;
+	m_conectando = conectando;
+	m_enviados = 0;
+	m_pBuffer = NULL;
+	m_capBuffer = 0;
+	m_inicio = 0;
+	m_tamBuffer = 0;
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+	__prepararSocketRed(fd);
+}
+
+
+ConexionRed::~ConexionRed()
+{
+	close(m_fd);
+	while(!m_Cola.empty())
+	{
+		delete[] m_Cola.front().pDatos;
+		m_Cola.pop_front();
+	}
+	delete[] m_pBuffer;
+}
+
+
+/*!\param pDatos Mensaje a enviar. Se copia.
+\param tam Tamao del mensaje.
+\param maxCola Mximo nmero de mensajes en la cola.
+\return false si se descart algn mensaje.*/
+bool ConexionRed::encolar(const char *pDatos, int tam, int maxCola)
+{
+	MensajeRed mensaje;
+	mensaje.pDatos = new char[tam];
+	mensaje.tam = tam;
+	memcpy(mensaje.pDatos, pDatos, tam);
+	m_Cola.push_back(mensaje);
+
+	//el primer mensaje no se descarta si ya empez a enviarse
+	bool completo = true;
+	int primero = m_enviados>0 ? 1 : 0;
+	while((int)m_Cola.size() > maxCola && (int)m_Cola.size() > primero+1)
+	{
+		delete[] m_Cola[primero].pDatos;
+		m_Cola.erase(m_Cola.begin()+primero);
+		completo = false;
+	}
+	return completo;
+}
+
+
+/*!Si la conexin se est estableciendo, primero verifica si ya se estableci.
+\return false si la conexin fall o se perdi.*/
+bool ConexionRed::enviar()
+{
+	if(m_conectando)
+	{
+		struct pollfd espera;
+		espera.fd = m_fd;
+		espera.events = POLLOUT;
+		espera.revents = 0;
+		if(poll(&espera, 1, 0) <= 0)
+			return true;
+		int error = 0;
+		socklen_t tam = sizeof(error);
+		if(getsockopt(m_fd, SOL_SOCKET, SO_ERROR, &error, &tam) != 0 || error != 0)
+			return false;
+		m_conectando = false;
+	}
+	while(!m_Cola.empty())
+	{
+		MensajeRed &mensaje = m_Cola.front();
+		ssize_t n = send(m_fd, mensaje.pDatos+m_enviados, mensaje.tam-m_enviados, __BANDERAS_ENVIO_RED);
+		if(n < 0)
+			return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+		m_enviados += (int)n;
+		if(m_enviados < mensaje.tam)
+			return true;
+		delete[] mensaje.pDatos;
+		m_Cola.pop_front();
+		m_enviados = 0;
+	}
+	return true;
+}
+
+
+/*!\return false si la conexin se cerr o se perdi.*/
+bool ConexionRed::recibir()
+{
+	if(m_conectando)
+		return true;
+	if(m_inicio > 0)
+	{
+		m_tamBuffer -= m_inicio;
+		memmove(m_pBuffer, m_pBuffer+m_inicio, m_tamBuffer);
+		m_inicio = 0;
+	}
+	for(;;)
+	{
+		if(m_capBuffer - m_tamBuffer < 4096)
+		{
+			m_capBuffer = 2*m_capBuffer + 4096;
+			char *pNuevo = new char[m_capBuffer];
+			if(m_tamBuffer > 0)
+				memcpy(pNuevo, m_pBuffer, m_tamBuffer);
+			delete[] m_pBuffer;
+			m_pBuffer = pNuevo;
+		}
+		ssize_t n = read(m_fd, m_pBuffer+m_tamBuffer, m_capBuffer-m_tamBuffer);
+		if(n < 0)
+			return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+		if(n == 0)
+			return false;
+		m_tamBuffer += (int)n;
+	}
+}
+
+
+/*!\param cabecera Recibe la cabecera del mensaje.
+\param pCuerpo Recibe un apuntador al cuerpo del mensaje, vlido hasta la siguiente invocacin de \a recibir().
+\return false si an no hay un mensaje completo. Los mensajes con tamaos invlidos se descartan con el resto de los datos.*/
+bool ConexionRed::extraer(CabeceraRed &cabecera, const char *&pCuerpo)
+{
+	if(m_tamBuffer - m_inicio < (int)sizeof(CabeceraRed))
+		return false;
+	memcpy(&cabecera, m_pBuffer+m_inicio, sizeof(cabecera));
+	int tam = tamCuerpo(cabecera);
+	if(tam < 0)
+	{
+		m_inicio = m_tamBuffer;
+		return false;
+	}
+	if(m_tamBuffer - m_inicio < (int)sizeof(CabeceraRed) + tam)
+		return false;
+	pCuerpo = m_pBuffer + m_inicio + sizeof(CabeceraRed);
+	m_inicio += sizeof(CabeceraRed) + tam;
+	return true;
+}
+
+
+/*!\param cabecera Cabecera del mensaje.
+\return Nmero de bytes que siguen a la cabecera, o -1 si la cabecera no es vlida.*/
+int ConexionRed::tamCuerpo(const CabeceraRed &cabecera)
+{
+	if(cabecera.numGenes < 0 || cabecera.numValores < 0 ||
+	   cabecera.numGenes > __MAXIMO_DATOS_RED || cabecera.numValores > __MAXIMO_DATOS_RED)
+		return -1;
+	int tam = cabecera.numGenes*sizeof(int) + cabecera.numValores*sizeof(double);
+	if(cabecera.tipo == MENSAJE_MIGRANTE || cabecera.tipo == MENSAJE_MEJOR || cabecera.tipo == MENSAJE_TERMINADO)
+		tam += sizeof(double);
+	return tam;
+}
+
+
+/*!\param isla Nmero de la isla.
+\param direccion Direccin en la que la isla espera a las dems: \c "equipo:puerto" o \c "unix:/ruta".
+\param maxCola Mximo nmero de mensajes en cada cola de envo y de migrantes recibidos.*/
+IslaRed::IslaRed(int isla, const char *direccion, int maxCola)
+{
+	m_Isla = isla;
+	m_pDireccion = new char[strlen(direccion)+1];
+	strcpy(m_pDireccion, direccion);
+	m_MaxCola = maxCola>0 ? maxCola : 1;
+	m_fdEscucha = -1;
+	m_Coordinador.pDireccion = NULL;
+	m_Coordinador.pConexion = NULL;
+	m_Coordinador.proximoIntento = 0.0;
+	m_debeTerminar = false;
+	m_terminado = false;
+	m_pMensaje = NULL;
+	m_capMensaje = 0;
+	m_pValores = NULL;
+	m_capValores = 0;
+}
+
+
+/*!Si no se invoc \a terminar(), informa al coordinador que la isla termin.*/
+IslaRed::~IslaRed()
+{
+	if(!m_terminado)
+		terminar(NULL, 0.5);
+	for(int i=0; i<m_Destinos.getSize(); i++)
+	{
+		delete m_Destinos[i].pConexion;
+		delete[] m_Destinos[i].pDireccion;
+	}
+	m_Destinos.FlushDestroy();
+	m_Entrantes.FlushDestroy();
+	delete m_Coordinador.pConexion;
+	delete[] m_Coordinador.pDireccion;
+	while(!m_Migrantes.empty())
+	{
+		delete[] m_Migrantes.front();
+		m_Migrantes.pop_front();
+	}
+	if(m_fdEscucha >= 0)
+	{
+		close(m_fdEscucha);
+		if(strncmp(m_pDireccion, "unix:", 5) == 0)
+			unlink(m_pDireccion+5);
+	}
+	delete[] m_pDireccion;
+	delete[] m_pMensaje;
+	delete[] m_pValores;
+}
+
+
+/*!\param direccion Direccin de la isla destino.*/
+void IslaRed::adicionarDestino(const char *direccion)
+{
+	Destino *pDestino = new Destino;
+	pDestino->pDireccion = new char[strlen(direccion)+1];
+	strcpy(pDestino->pDireccion, direccion);
+	pDestino->pConexion = NULL;
+	pDestino->proximoIntento = 0.0;
+	m_Destinos.Adicionar(pDestino);
+}
+
+
+/*!\param direccion Direccin del coordinador.*/
+void IslaRed::setCoordinador(const char *direccion)
+{
+	delete[] m_Coordinador.pDireccion;
+	m_Coordinador.pDireccion = new char[strlen(direccion)+1];
+	strcpy(m_Coordinador.pDireccion, direccion);
+}
+
+
+/*!\return false si no se pudo abrir la direccin. La isla puede seguir enviando migrantes, pero no recibirlos.*/
+bool IslaRed::iniciar()
+{
+	if(m_fdEscucha < 0)
+	{
+		m_fdEscucha = __abrirDireccionRed(m_pDireccion, true);
+		if(m_fdEscucha < 0)
+			return false;
+		fcntl(m_fdEscucha, F_SETFD, FD_CLOEXEC);
+		fcntl(m_fdEscucha, F_SETFL, fcntl(m_fdEscucha, F_GETFL) | O_NONBLOCK);
+	}
+	return true;
+}
+
+
+/*!Acepta conexiones de otras islas, lee los migrantes que hayan llegado, establece las conexiones
+pendientes y enva lo que se pueda de las colas.*/
+void IslaRed::atender()
+{
+	if(m_fdEscucha >= 0)
+	{
+		int fd;
+		while((fd = accept(m_fdEscucha, NULL, NULL)) >= 0)
+			m_Entrantes.Adicionar(new ConexionRed(fd));
+	}
+
+	for(int i=m_Entrantes.getSize()-1; i>=0; i--)
+	{
+		ConexionRed &c = m_Entrantes[i];
+		bool abierta = c.recibir();
+		CabeceraRed cabecera;
+		const char *pCuerpo;
+		while(c.extraer(cabecera, pCuerpo))
+		{
+			if(cabecera.tipo != MENSAJE_MIGRANTE)
+				continue;
+			int tam = sizeof(cabecera) + ConexionRed::tamCuerpo(cabecera);
+			char *pMigrante = new char[tam];
+			memcpy(pMigrante, &cabecera, sizeof(cabecera));
+			memcpy(pMigrante+sizeof(cabecera), pCuerpo, tam-sizeof(cabecera));
+			m_Migrantes.push_back(pMigrante);
+			if((int)m_Migrantes.size() > m_MaxCola)
+			{
+				delete[] m_Migrantes.front();
+				m_Migrantes.pop_front();
+			}
+		}
+		if(!abierta)
+			m_Entrantes.Destroy(i);
+	}
+
+	for(int i=0; i<m_Destinos.getSize(); i++)
+		atenderDestino(m_Destinos[i]);
+	if(m_Coordinador.pDireccion)
+		atenderDestino(m_Coordinador);
+}
+
+
+/*!Si la conexin se pierde, los mensajes en cola se descartan y se intenta conectar de nuevo un segundo
+despus. Del coordinador se lee la orden de terminar.
+\param d Destino a atender.*/
+void IslaRed::atenderDestino(Destino &d)
+{
+	if(!d.pConexion)
+	{
+		if(__ahoraRed() < d.proximoIntento)
+			return;
+		int fd = __abrirDireccionRed(d.pDireccion, false, true);
+		if(fd < 0)
+		{
+			d.proximoIntento = __ahoraRed() + 1.0;
+			return;
+		}
+		d.pConexion = new ConexionRed(fd, true);
+	}
+
+	bool abierta = d.pConexion->enviar() && d.pConexion->recibir();
+	CabeceraRed cabecera;
+	const char *pCuerpo;
+	while(abierta && d.pConexion->extraer(cabecera, pCuerpo))
+		if(cabecera.tipo == MENSAJE_FIN)
+			m_debeTerminar = true;
+	if(!abierta)
+	{
+		delete d.pConexion;
+		d.pConexion = NULL;
+		d.proximoIntento = __ahoraRed() + 1.0;
+	}
+}
+
+
+/*!Si el destino no est conectado, lo intenta de inmediato para no perder el mensaje.
+\param d Destino.
+\param pDatos Mensaje.
+\param tam Tamao del mensaje.*/
+void IslaRed::encolar(Destino &d, const char *pDatos, int tam)
+{
+	if(!d.pConexion)
+	{
+		d.proximoIntento = 0.0;
+		atenderDestino(d);
+	}
+	if(d.pConexion)
+	{
+		d.pConexion->encolar(pDatos, tam, m_MaxCola);
+		atenderDestino(d);
+	}
+}
+
+
+/*!\param ind Individuo a enviar.*/
+void IslaRed::enviarMigrante(Individuo &ind)
+{
+	int tam = __mensajeIndividuoRed(MENSAJE_MIGRANTE, m_Isla, &ind, m_pMensaje, m_capMensaje, m_pValores, m_capValores);
+	for(int i=0; i<m_Destinos.getSize(); i++)
+		encolar(m_Destinos[i], m_pMensaje, tam);
+}
+
+
+/*!\param destino Individuo que recibe los genes y la funcin objetivo. Debe tener la misma estructura de genoma.
+\return false si no hay migrantes recibidos.*/
+bool IslaRed::recibirMigrante(Individuo &destino)
+{
+	while(!m_Migrantes.empty())
+	{
+		char *pMigrante = m_Migrantes.front();
+		m_Migrantes.pop_front();
+		CabeceraRed cabecera;
+		memcpy(&cabecera, pMigrante, sizeof(cabecera));
+		bool valido = __leerIndividuoRed(cabecera, pMigrante+sizeof(cabecera), destino);
+		delete[] pMigrante;
+		if(valido)
+			return true;
+	}
+	return false;
+}
+
+
+/*!\param ind Mejor individuo de la isla.*/
+void IslaRed::reportarMejor(Individuo &ind)
+{
+	if(!m_Coordinador.pDireccion)
+		return;
+	int tam = __mensajeIndividuoRed(MENSAJE_MEJOR, m_Isla, &ind, m_pMensaje, m_capMensaje, m_pValores, m_capValores);
+	encolar(m_Coordinador, m_pMensaje, tam);
+}
+
+
+/*!Es la nica operacin de la isla que puede esperar: intenta vaciar las colas durante a lo sumo
+\a tiempoMaximo segundos.
+\param pMejor Apuntador al mejor individuo de la isla, o NULL.
+\param tiempoMaximo Tiempo mximo de espera, en segundos.*/
+void IslaRed::terminar(Individuo *pMejor, double tiempoMaximo)
+{
+	m_terminado = true;
+	if(m_Coordinador.pDireccion)
+	{
+		int tam = __mensajeIndividuoRed(MENSAJE_TERMINADO, m_Isla, pMejor, m_pMensaje, m_capMensaje, m_pValores, m_capValores);
+		encolar(m_Coordinador, m_pMensaje, tam);
+	}
+
+	double limite = __ahoraRed() + tiempoMaximo;
+	for(;;)
+	{
+		bool pendientes = m_Coordinador.pConexion && m_Coordinador.pConexion->hayPendientes();
+		for(int i=0; i<m_Destinos.getSize(); i++)
+			pendientes = pendientes || (m_Destinos[i].pConexion && m_Destinos[i].pConexion->hayPendientes());
+		if(!pendientes || __ahoraRed() >= limite)
+			break;
+		usleep(1000);
+		atender();
+	}
+}
+
+
+/*!\param direccion Direccin en la que se esperan las islas: \c "equipo:puerto" o \c "unix:/ruta".
+\param maximizar Debe ser igual al \a m_IndicadorMaximizar de las islas.*/
+CoordinadorIslas::CoordinadorIslas(const char *direccion, bool maximizar)
+{
+	m_pDireccion = new char[strlen(direccion)+1];
+	strcpy(m_pDireccion, direccion);
+	m_Maximizar = maximizar;
+	m_fdEscucha = -1;
+	m_numTerminadas = 0;
+	m_finPedido = false;
+	m_MejorObjetivo = 0.0;
+	m_IslaMejor = -1;
+	m_pMejor = NULL;
+}
+
+
+CoordinadorIslas::~CoordinadorIslas()
+{
+	m_Islas.FlushDestroy();
+	if(m_fdEscucha >= 0)
+	{
+		close(m_fdEscucha);
+		if(strncmp(m_pDireccion, "unix:", 5) == 0)
+			unlink(m_pDireccion+5);
+	}
+	delete[] m_pDireccion;
+	delete[] m_pMejor;
+}
+
+
+/*!\return false si no se pudo abrir la direccin.*/
+bool CoordinadorIslas::iniciar()
+{
+	if(m_fdEscucha < 0)
+	{
+		m_fdEscucha = __abrirDireccionRed(m_pDireccion, true);
+		if(m_fdEscucha < 0)
+			return false;
+		fcntl(m_fdEscucha, F_SETFD, FD_CLOEXEC);
+		fcntl(m_fdEscucha, F_SETFL, fcntl(m_fdEscucha, F_GETFL) | O_NONBLOCK);
+	}
+	return true;
+}
+
+
+/*!Retorna cuando \a numIslas islas han terminado, o cuando, despus de pedir el fin, ya no queda
+ninguna isla conectada.
+\param numIslas Nmero de islas del modelo.
+\param tiempoMaximo Tiempo mximo de la optimizacin, en segundos. Al cumplirse se pide a las islas
+que terminen. Con 0 no hay lmite.
+\return Nmero de islas que informaron su terminacin.*/
+int CoordinadorIslas::ejecutar(int numIslas, double tiempoMaximo)
+{
+	if(!iniciar())
+		return 0;
+	double limite = tiempoMaximo>0.0 ? __ahoraRed()+tiempoMaximo : 0.0;
+	struct pollfd *pEsperas = NULL;
+	int capEsperas = 0;
+
+	while(m_numTerminadas < numIslas && !(m_finPedido && m_Islas.getSize() == 0))
+	{
+		if(limite > 0.0 && !m_finPedido && __ahoraRed() >= limite)
+			pedirFin();
+
+		int numConexiones = m_Islas.getSize();
+		if(numConexiones+1 > capEsperas)
+		{
+			delete[] pEsperas;
+			capEsperas = 2*(numConexiones+1);
+			pEsperas = new struct pollfd[capEsperas];
+		}
+		pEsperas[0].fd = m_fdEscucha;
+		pEsperas[0].events = POLLIN;
+		pEsperas[0].revents = 0;
+		for(int i=0; i<numConexiones; i++)
+		{
+			pEsperas[i+1].fd = m_Islas[i].m_fd;
+			pEsperas[i+1].events = POLLIN | (m_Islas[i].hayPendientes() ? POLLOUT : 0);
+			pEsperas[i+1].revents = 0;
+		}
+		poll(pEsperas, numConexiones+1, 100);
+
+		int fd;
+		while((fd = accept(m_fdEscucha, NULL, NULL)) >= 0)
+		{
+			ConexionRed *pConexion = new ConexionRed(fd);
+			m_Islas.Adicionar(pConexion);
+			if(m_finPedido)
+				pedirFin(pConexion);
+		}
+
+		for(int i=m_Islas.getSize()-1; i>=0; i--)
+		{
+			ConexionRed &c = m_Islas[i];
+			bool abierta = c.recibir();
+			CabeceraRed cabecera;
+			const char *pCuerpo;
+			while(c.extraer(cabecera, pCuerpo))
+				procesar(cabecera, pCuerpo);
+			abierta = c.enviar() && abierta;
+			if(!abierta)
+				m_Islas.Destroy(i);
+		}
+	}
+	delete[] pEsperas;
+
+	//las islas que an no hayan terminado reciben la orden antes de cerrar
+	pedirFin();
+	for(int i=0; i<m_Islas.getSize(); i++)
+		m_Islas[i].enviar();
+	return m_numTerminadas;
+}
+
+
+/*!\param cabecera Cabecera del mensaje.
+\param pCuerpo Cuerpo del mensaje.*/
+void CoordinadorIslas::procesar(const CabeceraRed &cabecera, const char *pCuerpo)
+{
+	if(cabecera.tipo != MENSAJE_MEJOR && cabecera.tipo != MENSAJE_TERMINADO)
+		return;
+	if(cabecera.tipo == MENSAJE_TERMINADO)
+	{
+		m_numTerminadas++;
+		pedirFin();
+	}
+	if(cabecera.numGenes == 0)
+		return;
+
+	int tam = ConexionRed::tamCuerpo(cabecera);
+	double objetivo;
+	memcpy(&objetivo, pCuerpo + tam - sizeof(double), sizeof(double));
+	bool mejor = m_IslaMejor < 0 || (m_Maximizar ? objetivo > m_MejorObjetivo : objetivo < m_MejorObjetivo);
+	if(!mejor)
+		return;
+	m_MejorObjetivo = objetivo;
+	m_IslaMejor = cabecera.id;
+	delete[] m_pMejor;
+	m_pMejor = new char[sizeof(cabecera)+tam];
+	memcpy(m_pMejor, &cabecera, sizeof(cabecera));
+	memcpy(m_pMejor+sizeof(cabecera), pCuerpo, tam);
+}
+
+
+/*!\param pConexion Isla a la que se pide terminar. Con NULL se pide a todas, una sola vez.*/
+void CoordinadorIslas::pedirFin(ConexionRed *pConexion)
+{
+	CabeceraRed fin = { MENSAJE_FIN, 0, 0, 0 };
+	if(pConexion)
+	{
+		pConexion->encolar((const char*)&fin, sizeof(fin), 1);
+		return;
+	}
+	if(m_finPedido)
+		return;
+	m_finPedido = true;
+	for(int i=0; i<m_Islas.getSize(); i++)
+		m_Islas[i].encolar((const char*)&fin, sizeof(fin), 1);
+}
+
+
+/*!\param destino Individuo que recibe los genes y la funcin objetivo. Debe tener la misma estructura de genoma que los de las islas.
+\return false si an no se ha recibido ningn individuo.*/
+bool CoordinadorIslas::getMejor(Individuo &destino) const
+{
+	if(!m_pMejor)
+		return false;
+	CabeceraRed cabecera;
+	memcpy(&cabecera, m_pMejor, sizeof(cabecera));
+	return __leerIndividuoRed(cabecera, m_pMejor+sizeof(cabecera), destino);
+}
+
+
+/*!\param pIsla Isla ya iniciada. No pertenece al operador.
+\param intervalo Nmero de generaciones entre migraciones.
+\param numMigrantes Mximo nmero de individuos recibidos en cada migracin.*/
+OperadorAdaptacionMigracionRed::OperadorAdaptacionMigracionRed(IslaRed *pIsla, int intervalo, int numMigrantes)
+{
+	m_pIsla = pIsla;
+	m_Intervalo = intervalo>0 ? intervalo : 1;
+	m_NumMigrantes = numMigrantes>0 ? numMigrantes : 1;
+}
+
+
+/*!Cada migrante remplaza al peor individuo de la poblacin en ese momento.
+\param pAG Apuntador al algoritmo gentico de la isla.*/
+void OperadorAdaptacionMigracionRed::adaptacion(AlgoritmoGenetico *pAG)
+{
+	m_pIsla->atender();
+	if(pAG->m_Generacion % m_Intervalo != 0)
+		return;
+
+	m_pIsla->enviarMigrante(*pAG->m_pMejorEnLaHistoria);
+	m_pIsla->reportarMejor(*pAG->m_pMejorEnLaHistoria);
+
+	Poblacion &Pob = *pAG->m_pPoblacionActual;
+	for(int i=0; i<m_NumMigrantes; i++)
+	{
+		int posPeor = Pob.getPosPeor(pAG->m_IndicadorMaximizar);
+		if(!m_pIsla->recibirMigrante(Pob.getIndividuoDirecto(posPeor)))
+			break;
+	}
+}
+
+#endif
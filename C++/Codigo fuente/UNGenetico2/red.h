@@ -0,0 +1,475 @@
+#ifndef __RED_H
+#define __RED_H
+
+#include "evaluador.h"
+
+#if defined(UN_PROCESOS)
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+
+
+/************************************************************
+                 EVALUACIN DISTRIBUIDA EN RED
+************************************************************/
+
+//!Tipos de mensaje entre EvaluadorRed y trabajarRed(), y entre IslaRed y CoordinadorIslas
+enum TiposMensajeRed
+{
+	MENSAJE_DATOS = 1,
+	MENSAJE_EVALUAR,
+	MENSAJE_RESULTADO,
+	MENSAJE_FIN,
+	MENSAJE_MIGRANTE,
+	MENSAJE_MEJOR,
+	MENSAJE_TERMINADO
+};
+
+
+//!Cabecera de los mensajes en red
+/*!Le siguen \a numGenes enteros con el nmero de valores de cada gen y \a numValores datos double.
+Los mensajes MENSAJE_MIGRANTE, MENSAJE_MEJOR y MENSAJE_TERMINADO terminan con un dato double ms:
+la funcin objetivo del individuo.
+Los mensajes se envan en la representacin binaria de la mquina, por lo que todos los procesos
+deben ejecutarse en equipos de la misma arquitectura.*/
+struct CabeceraRed
+{
+	//!Tipo de mensaje (Ver TiposMensajeRed)
+	int tipo;
+	//!Nmero del individuo
+	int id;
+	//!Nmero de enteros que siguen a la cabecera
+	int numGenes;
+	//!Nmero de datos double que siguen a los enteros
+	int numValores;
+};
+
+
+//!Clase derivada de Evaluador que distribuye la evaluacin entre procesos trabajadores conectados por sockets
+/*!El evaluador espera conexiones en una direccin TCP (\c "equipo:puerto", con equipo vaco o
+\c "*" para todas las interfaces) o en un socket local (\c "unix:/ruta"). Cada trabajador es un
+programa que declara el mismo algoritmo gentico e invoca trabajarRed() con la misma direccin;
+as reconstruye los individuos a partir de los valores de sus genes y calcula \a objetivo()
+en su propio proceso, en el mismo equipo o en otro.
+
+- Al iniciar, el evaluador espera a que se conecten \a numTrabajadores trabajadores. Otros
+pueden conectarse durante la optimizacin y empiezan a recibir individuos de inmediato.
+- Los datos fijos definidos con \a setDatosEstaticos() se envan una sola vez a cada trabajador
+al conectarse, que los conserva durante toda la optimizacin (Ver AlgoritmoGenetico::asignarDatosEstaticos()).
+- A cada trabajador se le envan lotes de hasta \a lote individuos en una sola escritura; los
+dems esperan en una cola hasta que algn trabajador responda.
+- Si un trabajador se desconecta, sus individuos en curso vuelven a la cola y se envan a los dems.
+Si no queda ninguno, el evaluador espera a que se conecte otro.
+- Si no se puede abrir la direccin, los individuos se evalan en el proceso del algoritmo.
+
+Solo est disponible en sistemas POSIX (Ver UN_PROCESOS).*/
+class EvaluadorRed:public Evaluador
+{
+public:
+	//!Constructor
+	EvaluadorRed(const char *direccion, int numTrabajadores=1, int lote=2);
+
+	//!Destructor. Desconecta a los trabajadores
+	~EvaluadorRed();
+
+	//!Define los datos fijos que se envan a cada trabajador al conectarse
+	void setDatosEstaticos(const double *pDatos, int numDatos);
+
+	//!Abre la direccin y espera a los trabajadores iniciales
+	void iniciar(AlgoritmoGenetico *pAG);
+
+	//!Adiciona un individuo a la cola de pendientes
+	void enviar(Individuo *pInd);
+
+	//!Enva los pendientes a los trabajadores y retorna un individuo evaluado
+	Individuo* recibir(bool esperar);
+
+	//!Pide a los trabajadores que terminen y cierra las conexiones
+	void finalizar();
+
+	//!Retorna el nmero de individuos que pueden estar a la vez en los trabajadores
+	int getCapacidad() const
+	{
+		int num = getNumConectados();
+		return (num>m_numTrabajadores ? num : m_numTrabajadores)*m_Lote;
+	}
+
+	//!Retorna el nmero de trabajadores conectados
+	int getNumConectados() const
+	{
+		return m_Trabajadores.getSize();
+	}
+
+protected:
+	enum { TAM_RESULTADO = sizeof(CabeceraRed)+sizeof(double), TAM_BUFFER = 8*TAM_RESULTADO };
+
+	//!Informacin de uno de los trabajadores conectados
+	struct Trabajador
+	{
+		//!Socket de la conexin
+		int fd;
+		//!Individuos enviados al trabajador, en el orden en que se enviaron
+		std::deque<Individuo*> EnCurso;
+		//!Identificador del primer individuo en curso
+		int idPrimero;
+		//!Identificador del siguiente individuo que se enve
+		int idSiguiente;
+		//!Respuestas ledas del trabajador que an no se han procesado
+		char buffer[TAM_BUFFER];
+		//!Nmero de bytes en \a buffer
+		int tamBuffer;
+	};
+
+	//!Acepta las conexiones pendientes
+	void aceptar();
+
+	//!Devuelve a la cola los individuos en curso del trabajador \a pos y cierra su conexin
+	void desconectar(int pos);
+
+	//!Enva a cada trabajador los individuos pendientes que le caben
+	void despachar();
+
+	//!Espera respuestas o conexiones
+	void atender(bool esperar);
+
+	//!Lee las respuestas disponibles del trabajador \a pos
+	void leer(int pos);
+
+	//!Adiciona a \a m_pTexto el mensaje con los valores del individuo
+	void escribirMensaje(const Individuo &ind, int id);
+
+	//!Direccin en la que se esperan las conexiones
+	char *m_pDireccion;
+	//!Nmero de trabajadores que se esperan al iniciar
+	int m_numTrabajadores;
+	//!Mximo nmero de individuos en curso en cada trabajador
+	int m_Lote;
+	//!Socket en el que se esperan las conexiones
+	int m_fdEscucha;
+	//!Trabajadores conectados
+	Arreglo<Trabajador> m_Trabajadores;
+	//!Descriptores que se revisan con \c poll()
+	struct pollfd *m_pEsperas;
+	//!Capacidad de \a m_pEsperas
+	int m_capEsperas;
+	//!Individuos que no se han enviado a ningn trabajador
+	std::deque<Individuo*> m_Pendientes;
+	//!Individuos evaluados
+	std::deque<Individuo*> m_Listos;
+	//!Nmero de individuos enviados que no se han recibido
+	int m_enviados;
+	//!Datos fijos que se envan a cada trabajador
+	double *m_pDatos;
+	//!Nmero de datos fijos
+	int m_numDatos;
+	//!Mensajes que se escriben a un trabajador
+	char *m_pTexto;
+	//!Capacidad de \a m_pTexto
+	int m_capTexto;
+	//!Longitud de los mensajes en \a m_pTexto
+	int m_tamTexto;
+	//!Valores de un individuo
+	double *m_pValores;
+	//!Capacidad de \a m_pValores
+	int m_capValores;
+};
+
+
+//!Conecta el proceso a un EvaluadorRed y evala los individuos que este le enva
+int trabajarRed(AlgoritmoGenetico *pAG, const char *direccion, int intentos=10);
+
+
+/************************************************************
+                 MODELO DE ISLAS EN RED
+************************************************************/
+
+//!Conexin por socket que enva y recibe mensajes sin bloquear el proceso
+/*!Los mensajes a enviar se copian en una cola; cuando la cola excede su mximo se descarta el
+mensaje ms antiguo que an no ha empezado a enviarse. Los datos recibidos se acumulan hasta
+completar mensajes (Ver CabeceraRed).
+La utilizan IslaRed y CoordinadorIslas.*/
+class ConexionRed
+{
+public:
+	//!Constructor a partir de un socket abierto
+	ConexionRed(int fd, bool conectando=false);
+
+	//!Destructor. Cierra el socket
+	~ConexionRed();
+
+	//!Adiciona un mensaje a la cola de envo
+	bool encolar(const char *pDatos, int tam, int maxCola);
+
+	//!Enva lo que se pueda de la cola sin bloquear el proceso
+	bool enviar();
+
+	//!Lee los datos disponibles sin bloquear el proceso
+	bool recibir();
+
+	//!Extrae el siguiente mensaje completo recibido
+	bool extraer(CabeceraRed &cabecera, const char *&pCuerpo);
+
+	//!Indica si quedan datos en la cola de envo
+	bool hayPendientes() const
+	{
+		return !m_Cola.empty();
+	}
+
+	//!Retorna el nmero de bytes del cuerpo de un mensaje
+	static int tamCuerpo(const CabeceraRed &cabecera);
+
+	//!Socket de la conexin
+	int m_fd;
+	//!Indica que la conexin an se est estableciendo
+	bool m_conectando;
+
+protected:
+	//!Mensaje en la cola de envo
+	struct MensajeRed
+	{
+		char *pDatos;
+		int tam;
+	};
+
+	//!Mensajes por enviar
+	std::deque<MensajeRed> m_Cola;
+	//!Bytes ya enviados del primer mensaje de la cola
+	int m_enviados;
+	//!Datos recibidos
+	char *m_pBuffer;
+	//!Capacidad de \a m_pBuffer
+	int m_capBuffer;
+	//!Posicin del primer dato de \a m_pBuffer que no se ha extrado
+	int m_inicio;
+	//!Nmero de datos en \a m_pBuffer
+	int m_tamBuffer;
+};
+
+
+//!Isla de un modelo de islas distribuido en varios equipos
+/*!Cada isla es un proceso con su propio algoritmo gentico. La isla espera conexiones de otras
+islas en su propia direccin, y enva sus migrantes a las islas que se definan con
+\a adicionarDestino(); as, la topologa (anillo, estrella, todos con todos, ...) la decide
+quien configura las islas. Los migrantes viajan como los valores de sus genes junto con su funcin
+objetivo, de modo que no se evalan de nuevo al llegar.
+
+Ninguna operacin bloquea la optimizacin: las conexiones se establecen y se restablecen en segundo
+plano, cada destino tiene una cola de envo de a lo sumo \a maxCola mensajes en la que se descartan
+los ms antiguos, y los migrantes recibidos tambin se limitan a \a maxCola.
+
+Si se define un coordinador (Ver CoordinadorIslas), la isla le informa su mejor individuo y
+termina cuando el coordinador lo indique. Al terminar la optimizacin debe invocarse \a terminar().
+La migracin la realiza OperadorAdaptacionMigracionRed y la terminacin OperadorFinalizacionIslas.
+Solo est disponible en sistemas POSIX (Ver UN_PROCESOS).*/
+class IslaRed
+{
+public:
+	//!Constructor
+	IslaRed(int isla, const char *direccion, int maxCola=16);
+
+	//!Destructor. Cierra las conexiones
+	~IslaRed();
+
+	//!Adiciona una isla a la que se envan los migrantes
+	void adicionarDestino(const char *direccion);
+
+	//!Define la direccin del coordinador
+	void setCoordinador(const char *direccion);
+
+	//!Abre la direccin de la isla
+	bool iniciar();
+
+	//!Atiende las conexiones sin bloquear el proceso
+	void atender();
+
+	//!Enva un migrante a todos los destinos
+	void enviarMigrante(Individuo &ind);
+
+	//!Asigna a \a destino el migrante recibido ms antiguo
+	bool recibirMigrante(Individuo &destino);
+
+	//!Informa al coordinador el mejor individuo de la isla
+	void reportarMejor(Individuo &ind);
+
+	//!Informa al coordinador que la isla termin y enva lo que quede en las colas
+	void terminar(Individuo *pMejor=NULL, double tiempoMaximo=2.0);
+
+	//!Indica si el coordinador pidi terminar
+	bool debeTerminar() const
+	{
+		return m_debeTerminar;
+	}
+
+	//!Retorna el nmero de la isla
+	int getIsla() const
+	{
+		return m_Isla;
+	}
+
+protected:
+	//!Conexin saliente que se restablece si se pierde
+	struct Destino
+	{
+		//!Direccin del destino
+		char *pDireccion;
+		//!Conexin, o NULL si no est conectado
+		ConexionRed *pConexion;
+		//!Momento a partir del cual se puede intentar conectar de nuevo
+		double proximoIntento;
+	};
+
+	//!Conecta, enva y lee lo que se pueda de un destino
+	void atenderDestino(Destino &d);
+
+	//!Encola un mensaje hacia un destino
+	void encolar(Destino &d, const char *pDatos, int tam);
+
+	//!Nmero de la isla
+	int m_Isla;
+	//!Direccin de la isla
+	char *m_pDireccion;
+	//!Mximo nmero de mensajes en cada cola
+	int m_MaxCola;
+	//!Socket en el que se esperan las conexiones de otras islas
+	int m_fdEscucha;
+	//!Islas a las que se envan migrantes
+	Arreglo<Destino> m_Destinos;
+	//!Coordinador. Su direccin es NULL si no se defini
+	Destino m_Coordinador;
+	//!Conexiones de otras islas
+	Arreglo<ConexionRed> m_Entrantes;
+	//!Migrantes recibidos, como mensajes completos
+	std::deque<char*> m_Migrantes;
+	//!Indica que el coordinador pidi terminar
+	bool m_debeTerminar;
+	//!Indica que ya se invoc \a terminar()
+	bool m_terminado;
+	//!Mensaje que se construye para enviar
+	char *m_pMensaje;
+	//!Capacidad de \a m_pMensaje
+	int m_capMensaje;
+	//!Valores de un individuo que se copian en \a m_pMensaje
+	double *m_pValores;
+	//!Capacidad de \a m_pValores
+	int m_capValores;
+};
+
+
+//!Coordinador de un modelo de islas en red
+/*!Recibe de cada isla su mejor individuo y conserva el mejor global de la historia. Cuando
+alguna isla termina, porque se cumpli alguno de sus criterios de finalizacin, pide a todas las
+dems que terminen.
+Solo est disponible en sistemas POSIX (Ver UN_PROCESOS).*/
+class CoordinadorIslas
+{
+public:
+	//!Constructor
+	CoordinadorIslas(const char *direccion, bool maximizar=false);
+
+	//!Destructor
+	~CoordinadorIslas();
+
+	//!Abre la direccin del coordinador
+	bool iniciar();
+
+	//!Coordina las islas hasta que todas terminen
+	int ejecutar(int numIslas, double tiempoMaximo=0.0);
+
+	//!Retorna la funcin objetivo del mejor individuo global
+	double getMejorObjetivo() const
+	{
+		return m_MejorObjetivo;
+	}
+
+	//!Retorna la isla que encontr el mejor individuo global, o -1 si no se ha recibido ninguno
+	int getIslaMejor() const
+	{
+		return m_IslaMejor;
+	}
+
+	//!Asigna a \a destino el mejor individuo global
+	bool getMejor(Individuo &destino) const;
+
+protected:
+	//!Procesa un mensaje de una isla
+	void procesar(const CabeceraRed &cabecera, const char *pCuerpo);
+
+	//!Pide a todas las islas conectadas que terminen
+	void pedirFin(ConexionRed *pConexion=NULL);
+
+	//!Direccin del coordinador
+	char *m_pDireccion;
+	//!Indica si las islas maximizan la funcin objetivo
+	bool m_Maximizar;
+	//!Socket en el que se esperan las islas
+	int m_fdEscucha;
+	//!Conexiones de las islas
+	Arreglo<ConexionRed> m_Islas;
+	//!Nmero de islas que terminaron
+	int m_numTerminadas;
+	//!Indica que ya se pidi a las islas que terminen
+	bool m_finPedido;
+	//!Funcin objetivo del mejor individuo global
+	double m_MejorObjetivo;
+	//!Isla del mejor individuo global
+	int m_IslaMejor;
+	//!Mensaje con el mejor individuo global
+	char *m_pMejor;
+};
+
+
+//!Clase derivada de OperadorAdaptacion que intercambia individuos con otras islas a travs de IslaRed
+/*!En cada generacin atiende las conexiones de la isla. Cada \a intervalo generaciones enva el mejor
+individuo de la historia a los destinos y al coordinador, y remplaza a los peores individuos de
+la poblacin con hasta \a numMigrantes migrantes recibidos.*/
+class OperadorAdaptacionMigracionRed:public OperadorAdaptacion
+{
+public:
+	//!Constructor
+	OperadorAdaptacionMigracionRed(IslaRed *pIsla, int intervalo=10, int numMigrantes=1);
+
+	//!Destructor
+	~OperadorAdaptacionMigracionRed(){}
+
+	//!Enva y recibe migrantes
+	void adaptacion(AlgoritmoGenetico *pAG);
+
+protected:
+	//!Isla. No pertenece al operador
+	IslaRed *m_pIsla;
+	//!Nmero de generaciones entre migraciones
+	int m_Intervalo;
+	//!Mximo nmero de individuos recibidos en cada migracin
+	int m_NumMigrantes;
+};
+
+
+//!Clase derivada de OperadorFinalizacion que termina la isla cuando lo pide el coordinador
+class OperadorFinalizacionIslas:public OperadorFinalizacion
+{
+public:
+	//!Constructor
+	/*!\param pIsla Isla. No pertenece al operador.*/
+	OperadorFinalizacionIslas(IslaRed *pIsla)
+	{
+		m_pIsla = pIsla;
+	}
+
+	//!Retorna true si el coordinador pidi terminar
+	bool finalizar(const AlgoritmoGenetico &)
+	{
+		m_pIsla->atender();
+		return m_pIsla->debeTerminar();
+	}
+
+protected:
+	//!Isla. No pertenece al operador
+	IslaRed *m_pIsla;
+};
+
+#endif
+
+#endif
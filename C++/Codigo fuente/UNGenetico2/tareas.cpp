@@ -0,0 +1,253 @@
+#include "tareas.h"
+
+
+#if defined(UN_CPP11)
+
+/************************************************************
+                POOL DE TAREAS (Implementacin)
+************************************************************/
+
+thread_local PoolTareas* PoolTareas::s_pPoolActual = NULL;
+thread_local int PoolTareas::s_trabajadorActual = -1;
+
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+//Tarea de PoolTareas::paralelo() que procesa un bloque de elementos
+class __TareaBloque:public Tarea
+{
+public:
+	__TareaBloque(const std::function<void(int, int, int)> *pFuncion, int inicio, int fin, int *pRestantes, std::mutex *pCandado, std::condition_variable *pFin)
+		:m_pFuncion(pFuncion), m_inicio(inicio), m_fin(fin), m_pRestantes(pRestantes), m_pCandado(pCandado), m_pFin(pFin)
+	{
+	}
+
+	void ejecutar(int trabajador)
+	{
+		(*m_pFuncion)(m_inicio, m_fin, trabajador);
+
+		//el aviso se da con el candado tomado, pues quien espera destruye el contador al salir
+		std::lock_guard<std::mutex> candado(*m_pCandado);
+		if(--*m_pRestantes == 0)
+			m_pFin->notify_all();
+	}
+
+protected:
+	const std::function<void(int, int, int)> *m_pFuncion;
+	int m_inicio, m_fin;
+	int *m_pRestantes;
+	std::mutex *m_pCandado;
+	std::condition_variable *m_pFin;
+};
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+
+/*!\param numTrabajadores Nmero de hilos. Con 0 se usa el nmero de ncleos del equipo, o del nodo con AFINIDAD_NODO.
+\param afinidad Forma en que se fijan los trabajadores a los ncleos: AFINIDAD_NINGUNA, AFINIDAD_NUCLEOS o AFINIDAD_NODO.
+\param nodo Nodo al que se fijan los trabajadores con AFINIDAD_NODO.*/
+PoolTareas::PoolTareas(int numTrabajadores, int afinidad, int nodo)
+{
+	m_Afinidad = afinidad;
+	m_Nodo = nodo;
+
+	//la topologa se consulta antes de iniciar los trabajadores, que la leen al fijarse
+	TopologiaNUMA::getNumNodos();
+	if(numTrabajadores <= 0 && afinidad == AFINIDAD_NODO)
+		numTrabajadores = TopologiaNUMA::getNumNucleos(nodo);
+	if(numTrabajadores <= 0)
+		numTrabajadores = (int)std::thread::hardware_concurrency();
+	if(numTrabajadores <= 0)
+		numTrabajadores = 1;
+
+	m_numTrabajadores = numTrabajadores;
+	m_pendientes = 0;
+	m_siguienteCola = 0;
+	m_terminar = false;
+	m_pColas = new Cola[numTrabajadores];
+	m_pSemillas = new unsigned int[numTrabajadores];
+	m_pHilos = new std::thread[numTrabajadores];
+	for(int i=0; i<numTrabajadores; i++)
+	{
+		m_pSemillas[i] = 2654435761u*(unsigned int)(i+1);
+		m_pHilos[i] = std::thread(&PoolTareas::trabajar, this, i);
+	}
+}
+
+
+/*!Las tareas pendientes se ejecutan antes de terminar los trabajadores.*/
+PoolTareas::~PoolTareas()
+{
+	{
+		std::lock_guard<std::mutex> candado(m_candado);
+		m_terminar = true;
+	}
+	m_hayTareas.notify_all();
+	for(int i=0; i<m_numTrabajadores; i++)
+		m_pHilos[i].join();
+	delete[] m_pHilos;
+	delete[] m_pColas;
+	delete[] m_pSemillas;
+}
+
+
+/*!Se crea la primera vez que se invoca, y se destruye al terminar el programa.
+\return Referencia al pool.*/
+PoolTareas& PoolTareas::global()
+{
+	static PoolTareas pool;
+	return pool;
+}
+
+
+/*!Si se invoca desde un trabajador del pool, la tarea va al final de su propia cola; si no,
+a la cola del siguiente trabajador, por turnos.
+\param pTarea Tarea a ejecutar.*/
+void PoolTareas::enviar(Tarea *pTarea)
+{
+	int trabajador = getTrabajadorActual();
+	if(trabajador < 0)
+		trabajador = (int)(m_siguienteCola++ % (unsigned int)m_numTrabajadores);
+	{
+		std::lock_guard<std::mutex> candado(m_pColas[trabajador].candado);
+		m_pColas[trabajador].tareas.push_back(pTarea);
+	}
+	m_pendientes++;
+
+	//el candado evita que el aviso se pierda entre la revisin y la espera de un trabajador
+	{
+		std::lock_guard<std::mutex> candado(m_candado);
+	}
+	m_hayTareas.notify_one();
+}
+
+
+/*!Divide los elementos de 0 a \a numElementos-1 en bloques consecutivos, enva una tarea por
+bloque y espera a que terminen todas. Si se invoca desde un trabajador del pool, ejecuta tareas
+mientras espera.
+\param numElementos Nmero de elementos.
+\param tamBloque Nmero de elementos de cada bloque. Con 0 se crean unos cuatro bloques por trabajador.
+\param funcion Funcin que procesa los elementos de \a inicio a \a fin-1 en el trabajador \a trabajador.
+Puede ejecutarse a la vez en varios hilos.*/
+void PoolTareas::paralelo(int numElementos, int tamBloque, const std::function<void(int inicio, int fin, int trabajador)> &funcion)
+{
+	if(numElementos <= 0)
+		return;
+	if(tamBloque <= 0)
+		tamBloque = (numElementos + 4*m_numTrabajadores - 1)/(4*m_numTrabajadores);
+
+	int restantes = (numElementos + tamBloque - 1)/tamBloque;
+	std::mutex candadoFin;
+	std::condition_variable fin;
+	for(int inicio=0; inicio<numElementos; inicio+=tamBloque)
+	{
+		int final = inicio+tamBloque<numElementos ? inicio+tamBloque : numElementos;
+		enviar( new __TareaBloque(&funcion, inicio, final, &restantes, &candadoFin, &fin) );
+	}
+
+	std::unique_lock<std::mutex> candado(candadoFin);
+	if(getTrabajadorActual() >= 0)
+	{
+		while(restantes > 0)
+		{
+			candado.unlock();
+			if(!ayudar())
+				std::this_thread::yield();
+			candado.lock();
+		}
+		return;
+	}
+	while(restantes > 0)
+		fin.wait(candado);
+}
+
+
+/*!Permite que un trabajador que espera el resultado de otras tareas no se quede sin hacer nada.
+\return false si el hilo no es un trabajador del pool o si no haba tareas pendientes.*/
+bool PoolTareas::ayudar()
+{
+	int trabajador = getTrabajadorActual();
+	if(trabajador < 0)
+		return false;
+	Tarea *pTarea = tomar(trabajador);
+	if(!pTarea)
+		return false;
+	pTarea->ejecutar(trabajador);
+	delete pTarea;
+	return true;
+}
+
+
+/*!La cola propia se toma por el final. Luego se intenta robar del inicio de las colas de los
+dems, empezando por un trabajador al azar.
+\param trabajador Nmero del trabajador.
+\return Apuntador a la tarea, o NULL si no hay tareas en ninguna cola.*/
+Tarea* PoolTareas::tomar(int trabajador)
+{
+	Tarea *pTarea = NULL;
+	{
+		Cola &propia = m_pColas[trabajador];
+		std::lock_guard<std::mutex> candado(propia.candado);
+		if(!propia.tareas.empty())
+		{
+			pTarea = propia.tareas.back();
+			propia.tareas.pop_back();
+		}
+	}
+	if(!pTarea && m_pendientes > 0 && m_numTrabajadores > 1)
+	{
+		//xorshift: rand() no puede usarse desde varios hilos
+		unsigned int &semilla = m_pSemillas[trabajador];
+		semilla ^= semilla << 13;
+		semilla ^= semilla >> 17;
+		semilla ^= semilla << 5;
+		int primero = (int)(semilla % (unsigned int)m_numTrabajadores);
+		for(int i=0; i<m_numTrabajadores && !pTarea; i++)
+		{
+			int victima = (primero + i) % m_numTrabajadores;
+			if(victima == trabajador)
+				continue;
+			Cola &otra = m_pColas[victima];
+			std::lock_guard<std::mutex> candado(otra.candado);
+			if(!otra.tareas.empty())
+			{
+				pTarea = otra.tareas.front();
+				otra.tareas.pop_front();
+			}
+		}
+	}
+	if(pTarea)
+		m_pendientes--;
+	return pTarea;
+}
+
+
+/*!Fija el hilo segn \a m_Afinidad. Luego ejecuta tareas mientras las haya, y espera cuando
+todas las colas estn vacas.
+\param trabajador Nmero del trabajador.*/
+void PoolTareas::trabajar(int trabajador)
+{
+	s_pPoolActual = this;
+	s_trabajadorActual = trabajador;
+	if(m_Afinidad == AFINIDAD_NUCLEOS)
+		TopologiaNUMA::fijarHiloEnNucleo( TopologiaNUMA::getNucleo(-1, trabajador) );
+	else if(m_Afinidad == AFINIDAD_NODO)
+		TopologiaNUMA::fijarHiloEnNodo(m_Nodo);
+	for(;;)
+	{
+		Tarea *pTarea = tomar(trabajador);
+		if(pTarea)
+		{
+			pTarea->ejecutar(trabajador);
+			delete pTarea;
+			continue;
+		}
+		std::unique_lock<std::mutex> candado(m_candado);
+		while(m_pendientes == 0 && !m_terminar)
+			m_hayTareas.wait(candado);
+		if(m_pendientes == 0 && m_terminar)
+			return;
+	}
+}
+
+#endif
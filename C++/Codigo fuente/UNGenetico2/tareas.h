@@ -0,0 +1,139 @@
+#ifndef __TAREAS_H
+#define __TAREAS_H
+
+#include "memoria.h"
+#include "afinidad.h"
+
+#if defined(UN_CPP11)
+
+#include <thread>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+
+
+/************************************************************
+                     POOL DE TAREAS
+************************************************************/
+
+//!Clase abstracta que define un trabajo que se ejecuta en un PoolTareas
+class Tarea
+{
+public:
+	//!Constructor por defecto
+	Tarea(){}
+
+	//!Destructor
+	/*!Es virtual para poder definirse en las clases derivadas*/
+	virtual ~Tarea(){}
+
+	//!Ejecuta el trabajo
+	/*!Debe definirse en las clases derivadas.
+	\param trabajador Nmero del hilo que ejecuta la tarea, entre 0 y PoolTareas::getNumTrabajadores()-1.
+	Permite que la tarea use datos propios de cada hilo sin candados.*/
+	virtual void ejecutar(int trabajador)=0;
+};
+
+
+//!Conjunto de hilos que ejecutan tareas con robo de trabajo
+/*!Cada hilo (trabajador) tiene su propia cola de tareas. Un trabajador toma las tareas de su
+cola por el final, de modo que primero ejecuta las ms recientes, cuyos datos an estn en su
+cach; cuando su cola se vaca, roba tareas del inicio de la cola de otro trabajador elegido al
+azar. As, cuando el costo de las tareas es muy desigual (por ejemplo, funciones objetivo cuyo
+tiempo depende de los parmetros o genomas de longitud variable), ningn hilo queda sin trabajo
+mientras otros tienen tareas pendientes, como sucede al repartir la poblacin en partes fijas.
+
+Las tareas enviadas desde un trabajador van a su propia cola; las enviadas desde otro hilo se
+reparten entre las colas de los trabajadores. Un trabajador que espera a que terminen otras
+tareas (Ver \a paralelo()) ejecuta tareas pendientes mientras tanto.
+
+Los componentes de la librera que usan hilos (Ver EvaluadorHilos) comparten el pool global
+(Ver \a global()), con un trabajador por ncleo, para no crear ms hilos que ncleos.
+Los trabajadores pueden fijarse a ncleos (Ver TopologiaNUMA): con AFINIDAD_NUCLEOS cada trabajador
+se fija a un ncleo, recorriendo los ncleos nodo por nodo; con AFINIDAD_NODO todos se fijan a los
+ncleos de un nodo, de modo que leen la memoria de un algoritmo fijado al mismo nodo sin pasar por
+los dems. En equipos con un solo nodo, AFINIDAD_NODO no tiene efecto.
+Los procesos creados con \c fork() no heredan los trabajadores, por lo que el pool global debe
+usarse por primera vez despus de crear los procesos.
+Solo est disponible al compilar con C++11 o posterior.*/
+class PoolTareas
+{
+public:
+	//!Constructor. Inicia los trabajadores
+	PoolTareas(int numTrabajadores=0, int afinidad=AFINIDAD_NINGUNA, int nodo=0);
+
+	//!Destructor. Espera a que terminen las tareas pendientes y termina los trabajadores
+	~PoolTareas();
+
+	//!Adiciona una tarea al pool. La tarea pertenece al pool, que la destruye despus de ejecutarla
+	void enviar(Tarea *pTarea);
+
+	//!Ejecuta \a funcion sobre bloques de \a numElementos elementos y espera a que terminen
+	void paralelo(int numElementos, int tamBloque, const std::function<void(int inicio, int fin, int trabajador)> &funcion);
+
+	//!Ejecuta una tarea pendiente en el hilo actual, si es un trabajador del pool
+	bool ayudar();
+
+	//!Retorna el nmero del trabajador del hilo actual, o -1 si el hilo no es un trabajador del pool
+	int getTrabajadorActual() const
+	{
+		return s_pPoolActual==this ? s_trabajadorActual : -1;
+	}
+
+	//!Retorna el nmero de trabajadores
+	int getNumTrabajadores() const
+	{
+		return m_numTrabajadores;
+	}
+
+	//!Retorna el pool compartido por la librera, con un trabajador por ncleo
+	static PoolTareas& global();
+
+protected:
+	//!Cola de tareas de un trabajador
+	struct Cola
+	{
+		//!Tareas. El dueo las toma por el final y los dems las roban por el inicio
+		std::deque<Tarea*> tareas;
+		//!Protege las tareas
+		std::mutex candado;
+	};
+
+	//!Ciclo de trabajo de cada hilo
+	void trabajar(int trabajador);
+
+	//!Toma una tarea de la cola propia o la roba de otro trabajador
+	Tarea* tomar(int trabajador);
+
+	//!Nmero de trabajadores
+	int m_numTrabajadores;
+	//!Forma en que se fijan los trabajadores a los ncleos. Puede ser AFINIDAD_NINGUNA, AFINIDAD_NUCLEOS o AFINIDAD_NODO
+	int m_Afinidad;
+	//!Nodo al que se fijan los trabajadores con AFINIDAD_NODO
+	int m_Nodo;
+	//!Colas de los trabajadores
+	Cola *m_pColas;
+	//!Hilos de los trabajadores
+	std::thread *m_pHilos;
+	//!Estado del generador de nmeros aleatorios de cada trabajador, para elegir a quin robar
+	unsigned int *m_pSemillas;
+	//!Nmero de tareas en las colas
+	std::atomic<int> m_pendientes;
+	//!Cola en la que se adiciona la siguiente tarea enviada desde fuera del pool
+	std::atomic<unsigned int> m_siguienteCola;
+	//!Indica a los trabajadores que deben terminar
+	bool m_terminar;
+	//!Protege la espera de los trabajadores sin tareas
+	std::mutex m_candado;
+	//!Avisa a los trabajadores que hay tareas
+	std::condition_variable m_hayTareas;
+
+	//!Pool del trabajador del hilo actual
+	static thread_local PoolTareas *s_pPoolActual;
+	//!Nmero del trabajador del hilo actual
+	static thread_local int s_trabajadorActual;
+};
+
+#endif
+
+#endif